@@ -248,6 +248,8 @@ auto assemble_op_jump(Program&, std::vector<Token> const&,
         std::map<std::string, Token_index> const&) -> void;
 auto assemble_op_structremove(Program&, std::vector<Token> const&,
         Token_index const) -> void;
+auto assemble_op_hashmapremove(Program&, std::vector<Token> const&,
+        Token_index const) -> void;
 auto assemble_op_msg(Program&, std::vector<Token> const&,
         Token_index const) -> void;
 auto assemble_op_remove(Program&, std::vector<Token> const&,
@@ -266,10 +268,14 @@ auto assemble_op_arg(Program&, std::vector<Token> const&,
         Token_index const) -> void;
 auto assemble_op_process(Program&, std::vector<Token> const&,
         Token_index const) -> void;
+auto assemble_op_coroutine(Program&, std::vector<Token> const&,
+        Token_index const) -> void;
 auto assemble_op_join(Program&, std::vector<Token> const&,
         Token_index const) -> void;
 auto assemble_op_receive(Program&, std::vector<Token> const&,
         Token_index const) -> void;
+auto assemble_op_receivematch(Program&, std::vector<Token> const&,
+        Token_index const) -> void;
 auto assemble_op_attach(Program&, std::vector<Token> const&,
         Token_index const) -> void;
 }}}}  // namespace viua::assembler::backend::op_assemblers
@@ -44,6 +44,12 @@ struct Register {
         viua::internals::RegisterSets::LOCAL;
     viua::internals::ValueTypes value_type =
         viua::internals::ValueTypes::UNDEFINED;
+    /*
+     * Type of elements of typed vectors (created by the "vectorof"
+     * instruction), UNDEFINED for other values.
+     */
+    viua::internals::ValueTypes element_type =
+        viua::internals::ValueTypes::UNDEFINED;
     std::pair<bool, viua::cg::lex::Token> inferred = {false, {}};
 
     auto operator<(const Register& that) const -> bool;
@@ -175,6 +181,9 @@ auto check_if_name_resolved(Register_usage_profile const& rup,
 auto check_use_of_register(Register_usage_profile&,
                            viua::assembler::frontend::parser::RegisterIndex,
                            std::string const = "use of") -> void;
+auto element_type_of(Register_usage_profile const&,
+                     viua::assembler::frontend::parser::RegisterIndex const&)
+    -> viua::internals::ValueTypes;
 
 
 using viua::internals::ValueTypes;
@@ -186,6 +195,14 @@ auto operator!(ValueTypes const) -> bool;
 auto depointerise_type_if_needed(viua::internals::ValueTypes const, bool const)
     -> viua::internals::ValueTypes;
 
+/*
+ * Checks if the value in the second register may be put into the (typed)
+ * vector in the first register.
+ */
+auto assert_type_of_element(Register_usage_profile&,
+                            RegisterIndex const&,
+                            RegisterIndex const&) -> void;
+
 template<viua::internals::ValueTypes expected_type>
 auto assert_type_of_register(Register_usage_profile& register_usage_profile,
                              RegisterIndex const& register_index)
@@ -340,6 +357,8 @@ auto check_op_textconcat(Register_usage_profile& register_usage_profile,
                          Instruction const& instruction) -> void;
 auto check_op_vector(Register_usage_profile& register_usage_profile,
                      Instruction const& instruction) -> void;
+auto check_op_vectorof(Register_usage_profile& register_usage_profile,
+                       Instruction const& instruction) -> void;
 auto check_op_vinsert(Register_usage_profile& register_usage_profile,
                       Instruction const& instruction) -> void;
 auto check_op_vpush(Register_usage_profile& register_usage_profile,
@@ -423,8 +442,26 @@ auto check_op_send(Register_usage_profile& register_usage_profile,
                    Instruction const& instruction) -> void;
 auto check_op_receive(Register_usage_profile& register_usage_profile,
                       Instruction const& instruction) -> void;
+auto check_op_sendall(Register_usage_profile& register_usage_profile,
+                      Instruction const& instruction) -> void;
+auto check_op_broadcast(Register_usage_profile& register_usage_profile,
+                        Instruction const& instruction) -> void;
+auto check_op_receivemany(Register_usage_profile& register_usage_profile,
+                          Instruction const& instruction) -> void;
+auto check_op_receivematch(Register_usage_profile& register_usage_profile,
+                           Instruction const& instruction) -> void;
+auto check_op_sleep(Register_usage_profile& register_usage_profile,
+                    Instruction const& instruction) -> void;
+auto check_op_priority(Register_usage_profile& register_usage_profile,
+                       Instruction const& instruction) -> void;
 auto check_op_watchdog(Register_usage_profile&, Instruction const& instruction)
     -> void;
+auto check_op_coroutine(Register_usage_profile& register_usage_profile,
+                        Instruction const& instruction) -> void;
+auto check_op_resume(Register_usage_profile& register_usage_profile,
+                     Instruction const& instruction) -> void;
+auto check_op_yield(Register_usage_profile& register_usage_profile,
+                    Instruction const& instruction) -> void;
 auto check_op_throw(Register_usage_profile& register_usage_profile,
                     ParsedSource const& ps,
                     std::map<Register, Closure>&,
@@ -458,6 +495,20 @@ auto check_op_structremove(Register_usage_profile& register_usage_profile,
                            Instruction const& instruction) -> void;
 auto check_op_structkeys(Register_usage_profile& register_usage_profile,
                          Instruction const& instruction) -> void;
+auto check_op_hashmap(Register_usage_profile& register_usage_profile,
+                      Instruction const& instruction) -> void;
+auto check_op_hashmapinsert(Register_usage_profile& register_usage_profile,
+                            Instruction const& instruction) -> void;
+auto check_op_hashmapremove(Register_usage_profile& register_usage_profile,
+                            Instruction const& instruction) -> void;
+auto check_op_hashmaplookup(Register_usage_profile& register_usage_profile,
+                            Instruction const& instruction) -> void;
+auto check_op_hashmapcontains(Register_usage_profile& register_usage_profile,
+                              Instruction const& instruction) -> void;
+auto check_op_hashmapkeys(Register_usage_profile& register_usage_profile,
+                          Instruction const& instruction) -> void;
+auto check_op_hashmapsize(Register_usage_profile& register_usage_profile,
+                          Instruction const& instruction) -> void;
 auto check_op_new(Register_usage_profile& register_usage_profile,
                   Instruction const& instruction) -> void;
 auto check_op_msg(Register_usage_profile& register_usage_profile,
@@ -0,0 +1,130 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_ASSEMBLER_OPTIMISER_H
+#define VIUA_ASSEMBLER_OPTIMISER_H
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <viua/bytecode/bytetypedef.h>
+#include <viua/cg/lex.h>
+#include <viua/kernel/profile.h>
+
+
+namespace viua { namespace assembler { namespace optimiser {
+/*
+ * Optimisation passes work on cooked token streams of functions (i.e. on the
+ * same representation that is fed to the bytecode generator).
+ * They are opt-in and must never change observable behaviour of correct
+ * programs.
+ */
+using Invocable_bodies = std::map<std::string, std::vector<viua::cg::lex::Token>>;
+
+/*
+ * Helpers for walking cooked token streams line by line.
+ */
+namespace tokens {
+using Token_index = std::vector<viua::cg::lex::Token>::size_type;
+
+auto end_of_line(std::vector<viua::cg::lex::Token> const&, Token_index)
+    -> Token_index;
+auto is_directive(viua::cg::lex::Token const&) -> bool;
+auto is_terminator(viua::cg::lex::Token const&) -> bool;
+auto is_frame_consumer(viua::cg::lex::Token const&) -> bool;
+
+/*
+ * Returns true if the token at given index is an index of a local register
+ * (i.e. it is followed by "local" or "current" register set specifier).
+ */
+auto is_local_register_mention(std::vector<viua::cg::lex::Token> const&,
+                               Token_index const) -> bool;
+auto index_of(viua::cg::lex::Token const&)
+    -> viua::internals::types::register_index;
+
+/*
+ * Returns index of the first token of the instruction that consumes a frame
+ * created by "frame" instruction at given index, or size of the token stream
+ * if the consumer cannot be found without following control flow.
+ */
+auto consumer_of_frame(std::vector<viua::cg::lex::Token> const&, Token_index)
+    -> Token_index;
+}  // namespace tokens
+
+/*
+ * Renumbers local registers of a function so that they form a dense set
+ * starting at zero, and lets registers whose lifetimes do not overlap share
+ * a single index.
+ * Returns the number of local registers the function needs, or zero if the
+ * function was left untouched (e.g. because it accesses registers indirectly
+ * so its register usage cannot be determined statically).
+ */
+auto allocate_registers(std::vector<viua::cg::lex::Token>&)
+    -> viua::internals::types::register_index;
+
+/*
+ * Shrinks local register sets requested by "frame" instructions if the
+ * frame is used to call a function with known register requirements.
+ */
+auto shrink_frames(
+    std::vector<viua::cg::lex::Token>&,
+    std::map<std::string, viua::internals::types::register_index> const&)
+    -> void;
+
+/*
+ * Runs register allocation over all functions (closures excluded, as their
+ * register layout is dictated by the code that captures values into them),
+ * and adjusts frames in all functions and blocks.
+ */
+auto allocate_registers(Invocable_bodies& functions,
+                        Invocable_bodies& blocks,
+                        std::set<std::string> const& closures) -> void;
+/*
+ * Replaces calls to small leaf functions (i.e. functions that do not call
+ * other functions, jump, or touch anything but their own local registers)
+ * with bodies of these functions.
+ * Functions are inlined if they have at most as many instructions as given
+ * by the threshold.
+ *
+ * If a profile is given, functions that were never called during the
+ * profiled run are not inlined, and functions that were called often get
+ * their threshold raised.
+ */
+auto inline_calls(Invocable_bodies& functions,
+                  Invocable_bodies& blocks,
+                  std::set<std::string> const& closures,
+                  bool const as_library,
+                  std::vector<viua::cg::lex::Token>::size_type const threshold,
+                  viua::kernel::Profile const* const profile = nullptr)
+    -> void;
+
+/*
+ * Sorts names of invocables so that the ones called most often during the
+ * profiled run are placed first, next to each other, in the bytecode.
+ * Invocables with equal counts keep their relative order.
+ */
+auto order_by_profile(std::vector<std::string>&, viua::kernel::Profile const&)
+    -> void;
+}}}  // namespace viua::assembler::optimiser
+
+
+#endif
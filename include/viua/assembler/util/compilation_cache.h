@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_ASSEMBLER_UTIL_COMPILATION_CACHE_H
+#define VIUA_ASSEMBLER_UTIL_COMPILATION_CACHE_H
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <viua/bytecode/bytetypedef.h>
+#include <viua/cg/lex.h>
+
+
+namespace viua { namespace assembler { namespace frontend { namespace parser {
+struct InstructionsBlock;
+struct ParsedSource;
+}}}}  // namespace viua::assembler::frontend::parser
+
+namespace viua { namespace assembler { namespace util {
+/*
+ * Bytecode of a single function or block, as produced by the assembler before
+ * it is placed in the final binary.
+ * Jump targets inside the bytecode are relative to the beginning of the
+ * invocable (i.e. the invocable was assembled as if it was placed at offset
+ * zero) so that cached bytecode can be reused no matter where the invocable
+ * ends up in the binary.
+ */
+struct Compiled_invocable {
+    viua::internals::types::bytecode_size size = 0;
+    std::unique_ptr<viua::internals::types::byte[]> bytecode;
+    std::vector<viua::internals::types::bytecode_size> jumps;
+
+    auto relocate(viua::internals::types::bytecode_size const) -> void;
+};
+
+/*
+ * Only bytecode of invocables and results of static analysis are cached.
+ * Source files are lexed and parsed, and linked modules are loaded on every
+ * run of the assembler; keys of cache entries are computed from the tokens
+ * produced by the lexer.
+ */
+class Compilation_cache {
+    /*
+     * Directory in which cache entries are stored.
+     * Every entry is a single file named after the key of the entry.
+     */
+    std::string const directory;
+
+    /*
+     * Salt mixed into every key.
+     * It is made of the version of the assembler, the version of the encoding
+     * of operands, and the opcode table so that bytecode produced by one build
+     * of the assembler is never reused by another one with a different
+     * encoding of instructions.
+     */
+    std::string const salt;
+
+    auto path_of(std::string const&, std::string const&) const -> std::string;
+
+  public:
+    using key_type = std::string;
+
+    auto key_of(std::vector<viua::cg::lex::Token> const&) const -> key_type;
+    auto key_of(viua::assembler::frontend::parser::InstructionsBlock const&,
+                key_type const&) const -> key_type;
+    auto key_of_dependencies(
+        viua::assembler::frontend::parser::ParsedSource const&) const
+        -> key_type;
+
+    auto fetch(key_type const&, Compiled_invocable&) const -> bool;
+    auto store(key_type const&, Compiled_invocable const&) const -> void;
+
+    auto verified(key_type const&) const -> bool;
+    auto mark_verified(key_type const&) const -> void;
+
+    Compilation_cache(std::string, std::string const&);
+};
+}}}  // namespace viua::assembler::util
+
+
+#endif
@@ -31,6 +31,8 @@ typedef uint8_t byte;
 typedef uint64_t bytecode_size;
 typedef uint32_t register_index;
 
+typedef uint64_t function_id;
+
 typedef uint32_t schedulers_count;
 typedef uint64_t processes_count;
 
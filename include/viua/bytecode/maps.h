@@ -69,6 +69,7 @@ std::map<enum OPCODE, std::string> const OP_NAMES = {
     {TEXTCONCAT, "textconcat"},
 
     {VECTOR, "vector"},
+    {VECTOROF, "vectorof"},
     {VINSERT, "vinsert"},
     {VPUSH, "vpush"},
     {VPOP, "vpop"},
@@ -172,7 +173,16 @@ std::map<enum OPCODE, std::string> const OP_NAMES = {
     {JOIN, "join"},
     {SEND, "send"},
     {RECEIVE, "receive"},
+    {SENDALL, "sendall"},
+    {BROADCAST, "broadcast"},
+    {RECEIVEMANY, "receivemany"},
+    {RECEIVEMATCH, "receivematch"},
+    {SLEEP, "sleep"},
+    {PRIORITY, "priority"},
     {WATCHDOG, "watchdog"},
+    {COROUTINE, "coroutine"},
+    {RESUME, "resume"},
+    {YIELD, "yield"},
 
     {JUMP, "jump"},
     {IF, "if"},
@@ -198,6 +208,13 @@ std::map<enum OPCODE, std::string> const OP_NAMES = {
     {STRUCTINSERT, "structinsert"},
     {STRUCTREMOVE, "structremove"},
     {STRUCTKEYS, "structkeys"},
+    {HASHMAP, "hashmap"},
+    {HASHMAPINSERT, "hashmapinsert"},
+    {HASHMAPREMOVE, "hashmapremove"},
+    {HASHMAPLOOKUP, "hashmaplookup"},
+    {HASHMAPCONTAINS, "hashmapcontains"},
+    {HASHMAPKEYS, "hashmapkeys"},
+    {HASHMAPSIZE, "hashmapsize"},
 
     {NEW, "new"},
     {MSG, "msg"},
@@ -116,6 +116,15 @@ enum OPCODE : viua::internals::types::byte {
     TEXTCONCAT,
 
     VECTOR,
+    /*
+     *  Create an empty vector with unboxed elements of given type.
+     *  The type is one of the atoms 'int', 'float', and 'byte'.
+     *  Typed vectors are used with the same instructions as ordinary
+     *  vectors, but only accept elements of their type.
+     *
+     *  vectorof {target-register} {type-atom}
+     */
+    VECTOROF,
     VINSERT,
     VPUSH,
     VPOP,
@@ -350,8 +359,98 @@ enum OPCODE : viua::internals::types::byte {
     JOIN,      // join a process
     SEND,      // send a message to a process
     RECEIVE,   // receive passed message, block until one arrives
+
+    /*
+     *  Send every message from a vector to a process.
+     *  All messages are put in the mailbox of the receiver at once, in the
+     *  order in which they appear in the vector.
+     *  The vector is moved out of its register.
+     *
+     *  sendall {pid-register} {vector-register}
+     */
+    SENDALL,
+
+    /*
+     *  Send a message to every process in a vector of PIDs.
+     *  Every receiver gets its own copy of the message, and the message is
+     *  moved out of its register.
+     *
+     *  broadcast {vector-of-pids-register} {message-register}
+     */
+    BROADCAST,
+
+    /*
+     *  Receive at most N messages that are already pending, and put them in
+     *  a vector (in the order in which they were received).
+     *  Does not block; if no messages are pending the vector is empty.
+     *
+     *  receivemany {target-register} {count-register}
+     */
+    RECEIVEMANY,
+
+    /*
+     *  Receive the first message matching a filter, blocking until one
+     *  arrives or the timeout passes.
+     *  Messages that do not match are kept in the order in which they
+     *  arrived, and are received by later receive instructions.
+     *
+     *  The filter may be an atom (matching an equal atom, or any value of
+     *  the type with the same name), a struct (matching structs with equal
+     *  values under all of its keys), or any other value (matching equal
+     *  values).
+     *
+     *  receivematch {target-register|void} {filter-register} {timeout}
+     */
+    RECEIVEMATCH,
+
+    /*
+     *  Suspend the process for (at least) given number of milliseconds.
+     *  Only the process sleeps; the scheduler keeps running other processes
+     *  in the meantime.
+     *
+     *  sleep {milliseconds-register}
+     */
+    SLEEP,
+
+    /*
+     *  Move the process to another priority class.
+     *  The class is given as one of the atoms 'realtime', 'normal', and
+     *  'batch', and takes effect from the next burst of the scheduler.
+     *
+     *  priority {class-register}
+     */
+    PRIORITY,
+
     WATCHDOG,  // spawn watchdog process
 
+    /*
+     *  Create a coroutine running a function with the arguments in the
+     *  frame.
+     *  The coroutine runs on its own stack inside the process that created
+     *  it, and does not start running until it is resumed.
+     *
+     *  coroutine {target-register} {function-name}
+     */
+    COROUTINE,
+
+    /*
+     *  Run a coroutine until it yields or returns, and put the value it
+     *  yielded (or returned) in the target register.
+     *  Throws an exception if the coroutine has already finished.
+     *
+     *  resume {target-register} {coroutine-register}
+     */
+    RESUME,
+
+    /*
+     *  Suspend the running coroutine and pass a copy of a value to the
+     *  instruction which resumed it.
+     *  Throws an exception if executed outside of a coroutine.
+     *
+     *  yield {value-register}
+     */
+    YIELD,
+
     JUMP,
     IF,
 
@@ -427,6 +526,63 @@ enum OPCODE : viua::internals::types::byte {
      */
     STRUCTKEYS,
 
+    /*
+     *  Create a hash map.
+     *  Hash maps are key-value containers with keys of any hashable type
+     *  (integers, floats, atoms, strings, texts, and bits).
+     *
+     *  hashmap {target-register}
+     */
+    HASHMAP,
+
+    /*
+     *  Insert a value into a hash map at a given key, replacing the value
+     *  previously stored at the key.
+     *  Copies the key, and moves the value into the hash map.
+     *
+     *  hashmapinsert {target-hashmap-register} {key-register} {value-register}
+     */
+    HASHMAPINSERT,
+
+    /*
+     *  Remove a value at a given key from a hash map, and return removed
+     *  value.
+     *  Throws an exception if the hash map does not have requested key.
+     *
+     *  hashmapremove {result-register} {source-hashmap-register} {key-register}
+     */
+    HASHMAPREMOVE,
+
+    /*
+     *  Get a pointer to the value at a given key in a hash map.
+     *  Throws an exception if the hash map does not have requested key.
+     *
+     *  hashmaplookup {result-register} {source-hashmap-register} {key-register}
+     */
+    HASHMAPLOOKUP,
+
+    /*
+     *  Check if a hash map has a given key.
+     *
+     *  hashmapcontains {result-register} {source-hashmap-register} {key-register}
+     */
+    HASHMAPCONTAINS,
+
+    /*
+     *  Get a vector with keys of a hash map.
+     *  Order of the keys is unspecified.
+     *
+     *  hashmapkeys {result} {source-hashmap-register}
+     */
+    HASHMAPKEYS,
+
+    /*
+     *  Get the number of keys in a hash map.
+     *
+     *  hashmapsize {result} {source-hashmap-register}
+     */
+    HASHMAPSIZE,
+
     NEW,  // construct new instance of a class in a register
     MSG,  // send a message to an object (used for dynamic dispatch, for static
           // use plain "CALL")
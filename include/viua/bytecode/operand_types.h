@@ -134,6 +134,10 @@ enum class ValueTypes : ValueTypesType {
     OBJECT = 1 << 14,
 
     POINTER = 1 << 15,
+
+    HASHMAP = 1 << 16,
+
+    COROUTINE = 1 << 17,
 };
 }}  // namespace viua::internals
 
@@ -133,6 +133,8 @@ auto optextconcat(viua::internals::types::byte*, int_op, int_op, int_op)
 
 auto opvector(viua::internals::types::byte*, int_op, int_op, int_op)
     -> viua::internals::types::byte*;
+auto opvectorof(viua::internals::types::byte*, int_op, std::string)
+    -> viua::internals::types::byte*;
 auto opvinsert(viua::internals::types::byte*, int_op, int_op, int_op)
     -> viua::internals::types::byte*;
 auto opvpush(viua::internals::types::byte*, int_op, int_op)
@@ -310,8 +312,26 @@ auto opsend(viua::internals::types::byte*, int_op, int_op)
     -> viua::internals::types::byte*;
 auto opreceive(viua::internals::types::byte*, int_op, timeout_op)
     -> viua::internals::types::byte*;
+auto opsendall(viua::internals::types::byte*, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto opbroadcast(viua::internals::types::byte*, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto opreceivemany(viua::internals::types::byte*, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto opreceivematch(viua::internals::types::byte*, int_op, int_op, timeout_op)
+    -> viua::internals::types::byte*;
+auto opsleep(viua::internals::types::byte*, int_op)
+    -> viua::internals::types::byte*;
+auto oppriority(viua::internals::types::byte*, int_op)
+    -> viua::internals::types::byte*;
 auto opwatchdog(viua::internals::types::byte*, const std::string&)
     -> viua::internals::types::byte*;
+auto opcoroutine(viua::internals::types::byte*, int_op, const std::string&)
+    -> viua::internals::types::byte*;
+auto opresume(viua::internals::types::byte*, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto opyield(viua::internals::types::byte*, int_op)
+    -> viua::internals::types::byte*;
 
 auto opjump(viua::internals::types::byte*,
             viua::internals::types::bytecode_size)
@@ -362,6 +382,21 @@ auto opstructremove(viua::internals::types::byte*, int_op, int_op, int_op)
 auto opstructkeys(viua::internals::types::byte*, int_op, int_op)
     -> viua::internals::types::byte*;
 
+auto ophashmap(viua::internals::types::byte*, int_op)
+    -> viua::internals::types::byte*;
+auto ophashmapinsert(viua::internals::types::byte*, int_op, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto ophashmapremove(viua::internals::types::byte*, int_op, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto ophashmaplookup(viua::internals::types::byte*, int_op, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto ophashmapcontains(viua::internals::types::byte*, int_op, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto ophashmapkeys(viua::internals::types::byte*, int_op, int_op)
+    -> viua::internals::types::byte*;
+auto ophashmapsize(viua::internals::types::byte*, int_op, int_op)
+    -> viua::internals::types::byte*;
+
 auto opnew(viua::internals::types::byte*, int_op, const std::string&)
     -> viua::internals::types::byte*;
 auto opmsg(viua::internals::types::byte*, int_op, const std::string&)
@@ -29,6 +29,11 @@
 #include <viua/program.h>
 
 
+namespace viua { namespace assembler { namespace util {
+class Compilation_cache;
+}}}  // namespace viua::assembler::util
+
+
 struct invocables_t {
     std::vector<std::string> names;
     std::vector<std::string> signatures;
@@ -41,6 +46,12 @@ struct compilationflags_t {
     bool verbose;
     bool debug;
     bool scream;
+
+    /*
+     * Cache of compiled functions and blocks.
+     * May be null, in which case everything is compiled from scratch.
+     */
+    viua::assembler::util::Compilation_cache* cache = nullptr;
 };
 
 
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,6 +30,11 @@
 #include <viua/kernel/registerset.h>
 #include <viua/util/memory.h>
 
+
+namespace viua { namespace process {
+class Baseline_function;
+}}  // namespace viua::process
+
 class Frame {
   public:
     viua::internals::types::byte* return_address;
@@ -37,11 +43,44 @@ class Frame {
         local_register_set;
 
     viua::kernel::Register* return_register;
+    /*
+     * Value returned by the function running in this frame.
+     * It is set aside when the function returns, before its deferred calls
+     * run, so they cannot change it.
+     */
+    std::unique_ptr<viua::types::Value> return_value;
 
     std::vector<std::unique_ptr<Frame>> deferred_calls;
+    /*
+     * Frame prepared (e.g. for a tail call) by the function which started
+     * this deferred call.
+     * It is given back to that function when the deferred call returns.
+     */
+    std::unique_ptr<Frame> postponed_frame_new;
 
     std::string function_name;
 
+    /*
+     * Code produced by the baseline compiler for the function running in
+     * this frame, or null if the function is executed only by the
+     * interpreter.
+     */
+    viua::process::Baseline_function const* compiled_code = nullptr;
+    /*
+     * Number of backward jumps (i.e. loop iterations) executed by the
+     * interpreter in this frame.
+     * Functions that loop for long enough are compiled even if they are
+     * not called often.
+     */
+    uint64_t backward_jumps = 0;
+
+    /*
+     * Static register set of the function running in this frame.
+     * Resolved by the process on first access to a static register, and
+     * then reused for the rest of the call.
+     */
+    viua::kernel::RegisterSet* static_register_set = nullptr;
+
     inline viua::internals::types::byte* ret_address() {
         return return_address;
     }
@@ -49,6 +88,12 @@ class Frame {
     void set_local_register_set(viua::kernel::RegisterSet*,
                                 bool receives_ownership = true);
 
+    /*
+     * Returns true if the given value is held (directly or inside other
+     * values) by the frame, or by frames of calls it deferred.
+     */
+    auto reaches(viua::types::Value const*) -> bool;
+
     Frame(viua::internals::types::byte*,
           viua::internals::types::register_index,
           viua::internals::types::register_index = 16);
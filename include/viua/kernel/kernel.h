@@ -26,6 +26,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <dlfcn.h>
 #include <iostream>
 #include <map>
@@ -41,7 +42,10 @@
 #include <vector>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/include/module.h>
+#include <viua/kernel/profile.h>
 #include <viua/process.h>
+#include <viua/process/baseline.h>
+#include <viua/scheduler/topology.h>
 #include <viua/types/prototype.h>
 
 
@@ -64,9 +68,36 @@ class Mailbox {
     mutable std::mutex mailbox_mutex;
     std::vector<std::unique_ptr<viua::types::Value>> messages;
 
+    /*
+     * Generation of the process owning the mailbox, or zero if the mailbox
+     * is closed.
+     * Messages sent to any other generation are dropped.
+     */
+    viua::process::PID::generation_type owner = 0;
+
+    /*
+     * Process waiting (suspended) until a message arrives, if any.
+     * It is woken up by the first message sent to the mailbox.
+     */
+    viua::process::Process* waiting = nullptr;
+
+    auto wake_waiting_process() -> void;
+
   public:
-    auto send(std::unique_ptr<viua::types::Value>) -> void;
-    auto receive(std::queue<std::unique_ptr<viua::types::Value>>&) -> void;
+    auto open(viua::process::PID::generation_type const) -> void;
+    auto close() -> void;
+
+    auto send(viua::process::PID::generation_type const,
+              std::unique_ptr<viua::types::Value>) -> void;
+    auto send(viua::process::PID::generation_type const,
+              std::vector<std::unique_ptr<viua::types::Value>>) -> void;
+    /*
+     * Moves all messages to the given queue.
+     * If there are no messages and a process is given, it is suspended until
+     * a message arrives.
+     */
+    auto receive(std::deque<std::unique_ptr<viua::types::Value>>&,
+                 viua::process::Process*) -> void;
     auto size() const -> decltype(messages)::size_type;
 
     Mailbox() = default;
@@ -118,10 +149,108 @@ class ProcessResult {
     auto transfer_exception() -> std::unique_ptr<viua::types::Value>;
     auto transfer_result() -> std::unique_ptr<viua::types::Value>;
 
+    /*
+     * Prepare the result for a new process.
+     */
+    auto reset() -> void;
+
     ProcessResult() = default;
     ProcessResult(ProcessResult&&);
 };
 
+/*
+ * Table of processes, indexed by PIDs.
+ *
+ * Every process gets a slot holding its mailbox and its result.
+ * Slots are kept in fixed-size chunks that are never moved or freed while the
+ * kernel is running so lookups need no locks: a PID is valid if the
+ * generation of its slot is the same as the generation of the PID.
+ * Generations of slots in use are odd, and generations of free slots are
+ * even.
+ *
+ * A slot is held by its process until the process dies, and by the result
+ * of the process until the result is transferred or the process is detached.
+ * Slots that are no longer held are put on a free list and reused.
+ */
+class Process_table {
+  public:
+    using index_type      = viua::process::PID::index_type;
+    using generation_type = viua::process::PID::generation_type;
+
+    class Slot {
+        friend class Process_table;
+
+        std::atomic<generation_type> generation{0};
+        std::atomic<uint32_t> holds{0};
+        std::atomic<index_type> next_free{0};
+
+      public:
+        std::atomic_bool joinable{false};
+        Mailbox mailbox;
+        ProcessResult result;
+    };
+
+    static constexpr index_type chunk_size = 256;
+    static constexpr index_type max_chunks = (1 << 16);
+
+  private:
+    std::unique_ptr<std::atomic<Slot*>[]> chunks;
+    std::atomic<index_type> next_unused{0};
+
+    /*
+     * Head of the free list: index of the first free slot (or no_slot) in
+     * the lower half, and a tag bumped on every change in the upper half to
+     * prevent ABA problems.
+     */
+    static constexpr index_type no_slot = ~index_type{0};
+    std::atomic<uint64_t> free_head{no_slot};
+
+    /*
+     * Number of running processes is counted in shards to keep processes
+     * spawned and dying on different schedulers from contending for a
+     * single counter.
+     * A shard may go below zero if processes die on a different thread
+     * than they were spawned on; only the sum is meaningful.
+     */
+    static constexpr size_t counter_shards = 16;
+    struct alignas(64) Counter {
+        std::atomic<int64_t> value{0};
+    };
+    Counter running[counter_shards];
+    auto counter() -> Counter&;
+
+    auto slot_at(index_type const) const -> Slot*;
+    auto take_free_slot() -> index_type;
+    auto put_free_slot(index_type const) -> void;
+    auto release(index_type const) -> void;
+
+  public:
+    /*
+     * Allocates a slot for a new process.
+     * The slot is held by the process until it is retired.
+     */
+    auto allocate() -> viua::process::PID;
+    auto retire(viua::process::PID const) -> void;
+
+    /*
+     * Makes the result of a process available to a joining process.
+     * Joinable slots are held until the process is detached (which also
+     * happens when its result is transferred).
+     */
+    auto make_joinable(viua::process::PID const) -> void;
+    auto detach(viua::process::PID const) -> void;
+
+    /*
+     * Returns slot of the process, or null if the PID is stale.
+     */
+    auto find(viua::process::PID const) const -> Slot*;
+
+    auto size() const -> viua::internals::types::processes_count;
+
+    Process_table();
+    ~Process_table();
+};
+
 class Kernel {
 #ifdef AS_DEBUG_HEADER
   public:
@@ -143,6 +272,16 @@ class Kernel {
     std::map<std::string, viua::internals::types::bytecode_size>
         block_addresses;
 
+    /*  Function names mapped to identifiers assigned as the functions are
+     *  loaded (from the executable and from linked modules).
+     *  Identifiers are dense so per-function data can be kept in vectors.
+     *  Modules may be linked at runtime (by the import instruction) while
+     *  schedulers look identifiers up so the map is guarded by a mutex.
+     */
+    std::map<std::string, viua::internals::types::function_id> function_ids;
+    mutable std::mutex function_ids_mutex;
+    auto assign_function_id(std::string const&) -> void;
+
     std::map<std::string, std::pair<std::string, viua::internals::types::byte*>>
         linked_functions;
     std::map<std::string, std::pair<std::string, viua::internals::types::byte*>>
@@ -165,9 +304,15 @@ class Kernel {
      *  its own process back).
      *
      *  Also, a list of spawned VP schedulers.
+     *
+     *  When schedulers are pinned to CPUs there is a list of free processes
+     *  for every NUMA node, and schedulers prefer adopting processes from
+     *  their own node.
+     *  Otherwise, there is only one list.
      */
-    // list of virtual processes not associated with any VP scheduler
-    std::vector<std::unique_ptr<viua::process::Process>> free_virtual_processes;
+    // lists of virtual processes not associated with any VP scheduler
+    std::vector<std::vector<std::unique_ptr<viua::process::Process>>>
+        free_virtual_processes;
     std::mutex free_virtual_processes_mutex;
     std::condition_variable free_virtual_processes_cv;
     // list of running VP schedulers, pairs of {scheduler-pointer, thread}
@@ -178,8 +323,6 @@ class Kernel {
     std::vector<viua::scheduler::VirtualProcessScheduler*>
         idle_virtual_process_schedulers;
 
-    std::atomic<viua::internals::types::processes_count> running_processes{0};
-
     static const viua::internals::types::schedulers_count
         default_vp_schedulers_limit = 2;
     viua::internals::types::schedulers_count vp_schedulers_limit;
@@ -205,19 +348,50 @@ class Kernel {
     viua::internals::types::schedulers_count ffi_schedulers_limit;
     std::vector<std::unique_ptr<std::thread>> foreign_call_workers;
 
-    std::vector<void*> cxx_dynamic_lib_handles;
+    /*
+     * Whether VP and FFI schedulers are pinned to CPUs, and the topology
+     * used to place them.
+     */
+    bool pin_schedulers;
+    viua::scheduler::Topology topology;
 
-    std::map<viua::process::PID, Mailbox> mailboxes;
-    std::mutex mailbox_mutex;
+    std::vector<void*> cxx_dynamic_lib_handles;
 
     /*
-     * Only processes that were not disowned have an entry here.
+     * Mailboxes and results of processes.
+     * Only processes that were not disowned have a joinable slot.
      * Result of a process may be fetched only once - it is then deleted.
      * It must also be deleted when no process would be able to fetch it to
      * prevent return value leaks.
      */
-    std::map<viua::process::PID, ProcessResult> process_results;
-    mutable std::mutex process_results_mutex;
+    Process_table process_table;
+
+    /*
+     * Path to which the profile of the program is written when the kernel
+     * finishes running (empty if profiling is disabled).
+     * Counters of processes are merged here as the processes die.
+     */
+    std::string profile_output;
+    Raw_profile collected_profile;
+    std::mutex collected_profile_mutex;
+
+    auto resolve_profile() const -> Profile;
+    auto write_profile() const -> void;
+
+    /*
+     * Number of calls after which a function is compiled by the baseline
+     * compiler (zero if the baseline compiler is disabled).
+     * Compiled code is shared by all processes.
+     */
+    static uint64_t const default_baseline_threshold = 64;
+    uint64_t baseline_threshold;
+    std::map<std::string, std::unique_ptr<viua::process::Baseline_function>>
+        baseline_functions;
+    std::mutex baseline_functions_mutex;
+
+    auto code_extent_of(std::string const&) const
+        -> std::pair<viua::internals::types::byte*,
+                     viua::internals::types::byte*>;
 
   public:
     /*  Methods dealing with dynamic library loading.
@@ -256,6 +430,10 @@ class Kernel {
     bool is_local_function(const std::string&) const;
     bool is_linked_function(const std::string&) const;
     bool is_native_function(const std::string&) const;
+    /*  Throws if given name is not a name of a native function.
+     */
+    auto function_id_of(std::string const&) const
+        -> viua::internals::types::function_id;
     bool is_foreign_method(const std::string&) const;
     bool is_foreign_function(const std::string&) const;
 
@@ -288,12 +466,13 @@ class Kernel {
                                      viua::kernel::RegisterSet*,
                                      viua::process::Process*);
 
-    void post_free_process(std::unique_ptr<viua::process::Process>);
+    /*  Posts a process to the list of free processes of given NUMA node.
+     */
+    void post_free_process(std::unique_ptr<viua::process::Process>,
+                           viua::scheduler::Topology::node_type const);
 
-    auto create_mailbox(const viua::process::PID)
-        -> viua::internals::types::processes_count;
-    auto delete_mailbox(const viua::process::PID)
-        -> viua::internals::types::processes_count;
+    auto create_process_slot() -> viua::process::PID;
+    auto delete_process_slot(const viua::process::PID) -> void;
 
     auto create_result_slot_for(viua::process::PID) -> void;
     auto detach_process(const viua::process::PID) -> void;
@@ -307,8 +486,24 @@ class Kernel {
         -> std::unique_ptr<viua::types::Value>;
 
     void send(const viua::process::PID, std::unique_ptr<viua::types::Value>);
+
+    /*
+     * Sends a batch of messages to a process.
+     * The batch lands in the mailbox at once so messages sent to the same
+     * process concurrently never end up between messages of the batch.
+     */
+    void send(const viua::process::PID,
+              std::vector<std::unique_ptr<viua::types::Value>>);
+
+    /*
+     * Sends a copy of the message to every process.
+     * Unknown processes are skipped, just as with plain sends.
+     */
+    void broadcast(std::vector<viua::process::PID> const&,
+                   std::unique_ptr<viua::types::Value>);
     void receive(const viua::process::PID,
-                 std::queue<std::unique_ptr<viua::types::Value>>&);
+                 std::deque<std::unique_ptr<viua::types::Value>>&,
+                 viua::process::Process* = nullptr);
     uint64_t pids() const;
 
     auto static no_of_vp_schedulers()
@@ -316,6 +511,21 @@ class Kernel {
     auto static no_of_ffi_schedulers()
         -> viua::internals::types::schedulers_count;
     auto static is_tracing_enabled() -> bool;
+    auto static is_pinning_enabled() -> bool;
+    auto static profile_output_path() -> std::string;
+    auto static scheduler_statistics_path() -> std::string;
+
+    auto is_profiling_enabled() const -> bool;
+
+    auto static baseline_compiler_threshold() -> uint64_t;
+    auto baseline_compilation_threshold() const -> uint64_t;
+    auto compile_baseline(std::string const&)
+        -> viua::process::Baseline_function const*;
+    /*  Returns null if the function has not been compiled yet.
+     */
+    auto compiled_baseline_of(std::string const&)
+        -> viua::process::Baseline_function const*;
+    auto record_profile_of(viua::process::Process const*) -> void;
 
     int run();
 
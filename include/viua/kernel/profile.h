@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_KERNEL_PROFILE_H
+#define VIUA_KERNEL_PROFILE_H
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <viua/bytecode/bytetypedef.h>
+
+
+namespace viua { namespace kernel {
+using profile_counter_type = uint64_t;
+
+/*
+ * Counters gathered by a single process while it runs.
+ * Branches and loops are keyed by raw addresses of instructions since
+ * resolving them to names of invocables in the hot path would be too
+ * expensive; this is done only once, when the profile is written.
+ */
+class Raw_profile {
+  public:
+    using address_type = viua::internals::types::byte const*;
+
+    std::map<std::string, profile_counter_type> calls;
+    std::map<address_type,
+             std::pair<profile_counter_type, profile_counter_type>>
+        branches;
+    std::map<address_type, profile_counter_type> jumps;
+    std::map<address_type, profile_counter_type> loops;
+    std::map<std::pair<std::string, std::string>, profile_counter_type>
+        messages;
+
+    auto call(std::string const&) -> void;
+    /*
+     * Records execution of an "if" instruction at given address, and
+     * whether the branch was taken (i.e. the condition was true).
+     */
+    auto branch(address_type const, bool const) -> void;
+    /*
+     * Records execution of a "jump" instruction.
+     */
+    auto jump(address_type const) -> void;
+    /*
+     * Records a transfer of control to given address from an instruction
+     * placed after it (i.e. another iteration of a loop).
+     */
+    auto loop(address_type const) -> void;
+    auto message(std::string const&, std::string const&) -> void;
+
+    auto merge(Raw_profile const&) -> void;
+};
+
+/*
+ * Profile of a whole program, with addresses resolved to names of
+ * invocables and offsets from their beginnings.
+ * This is what the kernel writes on exit and what the assembler reads when
+ * given "--profile-use" option.
+ *
+ * The text format is line-based, one counter per line:
+ *
+ *      call <invocable> <count>
+ *      branch <invocable> <offset> <taken> <not-taken>
+ *      jump <invocable> <offset> <count>
+ *      loop <invocable> <offset> <count>
+ *      msg <method> <receiver-type> <count>
+ */
+class Profile {
+  public:
+    using location_type =
+        std::pair<std::string, viua::internals::types::bytecode_size>;
+
+    std::map<std::string, profile_counter_type> calls;
+    std::map<location_type,
+             std::pair<profile_counter_type, profile_counter_type>>
+        branches;
+    std::map<location_type, profile_counter_type> jumps;
+    std::map<location_type, profile_counter_type> loops;
+    std::map<std::pair<std::string, std::string>, profile_counter_type>
+        messages;
+
+    auto calls_of(std::string const&) const -> profile_counter_type;
+    auto total_calls() const -> profile_counter_type;
+
+    auto write(std::ostream&) const -> void;
+    /*
+     * Throws std::string describing the problem if the profile is malformed.
+     */
+    auto static read(std::istream&) -> Profile;
+};
+}}  // namespace viua::kernel
+
+
+#endif
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 #include <vector>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/types/value.h>
@@ -33,16 +34,50 @@ typedef uint8_t mask_type;
 enum REGISTER_MASKS : mask_type {
     COPY_ON_WRITE = (1 << 0),
     MOVED         = (1 << 1),  // marks registers containing moved parameters
+    /*
+     * Marks registers containing references (e.g. to captured objects).
+     * Writes to such registers rebind the reference instead of replacing it.
+     * The flag is maintained by the register itself and describes its
+     * contents, so clearing masks of a register does not clear it.
+     */
+    REFERENCE = (1 << 2),
 };
 
 
+namespace viua { namespace types {
+class Reference;
+}}  // namespace viua::types
+
 namespace viua { namespace kernel {
 class Register {
     std::unique_ptr<viua::types::Value> value;
     mask_type mask;
 
+    /*
+     * The second parameter tells whether the stored value is a reference.
+     * It is only consulted if the register does not already hold one, in
+     * which case the reference is rebound.
+     */
+    void store(std::unique_ptr<viua::types::Value>, bool const);
+
   public:
+    /*
+     * Writes a value of statically unknown type.
+     * This requires a check of the value's dynamic type, but the check is
+     * cheaper than dynamic_cast<> as references have no subclasses.
+     */
     void reset(std::unique_ptr<viua::types::Value>);
+
+    /*
+     * Writes a value of statically known type (e.g. a freshly created
+     * result of an instruction).
+     * Whether the value is a reference is decided at compile time so plain
+     * writes only have to check the mask of the register.
+     */
+    template<typename T> void reset(std::unique_ptr<T> o) {
+        store(std::move(o), std::is_same<T, viua::types::Reference>::value);
+    }
+
     bool empty() const;
 
     viua::types::Value* get();
@@ -64,6 +99,11 @@ class Register {
     operator bool() const;
     auto operator=(Register &&) -> Register&;
     auto operator=(decltype(value)&&) -> Register&;
+    template<typename T> auto operator=(std::unique_ptr<T>&& o) -> Register& {
+        reset(std::move(o));
+        mask = static_cast<mask_type>(mask & REFERENCE);
+        return *this;
+    }
 };
 
 class RegisterSet {
@@ -100,10 +140,22 @@ class RegisterSet {
     mask_type getmask(viua::internals::types::register_index);
 
     void drop();
+    /*
+     * Deletes values held in all registers, and resizes the set.
+     * Storage of the set is reused so resizing it within its capacity does
+     * not allocate.
+     */
+    auto reset(viua::internals::types::register_index) -> void;
     inline viua::internals::types::register_index size() {
         return registerset_size;
     }
 
+    /*
+     * Returns true if any register in the set holds the given value, or a
+     * value containing it.
+     */
+    auto reaches(viua::types::Value const*) -> bool;
+
     std::unique_ptr<RegisterSet> copy();
 
     RegisterSet(viua::internals::types::register_index sz);
@@ -22,25 +22,38 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 
 namespace viua { namespace process {
-class Process;
-
+/*
+ * PIDs are generational indexes into the process table of the kernel.
+ *
+ * The index selects a slot in the table, and the generation tells which of
+ * the processes that have ever used the slot the PID refers to.
+ * Slots are reused, but every reuse bumps the generation so a PID of a
+ * process that is gone never aliases a PID of a process that is running.
+ */
 class PID {
-    const viua::process::Process* associated_process;
+  public:
+    using index_type      = uint32_t;
+    using generation_type = uint32_t;
+
+  private:
+    index_type slot_index;
+    generation_type slot_generation;
 
   public:
     bool operator==(const viua::process::PID&) const;
-    bool operator==(const viua::process::Process*) const;
     bool operator<(const viua::process::PID&) const;
     bool operator>(const viua::process::PID&) const;
 
-    auto get() const -> decltype(associated_process);
+    auto index() const -> index_type;
+    auto generation() const -> generation_type;
     auto str() const -> std::string;
 
-    PID(const viua::process::Process*);
+    PID(index_type const, generation_type const);
 };
 }}  // namespace viua::process
 
@@ -24,17 +24,23 @@
 
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <stack>
 #include <string>
+#include <vector>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/include/module.h>
 #include <viua/kernel/frame.h>
+#include <viua/kernel/profile.h>
 #include <viua/kernel/registerset.h>
 #include <viua/kernel/tryframe.h>
 #include <viua/pid.h>
+#include <viua/process/baseline.h>
+#include <viua/process/priority.h>
+#include <viua/scheduler/timer_wheel.h>
 #include <viua/types/prototype.h>
 #include <viua/types/value.h>
 
@@ -66,14 +72,6 @@ class Stack {
          */
         RUNNING,
 
-        /*
-         * Stack is suspended because of deferred calls it triggered when
-         * returning from a call normally. The VM should finish executing any
-         * stacks spawned by this stack's deferred calls, and then return to
-         * continue executing this stack.
-         */
-        SUSPENDED_BY_DEFERRED_ON_FRAME_POP,
-
         /*
          * Stack is suspended until deferred calls triggered  by stack unwinding
          * have finished running.
@@ -93,6 +91,20 @@ class Stack {
     STATE current_state = STATE::UNINITIALISED;
 
   public:
+    /*
+     * Next stack in the list of stacks owned by the process.
+     */
+    std::unique_ptr<Stack> next;
+
+    /*
+     * Stack which resumed this one, and the register in which it expects
+     * the value yielded (or returned) by this stack.
+     * Only stacks of coroutines are resumed, and they have a resumer only
+     * while they are running.
+     */
+    Stack* resumer                          = nullptr;
+    viua::kernel::Register* resume_register = nullptr;
+
     const std::string entry_function;
     Process* parent_process;
 
@@ -102,6 +114,14 @@ class Stack {
     std::unique_ptr<Frame> frame_new;
     using size_type = decltype(frames)::size_type;
 
+    /*
+     * Frame left after a return or a tail call, reused by the next frame
+     * prepared on this stack so that calls (and loops written as tail
+     * recursion) do not allocate frames and register sets all the time.
+     */
+    std::unique_ptr<Frame> spare_frame;
+    auto recycle(std::unique_ptr<Frame>) -> void;
+
     std::vector<std::unique_ptr<TryFrame>> tryframes;
     std::unique_ptr<TryFrame> try_frame_new;
 
@@ -112,11 +132,9 @@ class Stack {
     std::unique_ptr<viua::types::Value> caught;
 
     /*
-     *  Currently used register, and
-     *  global register set of parent process.
+     *  Currently used register set of parent process.
      */
     viua::kernel::RegisterSet** currently_used_register_set;
-    viua::kernel::RegisterSet* global_register_set;
 
     /*  Variables set after the VM has executed bytecode.
      *  They describe exit conditions of the bytecode that just stopped running.
@@ -132,6 +150,11 @@ class Stack {
     auto find_catch_frame() -> std::tuple<TryFrame*, std::string>;
 
   public:
+    /*
+     * Sets aside the value returned by the function on top of the stack.
+     * Subsequent calls (i.e. when the function's deferred calls have
+     * returned) have no effect.
+     */
     auto set_return_value() -> void;
 
     auto state_of() const -> STATE;
@@ -139,7 +162,7 @@ class Stack {
 
     viua::scheduler::VirtualProcessScheduler* scheduler;
 
-    auto bind(viua::kernel::RegisterSet**, viua::kernel::RegisterSet*) -> void;
+    auto bind(viua::kernel::RegisterSet**) -> void;
 
     auto begin() const -> decltype(frames.begin());
     auto end() const -> decltype(frames.end());
@@ -147,13 +170,36 @@ class Stack {
     auto at(decltype(frames)::size_type i) const -> decltype(frames.at(i));
     auto back() const -> decltype(frames.back());
 
+    /*
+     * Deferred calls of frames popped during stack unwinding are run on
+     * separate stacks.
+     */
     auto register_deferred_calls_from(Frame*) -> void;
-    auto register_deferred_calls(const bool = true) -> void;
+    /*
+     * Deferred calls of functions that return normally (or tail call
+     * another function) are run on the same stack, one by one, in reverse
+     * order of deferring.
+     * Each of them returns to the given address, i.e. to the instruction
+     * which triggered it, which then starts the next deferred call.
+     * Deferred calls run outside of the try frames of the function that
+     * deferred them so the function cannot catch exceptions they throw.
+     * Returns entry point of the deferred call, or null if there are no
+     * more deferred calls to run.
+     */
+    auto run_next_deferred_call(viua::internals::types::byte*)
+        -> viua::internals::types::byte*;
     auto pop() -> std::unique_ptr<Frame>;
 
     auto size() const -> decltype(frames)::size_type;
     auto clear() -> void;
 
+    /*
+     * Returns true if the given value is held (directly or inside other
+     * values) by any frame of the stack, or is waiting to be thrown, caught,
+     * or returned.
+     */
+    auto reaches(viua::types::Value const*) const -> bool;
+
     auto emplace_back(std::unique_ptr<Frame> f)
         -> decltype(frames.emplace_back(f));
 
@@ -169,13 +215,12 @@ class Stack {
     Stack(std::string,
           Process*,
           viua::kernel::RegisterSet**,
-          viua::kernel::RegisterSet*,
           viua::scheduler::VirtualProcessScheduler*);
 
     static uint16_t const MAX_STACK_SIZE = 8192;
 };
 
-class Process {
+class Process : public viua::types::Value_owner {
 #ifdef AS_DEBUG_HEADER
   public:
 #endif
@@ -189,6 +234,25 @@ class Process {
     auto get_trace_line(viua::internals::types::byte*) const -> std::string;
     auto emit_trace_line(viua::internals::types::byte*) const -> void;
 
+    /*
+     * Counters of calls, branches, loops, and messages executed by the
+     * process.
+     * Null unless the kernel was asked to write a profile of the program.
+     */
+    std::unique_ptr<viua::kernel::Raw_profile> profile;
+
+    /*
+     * Number of calls to every function made by the process, and code
+     * produced for the function by the baseline compiler (once the function
+     * becomes hot enough).
+     * Indexed by function identifiers assigned by the kernel.
+     */
+    std::vector<std::pair<uint64_t, viua::process::Baseline_function const*>>
+        baseline_calls;
+    auto compiled_code_of(std::string const&)
+        -> viua::process::Baseline_function const*;
+    auto count_backward_jump() -> void;
+
     /*
      * Pointer to scheduler the process is currently bound to.
      * This is not constant because processes may migrate between
@@ -205,7 +269,12 @@ class Process {
     std::string watchdog_function{""};
     bool watchdog_failed{false};
 
+    /*
+     * Most processes never touch their global registers so the set is
+     * allocated on first access.
+     */
     std::unique_ptr<viua::kernel::RegisterSet> global_register_set;
+    auto global_registers() -> viua::kernel::RegisterSet*;
 
     /*
      * This pointer points different register sets during the process's
@@ -216,24 +285,42 @@ class Process {
      */
     viua::kernel::RegisterSet* currently_used_register_set;
 
-    // Static registers
-    std::map<std::string, std::unique_ptr<viua::kernel::RegisterSet>>
-        static_registers;
+    /*
+     * Static register sets, indexed by identifiers the kernel assigned to
+     * functions.
+     * Sets are created when a function first accesses its static registers.
+     */
+    std::vector<std::unique_ptr<viua::kernel::RegisterSet>> static_registers;
+
 
+    /*
+     * Call stacks of the process, kept in a list linked through
+     * Stack::next.
+     * One of them runs the function the process was spawned with, and the
+     * others run deferred calls during stack unwinding.
+     */
+    std::unique_ptr<Stack> stacks;
+    auto adopt(std::unique_ptr<Stack>) -> Stack*;
 
-    // Call stack
-    std::map<Stack*, std::unique_ptr<Stack>> stacks;
     Stack* stack;
     std::stack<Stack*> stacks_order;
 
-    std::queue<std::unique_ptr<viua::types::Value>> message_queue;
+    /*
+     * Messages taken from the mailbox but not yet received.
+     * Selective receive leaves messages it skipped here, in the order in
+     * which they arrived, and remembers how many of them it has already
+     * checked so that they are not matched against the same filter again
+     * when the process is woken up by a new message.
+     */
+    std::deque<std::unique_ptr<viua::types::Value>> message_queue;
+    decltype(message_queue)::size_type messages_scanned = 0;
 
     viua::types::Value* fetch(viua::internals::types::register_index) const;
     std::unique_ptr<viua::types::Value> pop(
         viua::internals::types::register_index);
     void place(viua::internals::types::register_index,
                std::unique_ptr<viua::types::Value>);
-    void ensure_static_registers(std::string);
+    auto static_registers_of(std::string const&) -> viua::kernel::RegisterSet*;
 
     /*  Methods dealing with stack and frame manipulation, and
      *  function calls.
@@ -267,12 +354,29 @@ class Process {
 
     auto push_deferred(std::string) -> void;
 
+    /*
+     * Passes a value to the stack which resumed the running coroutine (or
+     * empties the register the value was expected in if there is no value),
+     * and switches back to that stack.
+     */
+    auto leave_coroutine(std::unique_ptr<viua::types::Value>) -> void;
+
     std::atomic_bool finished;
     std::atomic_bool is_joinable;
     std::atomic_bool is_suspended;
     viua::internals::types::process_time_slice_type process_priority;
+    Priority_class process_priority_class;
     std::mutex process_mtx;
 
+    /*
+     * Time since which the process has been waiting in the run queue for
+     * its turn, i.e. the time at which it was woken up or at which its
+     * previous quantum ended.
+     * Processes are woken up by other processes (e.g. by sending messages to
+     * them) so the time is stored as an atomic count of clock ticks.
+     */
+    std::atomic<std::chrono::steady_clock::rep> waiting_in_run_queue_since;
+
     /*  viua::process::Process identifier.
      */
     viua::process::PID process_id;
@@ -280,11 +384,21 @@ class Process {
 
     /*  Timeouts for message passing, and
      *  multiprocessing.
+     *  The timer is kept in the timer wheel of the scheduler running the
+     *  process, and wakes the process up when it expires.
      */
-    std::chrono::steady_clock::time_point waiting_until;
+    viua::scheduler::Timer_wheel::Timer timeout_timer;
     bool timeout_active      = false;
     bool wait_until_infinity = false;
 
+    /*
+     * Starts waiting with given timeout (or forever if the timeout is zero)
+     * unless the process is already waiting.
+     */
+    auto start_waiting(viua::internals::types::timeout const) -> void;
+    auto stop_waiting() -> void;
+    auto timed_out() const -> bool;
+
     /*  Methods implementing individual instructions.
      */
     viua::internals::types::byte* opizero(viua::internals::types::byte*);
@@ -323,6 +437,7 @@ class Process {
     viua::internals::types::byte* optextconcat(viua::internals::types::byte*);
 
     viua::internals::types::byte* opvector(viua::internals::types::byte*);
+    viua::internals::types::byte* opvectorof(viua::internals::types::byte*);
     viua::internals::types::byte* opvinsert(viua::internals::types::byte*);
     viua::internals::types::byte* opvpush(viua::internals::types::byte*);
     viua::internals::types::byte* opvpop(viua::internals::types::byte*);
@@ -432,7 +547,16 @@ class Process {
     viua::internals::types::byte* opjoin(viua::internals::types::byte*);
     viua::internals::types::byte* opsend(viua::internals::types::byte*);
     viua::internals::types::byte* opreceive(viua::internals::types::byte*);
+    viua::internals::types::byte* opsendall(viua::internals::types::byte*);
+    viua::internals::types::byte* opbroadcast(viua::internals::types::byte*);
+    viua::internals::types::byte* opreceivemany(viua::internals::types::byte*);
+    viua::internals::types::byte* opreceivematch(viua::internals::types::byte*);
+    viua::internals::types::byte* opsleep(viua::internals::types::byte*);
+    viua::internals::types::byte* oppriority(viua::internals::types::byte*);
     viua::internals::types::byte* opwatchdog(viua::internals::types::byte*);
+    viua::internals::types::byte* opcoroutine(viua::internals::types::byte*);
+    viua::internals::types::byte* opresume(viua::internals::types::byte*);
+    viua::internals::types::byte* opyield(viua::internals::types::byte*);
     viua::internals::types::byte* opreturn(viua::internals::types::byte*);
 
     viua::internals::types::byte* opjump(viua::internals::types::byte*);
@@ -458,6 +582,18 @@ class Process {
     viua::internals::types::byte* opstructremove(viua::internals::types::byte*);
     viua::internals::types::byte* opstructkeys(viua::internals::types::byte*);
 
+    viua::internals::types::byte* ophashmap(viua::internals::types::byte*);
+    viua::internals::types::byte* ophashmapinsert(
+        viua::internals::types::byte*);
+    viua::internals::types::byte* ophashmapremove(
+        viua::internals::types::byte*);
+    viua::internals::types::byte* ophashmaplookup(
+        viua::internals::types::byte*);
+    viua::internals::types::byte* ophashmapcontains(
+        viua::internals::types::byte*);
+    viua::internals::types::byte* ophashmapkeys(viua::internals::types::byte*);
+    viua::internals::types::byte* ophashmapsize(viua::internals::types::byte*);
+
     viua::internals::types::byte* opnew(viua::internals::types::byte*);
     viua::internals::types::byte* opmsg(viua::internals::types::byte*);
     viua::internals::types::byte* opinsert(viua::internals::types::byte*);
@@ -493,6 +629,12 @@ class Process {
     auto priority() const -> decltype(process_priority);
     void priority(decltype(process_priority) p);
 
+    auto priority_class() const -> Priority_class;
+    auto priority_class(Priority_class const) -> void;
+
+    auto ready_since() const -> std::chrono::steady_clock::time_point;
+    auto ready_since(std::chrono::steady_clock::time_point const) -> void;
+
     bool stopped() const;
 
     bool terminated() const;
@@ -521,12 +663,29 @@ class Process {
 
     bool empty() const;
 
+    /*
+     * Returns true if the given value is held by the process (directly, or
+     * inside other values).
+     * Used to verify pointers taken before the process gave some of its
+     * values away.
+     */
+    auto owns(viua::types::Value const*) const -> bool override;
+
+    auto collected_profile() const -> viua::kernel::Raw_profile const*;
+
     Process(std::unique_ptr<Frame>,
             viua::scheduler::VirtualProcessScheduler*,
             viua::process::Process*,
             const bool = false);
     ~Process();
 
+    /*
+     * Memory of dead processes is pooled by the schedulers that destroyed
+     * them, and reused for processes these schedulers spawn later.
+     */
+    static void* operator new(std::size_t);
+    static void operator delete(void*, std::size_t);
+
     static viua::internals::types::register_index const DEFAULT_REGISTER_SIZE =
         255;
 };
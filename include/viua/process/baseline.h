@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_PROCESS_BASELINE_H
+#define VIUA_PROCESS_BASELINE_H
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <viua/bytecode/bytetypedef.h>
+
+
+namespace viua { namespace process {
+class Process;
+
+/*
+ * Second execution tier for hot functions.
+ *
+ * The baseline compiler decodes a function once and produces a table of
+ * instructions with pre-decoded operands and pre-computed jump targets, and
+ * with handlers specialised for the common case (e.g. integer arithmetic on
+ * plain local registers).
+ * Every compiled instruction still executes as a single tick of the process
+ * so preemption points do not change.
+ *
+ * Handlers never throw on their own and never have side effects before they
+ * are sure they can handle the instruction.
+ * Whenever they cannot (e.g. because an operand is a reference, a pointer, or
+ * has an unexpected type) they decline and the instruction is executed by the
+ * interpreter, which produces exactly the same results and exceptions as it
+ * would without the baseline tier.
+ */
+class Baseline_function {
+  public:
+    using address_type = viua::internals::types::byte*;
+
+    struct Instruction {
+        using handler_type = auto (*)(Process*, Instruction const&)
+            -> address_type;
+
+        handler_type handler = nullptr;
+        address_type next    = nullptr;
+        address_type target  = nullptr;
+        address_type alternative_target = nullptr;
+        viua::internals::types::register_index operands[3]{0, 0, 0};
+        viua::internals::RegisterSets register_sets[3]{
+            viua::internals::RegisterSets::LOCAL,
+            viua::internals::RegisterSets::LOCAL,
+            viua::internals::RegisterSets::LOCAL,
+        };
+        int64_t immediate = 0;
+    };
+
+  private:
+    address_type const entry;
+    address_type const end;
+
+    /*
+     * Indexed by the offset of an instruction from the entry point of the
+     * function.
+     * Offsets at which no instruction begins, and instructions for which
+     * there is no specialised handler, have a null handler.
+     */
+    std::vector<Instruction> instructions;
+
+  public:
+    /*
+     * Returns address of the next instruction to execute, or null if the
+     * instruction at given address must be executed by the interpreter.
+     */
+    inline auto execute(Process* process, address_type const at) const
+        -> address_type {
+        if (at < entry or at >= end) {
+            return nullptr;
+        }
+        auto const& instruction =
+            instructions[static_cast<std::vector<Instruction>::size_type>(
+                at - entry)];
+        return (instruction.handler ? instruction.handler(process, instruction)
+                                    : nullptr);
+    }
+
+    auto compiled_instructions() const -> std::vector<Instruction>::size_type;
+
+    /*
+     * Takes the entry point of the function, the address at which its code
+     * ends, and the jump base of the module containing it.
+     */
+    Baseline_function(address_type const,
+                      address_type const,
+                      address_type const);
+};
+}}  // namespace viua::process
+
+
+#endif
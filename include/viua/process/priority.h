@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_PROCESS_PRIORITY_H
+#define VIUA_PROCESS_PRIORITY_H
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+namespace viua { namespace process {
+/*
+ * Priority classes of processes.
+ *
+ * Every scheduler keeps a separate run queue for each class:
+ *
+ *  - realtime processes are run first in every burst so they wait at most
+ *    a single burst for the processor
+ *  - normal processes are run in every burst
+ *  - batch processes are run in one of every few bursts while there are
+ *    runnable normal processes, and in every burst otherwise
+ */
+enum class Priority_class : uint8_t {
+    REALTIME,
+    NORMAL,
+    BATCH,
+};
+inline constexpr auto priority_classes = std::size_t{3};
+
+/*
+ * Names of priority classes, as used by the "priority" instruction.
+ * Throws viua::types::Exception for unknown names.
+ */
+auto priority_class_of(std::string const&) -> Priority_class;
+auto to_string(Priority_class const) -> std::string;
+
+/*
+ * Time processes of a single priority class spent waiting in the run queue
+ * between becoming runnable and getting the processor.
+ */
+struct Run_queue_latency {
+    uint64_t quanta = 0;
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds max{0};
+
+    inline auto record(std::chrono::nanoseconds const latency) -> void {
+        ++quanta;
+        total += latency;
+        max = std::max(max, latency);
+    }
+    inline auto merge(Run_queue_latency const& other) -> void {
+        quanta += other.quanta;
+        total += other.total;
+        max = std::max(max, other.max);
+    }
+    inline auto mean() const -> std::chrono::nanoseconds {
+        using rep = std::chrono::nanoseconds::rep;
+        return (quanta ? (total / static_cast<rep>(quanta))
+                       : std::chrono::nanoseconds{0});
+    }
+};
+}}  // namespace viua::process
+
+
+#endif
@@ -101,6 +101,7 @@ class Program {
     Program& optextconcat(int_op, int_op, int_op);
 
     Program& opvector(int_op, int_op, int_op);
+    Program& opvectorof(int_op, std::string const&);
     Program& opvinsert(int_op, int_op, int_op);
     Program& opvpush(int_op, int_op);
     Program& opvpop(int_op, int_op, int_op);
@@ -197,7 +198,16 @@ class Program {
     Program& opjoin(int_op, int_op, timeout_op);
     Program& opsend(int_op, int_op);
     Program& opreceive(int_op, timeout_op);
+    Program& opsendall(int_op, int_op);
+    Program& opbroadcast(int_op, int_op);
+    Program& opreceivemany(int_op, int_op);
+    Program& opreceivematch(int_op, int_op, timeout_op);
+    Program& opsleep(int_op);
+    Program& oppriority(int_op);
     Program& opwatchdog(const std::string&);
+    Program& opcoroutine(int_op, const std::string&);
+    Program& opresume(int_op, int_op);
+    Program& opyield(int_op);
     Program& opjump(viua::internals::types::bytecode_size, enum JUMPTYPE);
     Program& opif(int_op,
                   viua::internals::types::bytecode_size,
@@ -227,6 +237,14 @@ class Program {
     Program& opstructremove(int_op, int_op, int_op);
     Program& opstructkeys(int_op, int_op);
 
+    Program& ophashmap(int_op);
+    Program& ophashmapinsert(int_op, int_op, int_op);
+    Program& ophashmapremove(int_op, int_op, int_op);
+    Program& ophashmaplookup(int_op, int_op, int_op);
+    Program& ophashmapcontains(int_op, int_op, int_op);
+    Program& ophashmapkeys(int_op, int_op);
+    Program& ophashmapsize(int_op, int_op);
+
     Program& opnew(int_op, const std::string&);
     Program& opmsg(int_op, const std::string&);
     Program& opmsg(int_op, int_op);
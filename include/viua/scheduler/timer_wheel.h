@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_TIMER_WHEEL_H
+#define VIUA_SCHEDULER_TIMER_WHEEL_H
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+
+namespace viua {
+namespace process {
+class Process;
+}
+}  // namespace viua
+
+
+namespace viua { namespace scheduler {
+/*
+ * Hierarchical timer wheel holding deadlines of processes run by a single
+ * scheduler (timeouts of receives and joins, and sleeps).
+ *
+ * Time is measured in ticks of one millisecond.
+ * The lowest level has a slot for each of the next 64 ticks, and every level
+ * above it has slots 64 times as wide as the one below.
+ * When time enters the range of a slot on a higher level its timers are
+ * moved to lower levels so scheduling, cancelling, and expiring a timer all
+ * take constant time regardless of how many timers are pending.
+ *
+ * The wheel is not synchronised; it must only be used by the thread of the
+ * scheduler owning it.
+ */
+class Timer_wheel {
+  public:
+    using clock_type = std::chrono::steady_clock;
+    using tick_type  = uint64_t;
+
+    /*
+     * A timer is embedded in the object waiting for it so pending timers
+     * are kept in intrusive lists and the wheel never allocates.
+     */
+    class Timer {
+        friend class Timer_wheel;
+
+        /*
+         * The link is the pointer pointing to this timer (either a slot of
+         * the wheel, or the next pointer of the previous timer in the slot)
+         * so a timer can be unlinked without knowing in which slot it is.
+         */
+        Timer** link       = nullptr;
+        Timer* next        = nullptr;
+        Timer_wheel* wheel = nullptr;
+        tick_type deadline = 0;
+        bool fired         = false;
+        viua::process::Process* const process;
+
+      public:
+        /*
+         * Returns true if the timer has been scheduled and has not expired
+         * or been cancelled yet.
+         */
+        auto armed() const -> bool;
+
+        /*
+         * Returns true if the timer expired since it was last scheduled.
+         */
+        auto expired() const -> bool;
+
+        auto cancel() -> void;
+
+        /*
+         * Process given to a timer is woken up when the timer expires.
+         */
+        Timer(viua::process::Process*);
+        Timer(Timer const&) = delete;
+        auto operator=(Timer const&) -> Timer& = delete;
+        ~Timer();
+    };
+
+  private:
+    static constexpr unsigned slot_bits = 6;
+    static constexpr tick_type slots    = (tick_type{1} << slot_bits);
+    static constexpr unsigned levels    = 4;
+
+    std::array<Timer*, (slots * levels)> wheel;
+    clock_type::time_point const origin;
+    tick_type current = 0;
+    uint64_t pending  = 0;
+
+    auto tick_of(clock_type::time_point const) const -> tick_type;
+    auto place(Timer&) -> void;
+    auto unlink(Timer&) -> void;
+    auto cascade(unsigned const) -> void;
+
+  public:
+    /*
+     * Schedules the timer to expire after given time.
+     * A timer that is already armed is rescheduled.
+     */
+    auto schedule(Timer&, std::chrono::milliseconds const) -> void;
+
+    /*
+     * Moves the wheel forward to given time, expiring all timers whose
+     * deadlines have passed and waking up their processes.
+     */
+    auto advance(clock_type::time_point const) -> void;
+
+    auto empty() const -> bool;
+
+    Timer_wheel();
+    Timer_wheel(Timer_wheel const&) = delete;
+    auto operator=(Timer_wheel const&) -> Timer_wheel& = delete;
+    ~Timer_wheel();
+};
+}}  // namespace viua::scheduler
+
+
+#endif
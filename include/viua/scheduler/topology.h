@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_SCHEDULER_TOPOLOGY_H
+#define VIUA_SCHEDULER_TOPOLOGY_H
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace viua { namespace scheduler {
+/*
+ * Layout of CPUs and NUMA nodes of the machine the VM runs on.
+ *
+ * The topology is read from /sys.
+ * If it cannot be read the machine is assumed to have a single node with as
+ * many CPUs as the standard library reports.
+ */
+class Topology {
+  public:
+    using cpu_type  = unsigned;
+    using node_type = std::vector<std::vector<cpu_type>>::size_type;
+
+  private:
+    /*
+     * CPUs of every node.
+     * Nodes without CPUs (e.g. memory-only ones) are not included.
+     */
+    std::vector<std::vector<cpu_type>> cpus;
+
+  public:
+    auto nodes() const -> node_type;
+    auto cpus_of(node_type const) const -> std::vector<cpu_type> const&;
+
+    /*
+     * Returns the node and the CPU on which n-th scheduler should run.
+     * Schedulers are spread over nodes in a round-robin fashion so that
+     * every node gets its share of them, and over CPUs of every node in the
+     * same way.
+     */
+    auto placement_of(uint64_t const) const -> std::pair<node_type, cpu_type>;
+
+    /*
+     * Parses CPU lists in the format used by Linux (e.g. "0-3,8,10-11").
+     * Throws std::string describing the problem if the list is malformed.
+     */
+    auto static parse_cpu_list(std::string const&) -> std::vector<cpu_type>;
+    auto static discover() -> Topology;
+
+    Topology() = default;
+    Topology(std::vector<std::vector<cpu_type>>);
+};
+
+/*
+ * Restricts the calling thread to run only on given CPU.
+ * Returns false if the operating system refused to do this.
+ */
+auto pin(Topology::cpu_type const) -> bool;
+}}  // namespace viua::scheduler
+
+
+#endif
@@ -20,7 +20,10 @@
 #ifndef VIUA_SCHEDULER_VPS_H
 #define VIUA_SCHEDULER_VPS_H
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -30,6 +33,9 @@
 #include <vector>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/kernel/frame.h>
+#include <viua/process/priority.h>
+#include <viua/scheduler/timer_wheel.h>
+#include <viua/scheduler/topology.h>
 
 
 namespace viua {
@@ -55,22 +61,57 @@ class VirtualProcessScheduler {
      */
     const bool tracing_enabled;
 
-    std::vector<std::unique_ptr<viua::process::Process>>* free_processes;
+    /*
+     * Lists of free processes, one per NUMA node.
+     * Schedulers post processes to, and adopt them from, lists of their own
+     * nodes; they steal processes from other nodes only if there are no
+     * free processes on their own node.
+     */
+    std::vector<std::vector<std::unique_ptr<viua::process::Process>>>*
+        free_processes;
     std::mutex* free_processes_mutex;
     std::condition_variable* free_processes_cv;
+    Topology::node_type numa_node;
+
+    auto there_are_free_processes() const -> bool;
+    auto take_free_process() -> std::unique_ptr<viua::process::Process>;
 
     viua::process::Process* main_process;
-    std::vector<std::unique_ptr<viua::process::Process>> processes;
-    decltype(processes)::size_type current_process_index;
+
+    /*
+     * Run queues, one per priority class (indexed by the class).
+     */
+    using process_list = std::vector<std::unique_ptr<viua::process::Process>>;
+    std::array<process_list, viua::process::priority_classes> run_queues;
+    process_list::size_type current_process_index;
+
+    auto run_queue_of(viua::process::Priority_class const) -> process_list&;
+    auto enqueue(std::unique_ptr<viua::process::Process>) -> void;
+
+    /*
+     * Batch processes get a burst only once every this many bursts while
+     * there are normal processes to run.
+     */
+    static constexpr uint64_t batch_burst_period = 4;
+    uint64_t bursts;
+
+    std::array<viua::process::Run_queue_latency,
+               viua::process::priority_classes>
+        latency;
 
     int exit_code;
 
     // if scheduler hits heavy load it starts posting processes to
     // viua::kernel::Kernel to let other schedulers at them
-    decltype(processes)::size_type current_load;
+    process_list::size_type current_load;
     std::atomic_bool shut_down;
     std::thread scheduler_thread;
 
+    /*
+     * Deadlines of processes run by this scheduler.
+     */
+    Timer_wheel timers;
+
   public:
     viua::kernel::Kernel* kernel() const;
 
@@ -107,18 +148,26 @@ class VirtualProcessScheduler {
 
     void load_module(std::string);
 
-    auto cpi() const -> decltype(processes)::size_type;
-    auto size() const -> decltype(processes)::size_type;
+    auto cpi() const -> process_list::size_type;
+    auto size() const -> process_list::size_type;
 
-    viua::process::Process* process(decltype(processes)::size_type);
+    viua::process::Process* process(process_list::size_type);
     viua::process::Process* process();
     viua::process::Process* spawn(std::unique_ptr<Frame>,
                                   viua::process::Process*,
                                   bool);
 
     void send(const viua::process::PID, std::unique_ptr<viua::types::Value>);
+    void send(const viua::process::PID,
+              std::vector<std::unique_ptr<viua::types::Value>>);
+    void broadcast(std::vector<viua::process::PID> const&,
+                   std::unique_ptr<viua::types::Value>);
     void receive(const viua::process::PID,
-                 std::queue<std::unique_ptr<viua::types::Value>>&);
+                 std::deque<std::unique_ptr<viua::types::Value>>&,
+                 viua::process::Process* = nullptr);
+
+    auto schedule_timer(Timer_wheel::Timer&, std::chrono::milliseconds const)
+        -> void;
 
     auto is_joinable(const viua::process::PID) const -> bool;
     auto is_stopped(const viua::process::PID) const -> bool;
@@ -132,19 +181,27 @@ class VirtualProcessScheduler {
                        viua::internals::types::process_time_slice_type);
     bool burst();
 
+    auto run_queue_latency() const -> decltype(latency) const&;
+
     void operator()();
 
     void bootstrap(const std::vector<std::string>&);
     void launch();
+    /*
+     * Launches the scheduler on a thread that pins itself to given CPU
+     * before it runs any process.
+     */
+    void launch(Topology::cpu_type const);
     void shutdown();
     void join();
     int exit() const;
 
     VirtualProcessScheduler(
         viua::kernel::Kernel*,
-        std::vector<std::unique_ptr<viua::process::Process>>*,
+        std::vector<std::vector<std::unique_ptr<viua::process::Process>>>*,
         std::mutex*,
         std::condition_variable*,
+        Topology::node_type const,
         const bool = false);
     VirtualProcessScheduler(VirtualProcessScheduler&&);
     ~VirtualProcessScheduler();
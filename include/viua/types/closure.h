@@ -30,10 +30,25 @@
 
 
 namespace viua { namespace types {
+/*
+ * Register set of a closure is shared between copies of the closure, and
+ * copied only when one of them is about to modify it (i.e. when it is
+ * called, or when a value is captured into it).
+ * This makes copying a closure (e.g. when passing it as a parameter to a
+ * higher-order function) take constant time.
+ *
+ * Register sets are never shared between processes (closures are isolated
+ * before they are handed to another process) so the count of closures
+ * sharing a register set is only ever changed by a single thread.
+ */
 class Closure : public Function {
-    std::unique_ptr<viua::kernel::RegisterSet> local_register_set;
+    std::shared_ptr<viua::kernel::RegisterSet> local_register_set;
     std::string function_name;
 
+    auto unshare() -> void;
+
+    Closure(std::string const&, std::shared_ptr<viua::kernel::RegisterSet>);
+
   public:
     static const std::string type_name;
 
@@ -44,12 +59,23 @@ class Closure : public Function {
     bool boolean() const override;
 
     std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
 
     std::string name() const override;
-    viua::kernel::RegisterSet* rs() const;
-    auto release() -> viua::kernel::RegisterSet*;
+    /*
+     * Returns register set of the closure, copying it first if it is shared
+     * with other closures.
+     */
+    viua::kernel::RegisterSet* rs();
     auto give() -> std::unique_ptr<viua::kernel::RegisterSet>;
     auto empty() const -> bool;
+    /*
+     * Gives the closure a register set of its own, and replaces values
+     * captured by reference with the values themselves (nested closures are
+     * isolated too).
+     * Must be called before the closure is handed to another process.
+     */
+    auto isolate() -> void;
     void set(viua::internals::types::register_index,
              std::unique_ptr<viua::types::Value>);
 
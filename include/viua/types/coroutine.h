@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_TYPES_COROUTINE_H
+#define VIUA_TYPES_COROUTINE_H
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <viua/process.h>
+#include <viua/types/value.h>
+
+
+namespace viua { namespace types {
+class Coroutine : public Value {
+    /*
+     * Stack on which the coroutine runs.
+     * It is owned by the coroutine (and not by the process) so that a
+     * coroutine that is never resumed again is simply dropped together with
+     * its frames.
+     */
+    std::unique_ptr<viua::process::Stack> coroutine_stack;
+
+  public:
+    static const std::string type_name;
+
+    std::string type() const override;
+    std::string str() const override;
+    std::string repr() const override;
+    bool boolean() const override;
+    std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
+
+    /*
+     * A coroutine is finished once the function it runs has returned (or
+     * thrown an exception).
+     */
+    auto finished() const -> bool;
+    auto stack() const -> viua::process::Stack*;
+
+    Coroutine(std::unique_ptr<viua::process::Stack>);
+};
+}}  // namespace viua::types
+
+
+#endif
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_TYPES_HASH_MAP_H
+#define VIUA_TYPES_HASH_MAP_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <viua/types/value.h>
+
+
+namespace viua { namespace types {
+/*
+ * Associative container keyed by values of any hashable type: Integer,
+ * Float, Atom, String, Text, and Bits.
+ * Keys of different types are never equal (e.g. integer 1 and float 1.0 are
+ * different keys).
+ *
+ * The map is an open addressing hash table (in the style of Swiss tables).
+ * Every slot has a control byte saying whether the slot is empty, deleted,
+ * or full - and for full slots also holding 7 bits of the hash of the key.
+ * Control bytes are probed a group at a time so a single comparison
+ * (vectorised where the platform allows it) finds all candidate slots in a
+ * group, and keys are compared only for these.
+ */
+class Hash_map : public Value {
+  public:
+    using size_type    = std::vector<std::unique_ptr<Value>>::size_type;
+    using control_type = int8_t;
+
+  private:
+    std::vector<control_type> control;
+    std::vector<std::unique_ptr<Value>> slot_keys;
+    std::vector<std::unique_ptr<Value>> slot_values;
+    size_type used       = 0;
+    size_type tombstones = 0;
+
+    auto capacity() const -> size_type;
+    auto find(Value const&, uint64_t const) const -> size_type;
+    auto free_slot(uint64_t const) const -> size_type;
+    auto rehash(size_type const) -> void;
+
+  public:
+    static const std::string type_name;
+
+    std::string type() const override;
+    std::string str() const override;
+    std::string repr() const override;
+    bool boolean() const override;
+
+    std::vector<std::string> bases() const override;
+    std::vector<std::string> inheritancechain() const override;
+
+    /*
+     * Throw if the key is not of a hashable type.
+     */
+    static auto hash_of(Value const&) -> uint64_t;
+    static auto equal(Value const&, Value const&) -> bool;
+
+    /*
+     * Replaces the value if the key is already present.
+     */
+    auto insert(std::unique_ptr<Value>, std::unique_ptr<Value>) -> void;
+
+    /*
+     * Throws if the key is not present.
+     */
+    auto remove(Value const&) -> std::unique_ptr<Value>;
+
+    /*
+     * Returns the value stored at the key, or null if the key is not
+     * present.
+     */
+    auto at(Value const&) const -> Value*;
+
+    auto contains(Value const&) const -> bool;
+    auto keys() const -> std::vector<std::unique_ptr<Value>>;
+    auto size() const -> size_type;
+
+    std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
+
+    ~Hash_map() override = default;
+};
+}}  // namespace viua::types
+
+
+#endif
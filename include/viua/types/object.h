@@ -58,6 +58,7 @@ class Object : public Value {
     }
 
     virtual std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
 
     Object(const std::string& tn);
     virtual ~Object();
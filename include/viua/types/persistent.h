@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_TYPES_PERSISTENT_H
+#define VIUA_TYPES_PERSISTENT_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <viua/types/value.h>
+
+
+namespace viua { namespace types {
+/*
+ * Persistent containers.
+ *
+ * Nodes of persistent containers are immutable, and reference counted
+ * atomically so containers can be shared between processes (also ones run
+ * by different schedulers).
+ * Copying a persistent container takes constant time, so sending it to
+ * another process is cheap no matter how big it is.
+ * Updates do not modify the container but return its new version sharing
+ * all unchanged nodes with the old one.
+ *
+ * As elements are shared between processes they must be plain data:
+ * integers, floats, booleans, atoms, strings, texts, bits, or other
+ * persistent containers.
+ * Elements are only ever given out as copies.
+ */
+namespace persistent {
+/*
+ * Throws if the value cannot be stored in a persistent container.
+ */
+auto share(std::unique_ptr<Value>) -> std::shared_ptr<Value const>;
+}  // namespace persistent
+
+/*
+ * Vector implemented as a radix balanced tree with 32-way branching, with
+ * the last (possibly partial) leaf kept outside of the tree so that pushing
+ * and popping elements usually copies just that leaf.
+ * Access to an element takes log32(n) steps.
+ */
+class Persistent_vector : public Value {
+  public:
+    using size_type = uint64_t;
+    struct Node;
+
+  private:
+    size_type count = 0;
+    unsigned shift  = 5;
+    std::shared_ptr<Node const> root;
+    std::shared_ptr<Node const> tail;
+
+    auto tail_offset() const -> size_type;
+    auto leaf_for(size_type const) const -> std::shared_ptr<Node const> const&;
+
+  public:
+    static const std::string type_name;
+
+    std::string type() const override;
+    std::string str() const override;
+    std::string repr() const override;
+    bool boolean() const override;
+
+    std::vector<std::string> bases() const override;
+    std::vector<std::string> inheritancechain() const override;
+
+    auto size() const -> size_type;
+
+    /*
+     * Throw if the index is out of range.
+     */
+    auto at(size_type const) const -> std::unique_ptr<Value>;
+    auto set(size_type const, std::unique_ptr<Value>) const
+        -> std::unique_ptr<Persistent_vector>;
+
+    auto push(std::unique_ptr<Value>) const
+        -> std::unique_ptr<Persistent_vector>;
+    auto pop() const -> std::unique_ptr<Persistent_vector>;
+
+    std::unique_ptr<Value> copy() const override;
+
+    Persistent_vector();
+};
+
+/*
+ * Map implemented as a hash array mapped trie.
+ * Keys are hashed and compared in the same way as keys of hash maps.
+ * Each level of the trie consumes 5 bits of the hash of a key, and nodes
+ * store only their non-empty slots (described by a bitmap).
+ */
+class Persistent_map : public Value {
+  public:
+    using size_type = uint64_t;
+    struct Node;
+
+  private:
+    size_type count = 0;
+    std::shared_ptr<Node const> root;
+
+  public:
+    static const std::string type_name;
+
+    std::string type() const override;
+    std::string str() const override;
+    std::string repr() const override;
+    bool boolean() const override;
+
+    std::vector<std::string> bases() const override;
+    std::vector<std::string> inheritancechain() const override;
+
+    auto size() const -> size_type;
+
+    /*
+     * Returns a copy of the value stored at the key, or null if the key is
+     * not present.
+     */
+    auto at(Value const&) const -> std::unique_ptr<Value>;
+    auto contains(Value const&) const -> bool;
+    auto keys() const -> std::vector<std::unique_ptr<Value>>;
+
+    auto insert(std::unique_ptr<Value>, std::unique_ptr<Value>) const
+        -> std::unique_ptr<Persistent_map>;
+
+    /*
+     * Throws if the key is not present.
+     */
+    auto remove(Value const&) const -> std::unique_ptr<Persistent_map>;
+
+    std::unique_ptr<Value> copy() const override;
+};
+}}  // namespace viua::types
+
+
+#endif
@@ -22,6 +22,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <string>
 #include <vector>
 #include <viua/kernel/frame.h>
 #include <viua/types/value.h>
@@ -35,7 +38,15 @@ class Kernel;
 namespace types {
 class Pointer : public Value {
     Value* points_to;
-    bool valid;
+    std::shared_ptr<std::atomic_bool> target_alive;
+    std::string target_type;
+    /*
+     * Set to false once the pointer is known to have expired.
+     * A valid pointer may still turn out to be expired when it is verified
+     * (see verify()).
+     */
+    mutable bool valid;
+    mutable Value_owner::generation_type verified_in;
     /*
      *  Pointer of origin is a parallelism-safety token.
      *  Viua asserts that pointers can be dereferenced only
@@ -47,19 +58,21 @@ class Pointer : public Value {
      *  pointer should be illegal by definition (even if the access
      *  could be made safe).
      */
-    const viua::process::Process* process_of_origin;
+    const Value_owner* process_of_origin;
 
-    void attach();
-    void detach();
+    /*
+     * Checks if the pointed-to value is still alive and still belongs to the
+     * process of origin.
+     * Must only be called by the process of origin.
+     */
+    auto verify() const -> bool;
 
   public:
     static const std::string type_name;
 
-    void invalidate(Value* t);
     bool expired();
-    auto authenticate(const viua::process::Process*) -> void;
-    void reset(Value* t);
-    Value* to(const viua::process::Process*);
+    auto authenticate(const Value_owner*) -> void;
+    Value* to(const Value_owner*);
 
     virtual void expired(Frame*,
                          viua::kernel::RegisterSet*,
@@ -77,9 +90,8 @@ class Pointer : public Value {
 
     std::unique_ptr<Value> copy() const override;
 
-    Pointer(const viua::process::Process*);
-    Pointer(Value* t, const viua::process::Process*);
-    virtual ~Pointer();
+    Pointer(const Value_owner*);
+    Pointer(Value* t, const Value_owner*);
 };
 }  // namespace types
 }  // namespace viua
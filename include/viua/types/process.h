@@ -41,7 +41,6 @@ class Kernel;
 
 namespace viua { namespace types {
 class Process : public Value {
-    viua::process::Process* thrd;
     viua::process::PID saved_pid;
 
   public:
@@ -63,7 +62,7 @@ class Process : public Value {
      */
     viua::process::PID pid() const;
 
-    Process(viua::process::Process*);
+    Process(viua::process::PID const);
 };
 }}  // namespace viua::types
 
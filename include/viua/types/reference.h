@@ -46,8 +46,16 @@ class Reference : public Value {
     std::vector<std::string> inheritancechain() const override;
 
     std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
 
     virtual Value* points_to() const;
+
+    /*
+     * Returns the referred value if this is the last reference to it (the
+     * reference is left pointing to nothing), or a copy of the referred
+     * value otherwise.
+     */
+    auto take() -> std::unique_ptr<Value>;
     virtual void rebind(Value*);
     virtual void rebind(std::unique_ptr<Value>);
 
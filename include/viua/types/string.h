@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <viua/kernel/frame.h>
 #include <viua/kernel/registerset.h>
@@ -48,8 +49,26 @@ class String : public Value {
      *  Designed to hold strings of bytes.
      *  Strings of bytes do not neccessarily represent human-readable text.
      *  They may represent just "strings of bytes".
+     *
+     *  Strings are ropes.
+     *  Concatenation creates a node referring to both operands instead of
+     *  copying them, substrings are views into the buffer of the string they
+     *  were taken from, and copies share the rope with their original.
+     *  Ropes are immutable so they may be freely shared.
+     *  A contiguous buffer is only built when one is needed (e.g. for
+     *  printing), and then replaces the rope of the string.
      */
-    std::string svalue;
+    struct Rope;
+    mutable std::shared_ptr<Rope const> rope;
+
+    String(std::shared_ptr<Rope const>);
+
+    static auto leaf(std::string) -> std::shared_ptr<Rope const>;
+    static auto append_to(std::string&, Rope const&) -> void;
+    static auto concat(std::shared_ptr<Rope const>,
+                       std::shared_ptr<Rope const>)
+        -> std::shared_ptr<Rope const>;
+    auto flatten() const -> Rope const&;
 
   public:
     static const std::string type_name;
@@ -61,7 +80,8 @@ class String : public Value {
 
     std::unique_ptr<Value> copy() const override;
 
-    std::string& value();
+    std::string const& value() const;
+    auto length() const -> std::string::size_type;
 
     Integer* size();
     String* sub(int64_t b = 0, int64_t e = -1);
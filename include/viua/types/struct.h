@@ -53,7 +53,14 @@ class Struct : public Value {
     virtual std::unique_ptr<Value> remove(const std::string& key);
     virtual std::vector<std::string> keys() const;
 
+    /*
+     * Returns value of the attribute, or null if the struct does not have
+     * an attribute with such a name.
+     */
+    virtual auto at(const std::string& key) const -> Value*;
+
     std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
 
     ~Struct() override = default;
 };
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VIUA_TYPES_TYPED_VECTOR_H
+#define VIUA_TYPES_TYPED_VECTOR_H
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <viua/types/value.h>
+
+
+namespace viua { namespace types {
+/*
+ * Vectors holding elements of a single type, stored unboxed in contiguous
+ * memory.
+ *
+ * They are operated on by the same instructions as viua::types::Vector
+ * ("vinsert", "vpush", "vpop", "vat", and "vlen") but elements are boxed
+ * only when they are taken out of the vector, and unboxed (and checked to
+ * be of the right type) when they are put in.
+ * As there is no boxed element to point to "vat" gives a copy of the
+ * element instead of a pointer to it.
+ */
+class Typed_vector : public Value {
+  public:
+    virtual auto insert(int64_t const, std::unique_ptr<Value>) -> void = 0;
+    virtual auto push(std::unique_ptr<Value>) -> void                  = 0;
+    virtual auto pop(int64_t const) -> std::unique_ptr<Value>          = 0;
+    virtual auto at(int64_t const) const -> std::unique_ptr<Value>     = 0;
+    virtual auto len() const -> int64_t                                = 0;
+};
+
+template<typename T> class Unboxed_vector : public Typed_vector {
+    std::vector<T> elements;
+
+  public:
+    using element_type = T;
+
+    static const std::string type_name;
+
+    std::string type() const override;
+    std::string str() const override;
+    bool boolean() const override;
+    std::unique_ptr<Value> copy() const override;
+
+    auto value() -> std::vector<T>&;
+
+    auto insert(int64_t const, std::unique_ptr<Value>) -> void override;
+    auto push(std::unique_ptr<Value>) -> void override;
+    auto pop(int64_t const) -> std::unique_ptr<Value> override;
+    auto at(int64_t const) const -> std::unique_ptr<Value> override;
+    auto len() const -> int64_t override;
+
+    Unboxed_vector() = default;
+    Unboxed_vector(std::vector<T>);
+};
+
+/*
+ * Elements of integer vectors are Integers, of float vectors - Floats, and
+ * of byte vectors - Integers between 0 and 255.
+ */
+using Int_vector   = Unboxed_vector<int64_t>;
+using Float_vector = Unboxed_vector<double>;
+using Byte_vector  = Unboxed_vector<uint8_t>;
+
+template<> const std::string Int_vector::type_name;
+template<> const std::string Float_vector::type_name;
+template<> const std::string Byte_vector::type_name;
+
+extern template class Unboxed_vector<int64_t>;
+extern template class Unboxed_vector<double>;
+extern template class Unboxed_vector<uint8_t>;
+}}  // namespace viua::types
+
+
+#endif
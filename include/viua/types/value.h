@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -35,10 +37,20 @@ class Process;
 
 namespace types {
 class Pointer;
+class Value_owner;
 
 class Value {
     friend class Pointer;
-    std::vector<Pointer*> pointers;
+    /*
+     * Flag shared with pointers to the value, and cleared when the value is
+     * destroyed.
+     * A pointer may outlive the value it points to, and the value may be
+     * destroyed by a different process than the one that took the pointer
+     * (e.g. if the value was sent as a message) so the flag is atomic, and is
+     * not a part of the value itself.
+     * It is allocated when the first pointer to the value is taken.
+     */
+    std::shared_ptr<std::atomic_bool> alive;
 
   public:
     /** Basic interface of a Value.
@@ -51,16 +63,53 @@ class Value {
     virtual std::string repr() const;
     virtual bool boolean() const;
 
-    virtual std::unique_ptr<Pointer> pointer(const viua::process::Process*);
+    virtual std::unique_ptr<Pointer> pointer(const Value_owner*);
 
     virtual std::vector<std::string> bases() const;
     virtual std::vector<std::string> inheritancechain() const;
 
     virtual std::unique_ptr<Value> copy() const = 0;
 
+    /*
+     * Returns true if the given value is this value, or is contained in it
+     * (directly or through other values).
+     * Used to check if a value still belongs to the process that took a
+     * pointer to it.
+     */
+    virtual auto reaches(Value const*) const -> bool;
+
     Value() = default;
+    /*
+     * Pointers to a value do not point to its copies.
+     */
+    Value(Value const&);
+    auto operator=(Value const&) -> Value&;
     virtual ~Value();
 };
+
+/*
+ * Owner of values, i.e. a process.
+ * Pointers can only be dereferenced by the owner that took them, and only as
+ * long as the value they point to still belongs to that owner.
+ */
+class Value_owner {
+  public:
+    using generation_type = uint64_t;
+
+    /*
+     * Bumped every time the owner gives some of its values away (e.g. sends
+     * them as messages).
+     * Checking which pointers are affected would cost as much as the values
+     * that are given away are big so it is done lazily instead: a pointer
+     * taken in an earlier generation checks if its value is still owned when
+     * it is dereferenced for the first time in the current generation.
+     */
+    generation_type ownership_generation = 0;
+
+    virtual auto owns(Value const*) const -> bool = 0;
+
+    virtual ~Value_owner() = default;
+};
 }  // namespace types
 }  // namespace viua
 
@@ -40,6 +40,7 @@ class Vector : public Value {
     std::string str() const override;
     bool boolean() const override;
     std::unique_ptr<Value> copy() const override;
+    auto reaches(Value const*) const -> bool override;
 
     std::vector<std::unique_ptr<Value>>& value();
 
@@ -0,0 +1,73 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: square/1
+    arg %1 %0
+    mul %0 %1 %1
+    return
+.end
+
+.function: sum_of_squares/1
+    .name: 1 n
+    .name: 2 i
+    .name: 3 sum
+    arg %n %0
+    izero %i
+    izero %sum
+
+    .mark: loop
+    if (gte %4 %i %n) done +1
+    iinc %i
+    copy %5 %i
+    frame %1
+    param %0 %5
+    call %5 square/1
+    add %sum %sum %5
+    jump loop
+
+    .mark: done
+    move %0 %sum
+    return
+.end
+
+.function: main/0
+    ; square/1 becomes hot in one of the processes, and code compiled for it
+    ; is then used by all of them
+    integer %1 100
+
+    frame %1
+    param %0 %1
+    process %2 sum_of_squares/1
+    frame %1
+    param %0 %1
+    process %3 sum_of_squares/1
+    frame %1
+    param %0 %1
+    process %4 sum_of_squares/1
+    frame %1
+    param %0 %1
+    process %5 sum_of_squares/1
+
+    print (join %6 %2)
+    print (join %6 %3)
+    print (join %6 %4)
+    print (join %6 %5)
+
+    izero %0 local
+    return
+.end
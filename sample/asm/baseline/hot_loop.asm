@@ -0,0 +1,40 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: main/0
+    ; main is called only once, but the loop runs long enough to get main
+    ; compiled by the baseline compiler in the middle of its execution
+    .name: 1 n
+    .name: 2 i
+    .name: 3 sum
+    integer %n 1000
+    izero %i
+    izero %sum
+
+    .mark: loop
+    if (gte %4 %i %n) done +1
+    iinc %i
+    add %sum %sum %i
+    jump loop
+
+    .mark: done
+    print %sum
+    print %i
+    izero %0 local
+    return
+.end
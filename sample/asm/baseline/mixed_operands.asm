@@ -0,0 +1,66 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: step/2
+    ; integers take the fast path, floats and pointers are left to the
+    ; interpreter
+    arg %1 local %0
+    arg %2 local %1
+    add %0 local %1 local %2 local
+    return
+.end
+
+.function: sum/1
+    .name: 1 n
+    .name: 2 i
+    .name: 3 total
+    arg %n %0
+    izero %i
+    izero %total
+
+    .mark: loop
+    if (lt %4 %i %n) +1 done
+    frame ^[(param %0 %total) (param %1 %i)]
+    call %total step/2
+    iinc %i
+    jump loop
+
+    .mark: done
+    move %0 %total
+    return
+.end
+
+.function: main/0
+    frame ^[(param %0 (integer %1 100))]
+    print (call %2 sum/1)
+
+    frame ^[(param %0 (float %3 0.5)) (param %1 (integer %4 2))]
+    print (call %5 step/2)
+
+    integer %6 40
+    ptr %7 %6
+    iinc *7
+    iinc %6
+    print %6
+
+    frame ^[(param %0 (integer %8 10))]
+    print (call %9 sum/1)
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,53 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: listener/1
+    receive %1 local infinity
+    echo %1 local
+    print (arg %2 local %0) local
+    return
+.end
+
+.function: main/0
+    vector %4 local
+
+    frame ^[(param %0 (integer %5 local 1) local)]
+    process %1 local listener/1
+    copy %5 local %1 local
+    vpush %4 local %5 local
+
+    frame ^[(param %0 (integer %5 local 2) local)]
+    process %2 local listener/1
+    copy %5 local %2 local
+    vpush %4 local %5 local
+
+    frame ^[(param %0 (integer %5 local 3) local)]
+    process %3 local listener/1
+    copy %5 local %3 local
+    vpush %4 local %5 local
+
+    broadcast %4 local (string %5 local "Hello broadcast World! ")
+
+    join void %1 local
+    join void %2 local
+    join void %3 local
+
+    izero %0 local
+    return
+.end
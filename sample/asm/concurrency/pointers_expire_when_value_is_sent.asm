@@ -0,0 +1,40 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: receiver/0
+    receive void infinity
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local receiver/0
+
+    string %2 local "Hello World!"
+    ptr %3 local %2 local
+    send %1 local %2 local
+
+    ; the string belongs to the receiver now
+    print *3 local
+
+    join void %1 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,58 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: sum_of/1
+    atom %1 local 'batch'
+    priority %1 local
+
+    arg %1 local %0
+    izero %2 local
+    izero %3 local
+    jump check
+
+    .mark: loop
+    iinc %3 local
+    add %2 local %2 local %3 local
+
+    .mark: check
+    lt %4 local %3 local %1 local
+    if %4 local loop +1
+
+    print %2 local
+    return
+.end
+
+.function: main/0
+    atom %1 local 'realtime'
+    priority %1 local
+
+    integer %2 local 1000
+    frame ^[(param %0 %2 local)]
+    process %2 local sum_of/1
+    join void %2 local
+
+    atom %1 local 'normal'
+    priority %1 local
+
+    string %3 local "done"
+    print %3 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,62 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; Both workers do the same amount of work, but the realtime one is run first
+; in every burst so it finishes first even though it was spawned last.
+
+.function: worker/2
+    arg %1 local %0
+    priority %1 local
+
+    integer %2 local 100000
+    izero %3 local
+    jump check
+
+    .mark: loop
+    iinc %3 local
+
+    .mark: check
+    lt %4 local %3 local %2 local
+    if %4 local loop +1
+
+    print (arg %5 local %1) local
+    return
+.end
+
+.function: main/0
+    atom %1 local 'normal'
+    string %2 local "normal"
+    frame %2
+    param %0 %1 local
+    param %1 %2 local
+    process %3 local worker/2
+
+    atom %1 local 'realtime'
+    string %2 local "realtime"
+    frame %2
+    param %0 %1 local
+    param %1 %2 local
+    process %4 local worker/2
+
+    join void %3 local
+    join void %4 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,67 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: listener/0
+    ; the reply is sent last so all the messages sent before it are skipped
+    struct %1 local
+    atom %2 local 'tag'
+    atom %3 local 'reply'
+    structinsert %1 local %2 local %3 local
+    receivematch %4 local %1 local infinity
+    print %4 local
+
+    ; atoms naming a type match any value of that type
+    atom %1 local 'Integer'
+    receivematch %4 local %1 local infinity
+    print %4 local
+
+    ; skipped messages are received in the order in which they arrived
+    receive %4 local infinity
+    print %4 local
+    receive %4 local infinity
+    print %4 local
+
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local listener/0
+
+    atom %2 local 'noise'
+    send %1 local %2 local
+    integer %2 local 42
+    send %1 local %2 local
+    atom %2 local 'more_noise'
+    send %1 local %2 local
+
+    struct %2 local
+    atom %3 local 'tag'
+    atom %4 local 'reply'
+    structinsert %2 local %3 local %4 local
+    atom %3 local 'value'
+    string %4 local "Hello World!"
+    structinsert %2 local %3 local %4 local
+    send %1 local %2 local
+
+    join void %1 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,56 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: listener/0
+    ; the filter has a key the first message does not have so only the
+    ; second message matches it
+    struct %1 local
+    atom %2 local 'value'
+    atom %3 local 'Integer'
+    structinsert %1 local %2 local %3 local
+    receivematch %4 local %1 local infinity
+    print %4 local
+
+    receive %4 local infinity
+    print %4 local
+
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local listener/0
+
+    struct %2 local
+    atom %3 local 'tag'
+    atom %4 local 'no_value'
+    structinsert %2 local %3 local %4 local
+    send %1 local %2 local
+
+    struct %2 local
+    atom %3 local 'value'
+    integer %4 local 42
+    structinsert %2 local %3 local %4 local
+    send %1 local %2 local
+
+    join void %1 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,57 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; A sent closure does not share its registers (nor the values it captured by
+; reference) with closures that stay with the sender.
+
+.closure: increment/0
+    iinc %1 local
+    print %1 local
+    return
+.end
+
+.function: receiver/0
+    receive %1 local infinity
+    frame %0
+    call void %1 local
+    frame %0
+    call void %1 local
+    return
+.end
+
+.function: main/0
+    integer %1 local 41
+    closure %2 local increment/0
+    capture %2 local %1 %1 local
+
+    ; the copy shares the register set with the closure that is sent
+    copy %3 local %2 local
+
+    frame %0
+    process %4 local receiver/0
+    send %4 local %2 local
+    join void %4 local
+
+    frame %0
+    call void %3 local
+    print %1 local
+
+    izero %0 local
+    return
+.end
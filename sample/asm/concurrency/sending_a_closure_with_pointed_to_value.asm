@@ -0,0 +1,52 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+
+.closure: greet/0
+    print %1 local
+    return
+.end
+
+.function: receiver/0
+    receive %1 local infinity
+    frame %0
+    call void %1 local
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local receiver/0
+
+    string %2 local "Hello World!"
+    ptr %3 local %2 local
+
+    closure %4 local greet/0
+    capturemove %4 local %1 %2 local
+
+    ; the value is held by the closure so the pointer is still valid
+    print *3 local
+
+    ; the closure is moved to the receiver together with the captured value
+    send %1 local %4 local
+    join void %1 local
+
+    print *3 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,61 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+
+.function: receiver/0
+    receive %1 local infinity
+    print (vlen %2 local %1 local) local
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local receiver/0
+
+    vector %2 local
+    izero %3 local
+    integer %4 local 100000
+
+    .mark: loop
+    lt %5 local %3 local %4 local
+    if %5 local +1 filled
+    copy %6 local %3 local
+    vpush %2 local %6 local
+    iinc %3 local
+    jump loop
+
+    .mark: filled
+    vat %7 local %2 local (integer %8 local -1)
+    print *7 local
+
+    ; the vector is moved to the receiver, and a pointer into it expires
+    send %1 local %2 local
+    join void %1 local
+
+    try
+    catch "Exception" .block: handler
+        print (draw %9 local) local
+        leave
+    .end
+    enter .block: dereference
+        print *7 local
+        leave
+    .end
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,59 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: listener/0
+    ; the whole batch arrives at once so after the first message is received
+    ; all the other ones are pending
+    receive %1 local infinity
+    print %1 local
+
+    integer %2 local 2
+    receivemany %3 local %2 local
+    print %3 local
+
+    integer %2 local 8
+    receivemany %3 local %2 local
+    print %3 local
+
+    receivemany %3 local %2 local
+    print %3 local
+
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local listener/0
+
+    vector %2 local
+    string %3 local "Hello"
+    vpush %2 local %3 local
+    string %3 local "batched"
+    vpush %2 local %3 local
+    string %3 local "messages"
+    vpush %2 local %3 local
+    string %3 local "World!"
+    vpush %2 local %3 local
+    sendall %1 local %2 local
+
+    join void %1 local
+
+    izero %0 local
+    return
+.end
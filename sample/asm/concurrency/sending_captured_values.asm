@@ -0,0 +1,56 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: modifier/0
+    ; register 1 holds a captured reference so this rebinds it
+    integer %1 42
+    print %1
+    return
+.end
+
+.function: receiver/0
+    receive %1 local infinity
+
+    ; wait until the sender modifies the captured value
+    receive %2 local infinity
+
+    print %1 local
+    return
+.end
+
+.function: main/1
+    closure %2 modifier/0
+    capture %2 %1 (string %1 "Hello World!")
+
+    frame %0
+    process %3 local receiver/0
+
+    ; the value is shared with the closure so it must be sent by copy, and
+    ; not as a reference
+    send %3 local %1 local
+
+    frame %0
+    call void %2
+
+    send %3 local (izero %4 local)
+    join void %3 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,48 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: worker/0
+    izero %0 local
+    return
+.end
+
+.function: listener/0
+    ; the message sent to the stale PID must not arrive here, even if the
+    ; process got the slot of the worker
+    receive %1 local 500ms
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local worker/0
+    join void %1 local
+
+    frame %0
+    process %2 local listener/0
+
+    string %3 local "Hello stale World!"
+    send %1 local %3 local
+
+    join void %2 local
+
+    izero %0 local
+    return
+.end
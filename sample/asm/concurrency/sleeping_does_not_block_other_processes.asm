@@ -0,0 +1,40 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: sleeper/0
+    integer %1 local 50
+    sleep %1 local
+
+    string %1 local "World!"
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0
+    process %1 local sleeper/0
+
+    string %2 local "Hello"
+    print %2 local
+
+    join void %1 local
+
+    izero %0 local
+    return
+.end
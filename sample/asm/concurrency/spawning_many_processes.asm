@@ -0,0 +1,57 @@
+;
+;   Copyright (C) 2015, 2016, 2017 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: double/1
+    ; global register set of a process is allocated on first use
+    arg %1 global %0
+    add %0 local %1 global %1 global
+    return
+.end
+
+.function: main/0
+    .name: 1 n
+    .name: 2 i
+    .name: 3 pids
+    .name: 4 sum
+    integer %n 1000
+    izero %i
+    vector %pids
+
+    .mark: spawning
+    if (gte %5 %i %n) joining +1
+    frame %1
+    param %0 %i
+    process %6 double/1
+    vpush %pids %6
+    iinc %i
+    jump spawning
+
+    .mark: joining
+    izero %sum
+    .mark: join_next
+    if (vlen %5 %pids) +1 done
+    vpop %6 %pids
+    join %7 %6
+    add %sum %sum %7
+    jump join_next
+
+    .mark: done
+    print %sum
+    izero %0 local
+    return
+.end
@@ -0,0 +1,55 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; A closure passed as a parameter to a new process does not share its
+; registers (nor the values it captured by reference) with the closure that
+; stays with the parent process.
+
+.closure: increment/0
+    iinc %1 local
+    print %1 local
+    return
+.end
+
+.function: worker/1
+    arg %1 local %0
+    frame %0
+    call void %1 local
+    frame %0
+    call void %1 local
+    return
+.end
+
+.function: main/0
+    integer %1 local 41
+    closure %2 local increment/0
+    capture %2 local %1 %1 local
+
+    frame %1
+    param %0 %2 local
+    process %3 local worker/1
+    join void %3 local
+
+    frame %0
+    call void %2 local
+    print %1 local
+
+    izero %0 local
+    return
+.end
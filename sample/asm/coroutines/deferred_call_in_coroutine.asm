@@ -0,0 +1,45 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: say_bye/0
+    print (text %1 local "bye") local
+    return
+.end
+
+.function: with_cleanup/0
+    frame %0
+    defer say_bye/0
+
+    yield (integer %1 local 1) local
+    integer %0 local 2
+    return
+.end
+
+.function: main/0
+    frame %0
+    coroutine %1 local with_cleanup/0
+
+    resume %2 local %1 local
+    print %2 local
+    resume %2 local %1 local
+    print %2 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,54 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: failing/0
+    integer %1 local 1
+    yield %1 local
+    throw (text %2 local "failed in coroutine") local
+    return
+.end
+
+.block: handler
+    print (draw %3 local) local
+    leave
+.end
+
+.block: resume_failing
+    resume %2 local %1 local
+    print %2 local
+    leave
+.end
+
+.function: main/0
+    frame %0
+    coroutine %1 local failing/0
+
+    try
+    catch "Text" handler
+    enter resume_failing
+
+    try
+    catch "Text" handler
+    enter resume_failing
+
+    print %1 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,66 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: count_to/1
+    arg %1 local %0
+    izero %2 local
+
+    .mark: loop
+    if (lt %3 local %2 local %1 local) local +1 done
+    yield %2 local
+    iinc %2 local
+    jump loop
+
+    .mark: done
+    return
+.end
+
+.function: doubled/1
+    ; this coroutine resumes the one it was given, and yields doubled values
+    ; it received from it
+    arg %1 local %0
+    integer %2 local 2
+
+    .mark: loop
+    resume %3 local %1 local
+    if %1 local +1 done
+    yield (mul %4 local %3 local %2 local) local
+    jump loop
+
+    .mark: done
+    return
+.end
+
+.function: main/0
+    frame ^[(param %0 (integer %1 local 5) local)]
+    coroutine %1 local count_to/1
+
+    frame ^[(pamv %0 %1 local)]
+    coroutine %2 local doubled/1
+
+    .mark: loop
+    resume %3 local %2 local
+    if %2 local +1 done
+    print %3 local
+    jump loop
+
+    .mark: done
+    izero %0 local
+    return
+.end
@@ -0,0 +1,60 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: square/1
+    arg %1 local %0
+    mul %0 local %1 local %1 local
+    return
+.end
+
+.function: cleanup/0
+    ; the value returned by this call must not replace the value returned
+    ; by the function which deferred this one
+    frame ^[(param %0 (integer %1 local 7) local)]
+    call %2 local square/1
+    move %0 local %2 local
+    return
+.end
+
+.function: increment/1
+    frame %0
+    defer cleanup/0
+
+    arg %1 local %0
+    iinc %1 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/0
+    izero %1 local
+    integer %2 local 10000
+
+    .mark: loop
+    if (gte %3 local %1 local %2 local) local done +1
+    frame ^[(param %0 %1 local)]
+    call %1 local increment/1
+    jump loop
+
+    .mark: done
+    print %1 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,48 @@
+;
+;   Copyright (C) 2017 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; The returned value is set aside before deferred calls run so calls they
+; make do not overwrite it.
+
+.function: answer/0
+    integer %0 local 69
+    return
+.end
+
+.function: deferred/0
+    frame %0
+    print (call %1 local answer/0) local
+    return
+.end
+
+.function: returns_a_value/0
+    frame %0
+    defer deferred/0
+
+    integer %0 local 42
+    return
+.end
+
+.function: main/0
+    frame %0
+    print (call %1 local returns_a_value/0) local
+
+    izero %0 local
+    return
+.end
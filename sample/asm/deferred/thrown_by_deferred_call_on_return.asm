@@ -0,0 +1,61 @@
+;
+;   Copyright (C) 2017 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; Deferred calls run outside of the try frames of the function that deferred
+; them so exceptions they throw are caught by its callers.
+
+.function: thrower/0
+    integer %1 local 42
+    throw %1 local
+    return
+.end
+
+.function: returns_in_a_try_block/0
+    try
+    catch "Integer" .block: inner_handler
+        print (string %1 local "caught in the returning function") local
+        leave
+    .end
+    enter .block: returning
+        frame %0
+        defer thrower/0
+
+        izero %0 local
+        return
+    .end
+
+    izero %0 local
+    return
+.end
+
+.function: main/0
+    try
+    catch "Integer" .block: outer_handler
+        print (draw %1 local) local
+        leave
+    .end
+    enter .block: calling
+        frame %0
+        call %1 local returns_in_a_try_block/0
+        leave
+    .end
+
+    izero %0 local
+    return
+.end
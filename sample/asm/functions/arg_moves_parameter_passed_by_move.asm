@@ -0,0 +1,38 @@
+;
+;   Copyright (C) 2015, 2016, 2017 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: increment/2
+    ; the value is passed by move so the pointer to it stays valid, and
+    ; points to the value in register 1
+    arg %1 local %0
+    arg %2 local %1
+    iinc *2 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/1
+    integer %1 local 41
+    ptr %2 local %1 local
+
+    frame ^[(pamv %0 %1 local) (param %1 %2 local)]
+    print (call %3 local increment/2) local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,35 @@
+;
+;   Copyright (C) 2015, 2016, 2017 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: twice/1
+    ; parameter passed by move is moved out of the argument register by
+    ; the first arg, so there is nothing left to read for the second one
+    arg void %0
+    arg void %0
+    return
+.end
+
+.function: main/1
+    integer %1 local 42
+
+    frame ^[(pamv %0 %1 local)]
+    call void twice/1
+
+    izero %0 local
+    return
+.end
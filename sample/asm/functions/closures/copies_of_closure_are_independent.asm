@@ -0,0 +1,52 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: counter/0
+    ; expects register 1 to be captured
+    iinc %1 local
+    print %1 local
+    return
+.end
+
+.function: main/1
+    izero %1 local
+
+    closure %2 local counter/0
+    capturecopy %2 local %1 %1 local
+
+    frame %0
+    call void %2 local
+
+    ; the copy shares captured values with the original until one of them
+    ; is called, and is not affected by later calls of the original
+    copy %3 local %2 local
+
+    frame %0
+    call void %2 local
+    frame %0
+    call void %2 local
+
+    frame %0
+    call void %3 local
+    frame %0
+    call void %2 local
+
+    izero %0 local
+    return
+.end
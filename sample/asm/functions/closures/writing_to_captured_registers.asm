@@ -0,0 +1,70 @@
+;
+;   Copyright (C) 2015, 2016, 2017 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: forty_two/0
+    integer %0 42
+    return
+.end
+
+.function: write_through/0
+    ; register 1 holds a reference to a value captured by main so every
+    ; write to it changes the captured value
+    integer %1 1
+    print %1
+
+    frame %0
+    call %1 forty_two/0
+    print %1
+
+    text %2 "moved in"
+    move %1 %2
+    return
+.end
+
+.function: move_out/0
+    print %1
+
+    ; the reference is moved out of register 1, and writes to the register
+    ; it was moved to still change the captured value
+    move %2 %1
+    integer %2 100
+
+    ; register 1 is an ordinary register now
+    integer %1 7
+    print %1
+    return
+.end
+
+.function: main/0
+    closure %2 write_through/0
+    capture %2 %1 (integer %1 0)
+    frame %0
+    call void %2
+    print %1
+
+    ; overwriting a captured value changes it for the closure too
+    integer %1 2
+    closure %3 move_out/0
+    capture %3 %1 %1
+    frame %0
+    call void %3
+    print %1
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,57 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; Every function has its own set of static registers, and
+; it is preserved between calls.
+
+.function: tick_a/0
+    if (isnull %1 local %1 static) initialise increment
+    .mark: initialise
+    izero %1 static
+    .mark: increment
+    iinc %1 static
+    copy %0 local %1 static
+    return
+.end
+
+.function: tick_b/0
+    if (isnull %1 local %1 static) initialise increment
+    .mark: initialise
+    integer %1 static 100
+    .mark: increment
+    iinc %1 static
+    copy %0 local %1 static
+    return
+.end
+
+.function: main/0
+    frame %0
+    print (call %1 local tick_a/0) local
+    frame %0
+    print (call %1 local tick_a/0) local
+    frame %0
+    print (call %1 local tick_b/0) local
+    frame %0
+    print (call %1 local tick_a/0) local
+    frame %0
+    print (call %1 local tick_b/0) local
+
+    izero %0 local
+    return
+.end
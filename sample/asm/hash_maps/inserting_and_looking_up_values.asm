@@ -0,0 +1,65 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/0
+    hashmap (.name: %iota map) local
+
+    integer (.name: %iota int_key) local 1
+    string (.name: %iota value) local "integer"
+    hashmapinsert %map local %int_key local %value local
+
+    float (.name: %iota float_key) local 1.5
+    string %value local "float"
+    hashmapinsert %map local %float_key local %value local
+
+    atom (.name: %iota atom_key) local 'answer'
+    integer %value local 42
+    hashmapinsert %map local %atom_key local %value local
+
+    string (.name: %iota string_key) local "Hello"
+    string %value local "string"
+    hashmapinsert %map local %string_key local %value local
+
+    text (.name: %iota text_key) local "World"
+    string %value local "text"
+    hashmapinsert %map local %text_key local %value local
+
+    bits (.name: %iota bits_key) local 0b1010
+    string %value local "bits"
+    hashmapinsert %map local %bits_key local %value local
+
+    hashmaplookup (.name: %iota found) local %map local %int_key local
+    print *found local
+    hashmaplookup %found local %map local %float_key local
+    print *found local
+    hashmaplookup %found local %map local %atom_key local
+    print *found local
+    hashmaplookup %found local %map local %string_key local
+    print *found local
+    hashmaplookup %found local %map local %text_key local
+    print *found local
+    hashmaplookup %found local %map local %bits_key local
+    print *found local
+
+    hashmapsize (.name: %iota size) local %map local
+    print %size local
+
+    izero %0 local
+    return
+.end
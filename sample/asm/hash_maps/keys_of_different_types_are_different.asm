@@ -0,0 +1,43 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/0
+    hashmap (.name: %iota map) local
+
+    integer (.name: %iota key) local 1
+    string (.name: %iota value) local "integer"
+    hashmapinsert %map local %key local %value local
+
+    float %key local 1.0
+    string %value local "float"
+    hashmapinsert %map local %key local %value local
+
+    atom %key local 'one'
+    string %value local "atom"
+    hashmapinsert %map local %key local %value local
+
+    string %key local "one"
+    string %value local "string"
+    hashmapinsert %map local %key local %value local
+
+    print (hashmapsize (.name: %iota size) local %map local) local
+
+    izero %0 local
+    return
+.end
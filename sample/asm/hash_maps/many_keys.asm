@@ -0,0 +1,55 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; Inserting many keys makes the map grow, and removing them leaves deleted
+; slots behind; lookups must work through both.
+
+.function: main/0
+    hashmap (.name: %iota map) local
+
+    izero (.name: %iota i) local
+    integer (.name: %iota limit) local 1000
+    .mark: inserting
+    if (gte (.name: %iota done) local %i local %limit local) local inserted +1
+    hashmapinsert %map local %i local (mul (.name: %iota square) local %i local %i local) local
+    iinc %i local
+    jump inserting
+    .mark: inserted
+
+    izero %i local
+    integer (.name: %iota two) local 2
+    .mark: removing
+    if (gte %done local %i local %limit local) local removed +1
+    hashmapremove void %map local %i local
+    add %i local %i local %two local
+    jump removing
+    .mark: removed
+
+    print (hashmapsize (.name: %iota size) local %map local) local
+
+    integer %i local 999
+    hashmaplookup (.name: %iota found) local %map local %i local
+    print *found local
+
+    integer %i local 500
+    print (hashmapcontains (.name: %iota contains) local %map local %i local) local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,75 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: square/1
+    arg %1 %0
+    mul %0 %1 %1
+    return
+.end
+
+.function: add3/3
+    arg %1 %0
+    arg %2 %1
+    add %0 %1 %2
+    add %0 %0 (arg %3 %2)
+    return
+.end
+
+.function: greet/1
+    ; parameter is passed but never received, and nothing is returned
+    print (text %1 "Hello World!")
+    return
+.end
+
+.function: sum_of_squares/1
+    .name: 1 n
+    .name: 2 i
+    .name: 3 sum
+    arg %n %0
+    izero %i
+    izero %sum
+
+    .mark: loop
+    if (gte %4 %i %n) done +1
+    iinc %i
+    frame ^[(param %0 %i)]
+    add %sum %sum (call %5 square/1)
+    jump loop
+
+    .mark: done
+    move %0 %sum
+    return
+.end
+
+.function: main/0
+    frame ^[(param %0 (integer %1 10))]
+    print (call %2 sum_of_squares/1)
+
+    frame %3
+    param %0 (integer %3 1)
+    param %1 (integer %4 2)
+    pamv %2 (integer %5 3)
+    print (call %6 add3/3)
+
+    frame ^[(param %0 %6)]
+    call void greet/1
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,66 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: cold/0
+    ; never called unless the program gets no numbers to sum
+    text %1 local "nothing to do"
+    print %1 local
+    return
+.end
+
+.function: square/1
+    arg %1 local %0
+    mul %0 local %1 local %1 local
+    return
+.end
+
+.function: sum_of_squares/1
+    .name: 1 n
+    .name: 2 i
+    .name: 3 sum
+    arg %n %0
+    izero %i
+    izero %sum
+
+    .mark: loop
+    if (gte %4 %i %n) done +1
+    iinc %i
+    frame ^[(param %0 %i)]
+    add %sum %sum (call %5 square/1)
+    jump loop
+
+    .mark: done
+    move %0 %sum
+    return
+.end
+
+.function: main/0
+    integer %1 10
+    if (not (eq %2 %1 (izero %3))) numbers +1
+    frame %0
+    call void cold/0
+    jump finish
+
+    .mark: numbers
+    frame ^[(param %0 %1)]
+    print (call %4 sum_of_squares/1)
+
+    .mark: finish
+    izero %0 local
+    return
+.end
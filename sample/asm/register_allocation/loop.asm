@@ -0,0 +1,55 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: sum_of_squares/1
+    ; computes 1*1 + 2*2 + ... + n*n
+    ; the register holding the square is dead once it is added to the sum so
+    ; it may share an index with registers used after the loop
+    .name: 1 n
+    .name: 2 i
+    .name: 3 sum
+    .name: 4 square
+    arg %n %0
+    izero %i
+    izero %sum
+
+    .mark: loop
+    if (gte %5 %i %n) done +1
+    iinc %i
+    add %sum %sum (mul %square %i %i)
+    jump loop
+
+    .mark: done
+    .name: 6 half
+    .name: 7 two
+    div %half %sum (integer %two 2)
+    add %0 %half %half
+    return
+.end
+
+.function: main/0
+    frame ^[(param %0 (integer %1 10))]
+    print (call %9 sum_of_squares/1)
+
+    frame ^[(param %0 (integer %12 3))]
+    print (call %15 sum_of_squares/1)
+
+    izero %0 local
+    return
+.end
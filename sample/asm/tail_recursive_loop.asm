@@ -0,0 +1,46 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: sum/2
+    .name: %iota counter
+    .name: %iota accumulator
+    arg %counter local %0
+    arg %accumulator local %1
+
+    if (eq %3 local %counter local (izero %4 local) local) local +1 loop
+    copy %0 local %accumulator local
+    return
+
+    .mark: loop
+    add %accumulator local %accumulator local %counter local
+    idec %counter local
+
+    ; the frame of the caller is reused by the tail called function so the
+    ; loop runs in constant memory no matter how many times it is repeated
+    frame ^[(pamv %0 %counter local) (pamv %1 %accumulator local)]
+    tailcall sum/2
+.end
+
+.function: main/0
+    frame ^[(param %0 (integer %1 local 10000) local) (param %1 (izero %2 local) local)]
+    print (call %3 local sum/2) local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,32 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    vectorof (.name: %iota numbers) 'float'
+    vpush %numbers (float (.name: %iota element) 0.5)
+    vpush %numbers (float %element 1.25)
+
+    vat (.name: %iota first) %numbers (izero (.name: %iota index))
+    vat (.name: %iota second) %numbers (integer %index 1)
+    print (add %element %first %second)
+    print (vlen %index %numbers)
+
+    izero %0 local
+    return
+.end
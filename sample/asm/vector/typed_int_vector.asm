@@ -0,0 +1,39 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    vectorof (.name: %iota numbers) local 'int'
+    vpush %numbers local (integer (.name: %iota element) local 1) local
+    vpush %numbers local (integer %element local 2) local
+    vpush %numbers local (integer %element local 3) local
+    izero %element local
+    vinsert %numbers local %element local (izero (.name: %iota index) local) local
+    print %numbers local
+
+    ; elements are copied out of typed vectors so can be used directly
+    vat (.name: %iota last) local %numbers local (integer %index local -1) local
+    print (add %element local %last local %last local) local
+
+    print (vpop %element local %numbers local void) local
+    print (vlen %element local %numbers local) local
+    print %numbers local
+
+    izero %0 local
+    return
+.end
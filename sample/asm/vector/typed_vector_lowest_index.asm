@@ -0,0 +1,39 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.function: main/1
+    vectorof (.name: %iota ints) 'int'
+    vpush %ints (integer (.name: %iota element) 42)
+
+    ; integer literals are too narrow for the lowest possible index so it is
+    ; computed by doubling -1 63 times
+    integer (.name: %iota index) -1
+    integer (.name: %iota two) 2
+    integer (.name: %iota i) 63
+    .mark: doubling
+    if %i +1 done
+    mul %index %index %two
+    idec %i
+    jump doubling
+
+    .mark: done
+    vat %element %ints %index
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,57 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+; Spawns N short-lived processes, one after another.
+; Use this to measure cost of spawning (and reaping) a process:
+;
+;   $ ./build/bin/vm/asm -o spawn.bc sample/benchmark/spawn/spawn.asm
+;   $ time VIUA_VP_SCHEDULERS=1 ./build/bin/vm/kernel spawn.bc 1000000
+
+.function: nothing/0
+    return
+.end
+
+.function: spawner/1
+    arg %1 local %0
+    izero %2 local
+
+    .mark: loop
+    gt %3 local %1 local %2 local
+    if %3 local +1 done
+    frame %0
+    process void nothing/0
+    idec %1 local
+    jump loop
+
+    .mark: done
+    return
+.end
+
+.function: main/2
+    arg %1 local %1
+
+    vpop %2 local %1 local
+    stoi %2 local %2 local
+    frame %1
+    param %0 %2 local
+    call void spawner/1
+
+    izero %0 local
+    return
+.end
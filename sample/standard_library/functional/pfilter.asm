@@ -0,0 +1,53 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: is_even/1
+    arg %1 local %0
+    integer %2 local 2
+    div %3 local %1 local %2 local
+    mul %3 local %3 local %2 local
+    eq %0 local %3 local %1 local
+    return
+.end
+
+.signature: std::functional::pfilter/2
+
+.function: main/0
+    import "std::functional"
+
+    vector %1 local
+    izero %2 local
+    integer %3 local 20
+
+    .mark: loop
+    iinc %2 local
+    vpush %1 local (copy %4 local %2 local) local
+    if (lt %5 local %2 local %3 local) local loop +1
+
+    frame ^[(pamv %0 (function %6 local is_even/1) local) (pamv %1 %1 local)]
+    call %7 local std::functional::pfilter/2
+    print %7 local
+
+    frame ^[(pamv %0 (function %6 local is_even/1) local) (pamv %1 (vector %1 local) local)]
+    call %7 local std::functional::pfilter/2
+    print %7 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,72 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: sum/2
+    arg %1 local %0
+    arg %2 local %1
+    add %0 local %1 local %2 local
+    return
+.end
+
+.function: concatenate/2
+    arg %1 local %0
+    arg %2 local %1
+    textconcat %0 local %1 local %2 local
+    return
+.end
+
+.signature: std::functional::preduce/3
+
+.function: main/0
+    import "std::functional"
+
+    vector %1 local
+    vector %8 local
+    izero %2 local
+    integer %3 local 1000
+
+    .mark: loop
+    iinc %2 local
+    vpush %1 local (copy %4 local %2 local) local
+    if (lt %5 local %2 local %3 local) local loop +1
+
+    frame ^[(pamv %0 (function %6 local sum/2) local) (pamv %1 (izero %9 local) local) (pamv %2 %1 local)]
+    call %7 local std::functional::preduce/3
+    print %7 local
+
+    ; the function is applied to elements in order
+    vpush %8 local (text %9 local "H") local
+    vpush %8 local (text %9 local "e") local
+    vpush %8 local (text %9 local "l") local
+    vpush %8 local (text %9 local "l") local
+    vpush %8 local (text %9 local "o") local
+    vpush %8 local (text %9 local " ") local
+    vpush %8 local (text %9 local "W") local
+    vpush %8 local (text %9 local "o") local
+    vpush %8 local (text %9 local "r") local
+    vpush %8 local (text %9 local "l") local
+    vpush %8 local (text %9 local "d") local
+    vpush %8 local (text %9 local "!") local
+    frame ^[(pamv %0 (function %6 local concatenate/2) local) (pamv %1 (text %9 local "") local) (pamv %2 %8 local)]
+    call %7 local std::functional::preduce/3
+    print %7 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,61 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::vector::of_unboxed_ints/1
+.signature: std::numeric::add/2
+.signature: std::numeric::sub/2
+.signature: std::numeric::mul/2
+.signature: std::numeric::div/2
+
+.function: main/1
+    import "std::vector"
+    import "std/numeric"
+
+    ; long enough to need both whole lanes, and elements processed one by one
+    integer %1 local 20
+    frame ^[(param %0 %1 local)]
+    call %2 local std::vector::of_unboxed_ints/1
+
+    frame ^[(param %0 %2 local) (param %1 %2 local)]
+    call %3 local std::numeric::add/2
+    print %3 local
+
+    frame ^[(param %0 %2 local) (param %1 %2 local)]
+    call %4 local std::numeric::mul/2
+    print %4 local
+
+    frame ^[(param %0 %4 local) (param %1 %3 local)]
+    call %5 local std::numeric::sub/2
+    print %5 local
+
+    ; integer division truncates towards zero
+    vectorof %6 local 'int'
+    integer %7 local 20
+    .mark: fill
+    vpush %6 local (integer %8 local 3) local
+    idec %7 local
+    if %7 local fill
+
+    frame ^[(param %0 %5 local) (param %1 %6 local)]
+    call %9 local std::numeric::div/2
+    print %9 local
+
+    izero %0 local
+    return
+.end
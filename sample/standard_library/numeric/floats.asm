@@ -0,0 +1,55 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::numeric::sum/1
+.signature: std::numeric::dot/2
+.signature: std::numeric::max/1
+.signature: std::numeric::prefix_sum/1
+
+.function: main/1
+    import "std/numeric"
+
+    ; boxed vectors containing Floats are treated as float vectors
+    vector %1 local
+    vpush %1 local (float %2 local 0.5) local
+    vpush %1 local (float %2 local 1.5) local
+    vpush %1 local (integer %2 local 2) local
+
+    frame ^[(param %0 %1 local)]
+    print (call %3 local std::numeric::sum/1) local
+
+    frame ^[(param %0 %1 local) (param %1 %1 local)]
+    print (call %3 local std::numeric::dot/2) local
+
+    frame ^[(param %0 %1 local)]
+    print (call %3 local std::numeric::max/1) local
+
+    vectorof %4 local 'float'
+    integer %5 local 10
+    .mark: fill
+    vpush %4 local (float %6 local 0.25) local
+    idec %5 local
+    if %5 local fill
+
+    frame ^[(param %0 %4 local)]
+    print (call %3 local std::numeric::prefix_sum/1) local
+
+    izero %0 local
+    return
+.end
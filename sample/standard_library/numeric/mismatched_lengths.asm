@@ -0,0 +1,40 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::vector::of_unboxed_ints/1
+.signature: std::numeric::add/2
+
+.function: main/1
+    import "std::vector"
+    import "std/numeric"
+
+    integer %1 local 3
+    frame ^[(param %0 %1 local)]
+    call %2 local std::vector::of_unboxed_ints/1
+
+    integer %1 local 4
+    frame ^[(param %0 %1 local)]
+    call %3 local std::vector::of_unboxed_ints/1
+
+    frame ^[(param %0 %2 local) (param %1 %3 local)]
+    call void std::numeric::add/2
+
+    izero %0 local
+    return
+.end
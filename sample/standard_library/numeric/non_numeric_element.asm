@@ -0,0 +1,34 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::numeric::sum/1
+
+.function: main/1
+    import "std/numeric"
+
+    vector %1 local
+    vpush %1 local (integer %2 local 42) local
+    vpush %1 local (string %2 local "Hello World!") local
+
+    frame ^[(param %0 %1 local)]
+    call void std::numeric::sum/1
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,91 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+.signature: std::numeric::add/2
+.signature: std::numeric::sub/2
+.signature: std::numeric::mul/2
+.signature: std::numeric::dot/2
+.signature: std::numeric::sum/1
+.signature: std::numeric::prefix_sum/1
+
+.function: filled/2
+    ; returns an int vector of given length filled with given value
+    arg %1 local %0
+    arg %2 local %1
+    vectorof %0 local 'int'
+    .mark: fill
+    copy %3 local %1 local
+    vpush %0 local %3 local
+    idec %2 local
+    if %2 local fill
+    return
+.end
+
+.function: main/1
+    import "std/numeric"
+
+    ; integer literals are too narrow for the lowest and highest integers so
+    ; they are computed
+    integer %1 local -1
+    integer %2 local 2
+    integer %3 local 63
+    .mark: doubling
+    mul %1 local %1 local %2 local
+    idec %3 local
+    if %3 local doubling
+    izero %3 local
+    integer %4 local 1
+    add %5 local %1 local %4 local
+    sub %5 local %3 local %5 local
+
+    ; long enough to need both whole lanes, and elements processed one by one
+    integer %6 local 9
+    frame ^[(param %0 %5 local) (param %1 %6 local)]
+    call %7 local filled/2
+    frame ^[(param %0 %1 local) (param %1 %6 local)]
+    call %8 local filled/2
+    frame ^[(param %0 %4 local) (param %1 %6 local)]
+    call %9 local filled/2
+    frame ^[(param %0 %2 local) (param %1 %6 local)]
+    call %10 local filled/2
+
+    ; arithmetic wraps around
+    frame ^[(param %0 %7 local) (param %1 %9 local)]
+    call %11 local std::numeric::add/2
+    print %11 local
+    frame ^[(param %0 %8 local) (param %1 %9 local)]
+    call %11 local std::numeric::sub/2
+    print %11 local
+    frame ^[(param %0 %7 local) (param %1 %10 local)]
+    call %11 local std::numeric::mul/2
+    print %11 local
+
+    ; so do reductions
+    frame ^[(param %0 %7 local)]
+    call %11 local std::numeric::sum/1
+    print %11 local
+    frame ^[(param %0 %7 local) (param %1 %9 local)]
+    call %11 local std::numeric::dot/2
+    print %11 local
+    frame ^[(param %0 %7 local)]
+    call %11 local std::numeric::prefix_sum/1
+    print %11 local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,85 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+.signature: std::persistent::pop/1
+.signature: std::persistent::at/2
+.signature: std::persistent::set/3
+.signature: std::persistent::size/1
+
+.function: main/0
+    import "std/persistent"
+
+    frame %0
+    call %1 local std::persistent::vector/0
+    izero %2 local
+    integer %3 local 1100
+
+    ; enough elements for the tree to grow a second level of internal nodes
+    .mark: pushing
+    if (gte %4 local %2 local %3 local) local pushed +1
+    frame ^[(param %0 %1 local) (param %1 %2 local)]
+    call %1 local std::persistent::push/2
+    iinc %2 local
+    jump pushing
+
+    .mark: pushed
+    frame ^[(param %0 %1 local)]
+    print (call %5 local std::persistent::size/1) local
+
+    integer %6 local 1055
+    frame ^[(param %0 %1 local) (param %1 %6 local)]
+    print (call %5 local std::persistent::at/2) local
+
+    integer %6 local 1099
+    frame ^[(param %0 %1 local) (param %1 %6 local)]
+    print (call %5 local std::persistent::at/2) local
+
+    integer %6 local 1050
+    integer %7 local -1
+    frame ^[(param %0 %1 local) (param %1 %6 local) (param %2 %7 local)]
+    call %8 local std::persistent::set/3
+    frame ^[(param %0 %8 local) (param %1 %6 local)]
+    print (call %5 local std::persistent::at/2) local
+    frame ^[(param %0 %1 local) (param %1 %6 local)]
+    print (call %5 local std::persistent::at/2) local
+
+    ; popping shrinks the tree back
+    copy %9 local %1 local
+    integer %3 local 1000
+    .mark: popping
+    if (lte %4 local %2 local %3 local) local popped +1
+    frame ^[(param %0 %9 local)]
+    call %9 local std::persistent::pop/1
+    idec %2 local
+    jump popping
+
+    .mark: popped
+    frame ^[(param %0 %9 local)]
+    print (call %5 local std::persistent::size/1) local
+    integer %6 local 999
+    frame ^[(param %0 %9 local) (param %1 %6 local)]
+    print (call %5 local std::persistent::at/2) local
+    frame ^[(param %0 %1 local)]
+    print (call %5 local std::persistent::size/1) local
+
+    izero %0 local
+    return
+.end
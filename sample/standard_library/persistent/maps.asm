@@ -0,0 +1,68 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::persistent::map/0
+.signature: std::persistent::insert/3
+.signature: std::persistent::remove/2
+.signature: std::persistent::lookup/2
+.signature: std::persistent::contains/2
+.signature: std::persistent::size/1
+
+.function: main/0
+    import "std/persistent"
+
+    frame %0
+    call %1 local std::persistent::map/0
+
+    string %8 local "answer"
+    integer %9 local 42
+    frame ^[(param %0 %1 local) (param %1 %8 local) (param %2 %9 local)]
+    call %1 local std::persistent::insert/3
+
+    atom %8 local 'answer'
+    integer %9 local 43
+    frame ^[(param %0 %1 local) (param %1 %8 local) (param %2 %9 local)]
+    call %1 local std::persistent::insert/3
+
+    integer %8 local 42
+    string %9 local "the answer"
+    frame ^[(param %0 %1 local) (param %1 %8 local) (param %2 %9 local)]
+    call %1 local std::persistent::insert/3
+
+    string %8 local "answer"
+    frame ^[(param %0 %1 local) (param %1 %8 local)]
+    call %2 local std::persistent::remove/2
+
+    frame ^[(param %0 %1 local)]
+    print (call %3 local std::persistent::size/1) local
+    frame ^[(param %0 %2 local)]
+    print (call %3 local std::persistent::size/1) local
+
+    frame ^[(param %0 %1 local) (param %1 %8 local)]
+    print (call %3 local std::persistent::lookup/2) local
+    frame ^[(param %0 %2 local) (param %1 %8 local)]
+    print (call %3 local std::persistent::contains/2) local
+
+    integer %8 local 42
+    frame ^[(param %0 %2 local) (param %1 %8 local)]
+    print (call %3 local std::persistent::lookup/2) local
+
+    izero %0 local
+    return
+.end
@@ -0,0 +1,62 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+.signature: std::persistent::set/3
+
+.function: listener/0
+    import "std/persistent"
+
+    receive %1 local infinity
+    integer %2 local 1
+    integer %3 local 42
+    frame ^[(param %0 %1 local) (param %1 %2 local) (param %2 %3 local)]
+    call %4 local std::persistent::set/3
+    print %1 local
+    print %4 local
+    return
+.end
+
+.function: main/0
+    import "std/persistent"
+
+    frame %0
+    call %1 local std::persistent::vector/0
+    string %2 local "Hello"
+    frame ^[(param %0 %1 local) (param %1 %2 local)]
+    call %1 local std::persistent::push/2
+    string %2 local "World"
+    frame ^[(param %0 %1 local) (param %1 %2 local)]
+    call %1 local std::persistent::push/2
+
+    frame %0
+    process %3 local listener/0
+
+    ; sending copies only the root of the vector, and both processes share
+    ; its nodes afterwards
+    copy %4 local %1 local
+    send %3 local %4 local
+    join void %3 local
+
+    print %1 local
+
+    izero %0 local
+    return
+.end
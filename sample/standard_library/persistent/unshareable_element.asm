@@ -0,0 +1,34 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+
+.function: main/0
+    import "std/persistent"
+
+    frame %0
+    call %1 local std::persistent::vector/0
+    vector %2 local
+    frame ^[(param %0 %1 local) (param %1 %2 local)]
+    call %1 local std::persistent::push/2
+
+    izero %0 local
+    return
+.end
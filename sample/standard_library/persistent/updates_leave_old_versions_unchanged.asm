@@ -0,0 +1,59 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+.signature: std::persistent::pop/1
+.signature: std::persistent::set/3
+
+.function: main/0
+    import "std/persistent"
+
+    frame %0
+    call %1 local std::persistent::vector/0
+    integer %9 local 1
+    frame ^[(param %0 %1 local) (param %1 %9 local)]
+    call %1 local std::persistent::push/2
+    integer %9 local 2
+    frame ^[(param %0 %1 local) (param %1 %9 local)]
+    call %1 local std::persistent::push/2
+    integer %9 local 3
+    frame ^[(param %0 %1 local) (param %1 %9 local)]
+    call %1 local std::persistent::push/2
+
+    integer %9 local 4
+    frame ^[(param %0 %1 local) (param %1 %9 local)]
+    call %2 local std::persistent::push/2
+
+    izero %8 local
+    integer %9 local 10
+    frame ^[(param %0 %2 local) (param %1 %8 local) (param %2 %9 local)]
+    call %3 local std::persistent::set/3
+
+    frame ^[(param %0 %3 local)]
+    call %4 local std::persistent::pop/1
+
+    print %1 local
+    print %2 local
+    print %3 local
+    print %4 local
+
+    izero %0 local
+    return
+.end
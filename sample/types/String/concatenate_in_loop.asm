@@ -0,0 +1,53 @@
+;
+;   Copyright (C) 2018 Marek Marecki
+;
+;   This file is part of Viua VM.
+;
+;   Viua VM is free software: you can redistribute it and/or modify
+;   it under the terms of the GNU General Public License as published by
+;   the Free Software Foundation, either version 3 of the License, or
+;   (at your option) any later version.
+;
+;   Viua VM is distributed in the hope that it will be useful,
+;   but WITHOUT ANY WARRANTY; without even the implied warranty of
+;   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;   GNU General Public License for more details.
+;
+;   You should have received a copy of the GNU General Public License
+;   along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+;
+
+.function: main/1
+    string %1 local ""
+    izero %2 local
+    integer %3 local 20000
+
+    ; concatenation does not copy either operand so building a long string
+    ; one piece at a time takes linear time
+    .mark: loop
+    if (gte %4 local %2 local %3 local) local done +1
+    string %5 local "0123456789"
+    frame ^[(param %0 %1 local) (param %1 %5 local)]
+    msg %1 local concatenate/2
+    iinc %2 local
+    jump loop
+
+    .mark: done
+    frame ^[(param %0 %1 local)]
+    msg %6 local size/1
+    print %6 local
+
+    integer %7 local 199990
+    integer %8 local 10
+    frame ^[(param %0 %1 local) (param %1 %7 local) (param %2 %8 local)]
+    msg %9 local substr/
+    print %9 local
+
+    integer %7 local -5
+    frame ^[(param %0 %1 local) (param %1 %7 local)]
+    msg %9 local substr/
+    print %9 local
+
+    izero %0 local
+    return
+.end
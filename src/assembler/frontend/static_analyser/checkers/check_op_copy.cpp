@@ -46,7 +46,8 @@ auto check_op_copy(Register_usage_profile& register_usage_profile,
             register_usage_profile, *source);
 
     auto val       = Register(*target);
-    val.value_type = type_of_source;
+    val.value_type   = type_of_source;
+    val.element_type = element_type_of(register_usage_profile, *source);
     register_usage_profile.define(val, target->tokens.at(0));
 }
 }}}}}  // namespace viua::assembler::frontend::static_analyser::checkers
@@ -46,6 +46,7 @@ auto check_op_move(Register_usage_profile& register_usage_profile,
 
     auto val       = Register(*target);
     val.value_type = register_usage_profile.at(*source).second.value_type;
+    val.element_type = element_type_of(register_usage_profile, *source);
     register_usage_profile.define(val, target->tokens.at(0));
 
     erase_if_direct_access(register_usage_profile, source, instruction);
@@ -55,8 +55,14 @@ auto check_op_vat(Register_usage_profile& register_usage_profile,
     assert_type_of_register<viua::internals::ValueTypes::INTEGER>(
         register_usage_profile, *key);
 
+    /*
+     * Typed vectors produce copies of their elements instead of pointers.
+     */
+    auto const element_type = element_type_of(register_usage_profile, *source);
+
     auto val       = Register(*result);
-    val.value_type = ValueTypes::POINTER;
+    val.value_type = (element_type == ValueTypes::UNDEFINED ? ValueTypes::POINTER
+                                                            : element_type);
     register_usage_profile.define(val, result->tokens.at(0));
 }
 }}}}}  // namespace viua::assembler::frontend::static_analyser::checkers
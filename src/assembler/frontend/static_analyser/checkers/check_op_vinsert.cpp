@@ -56,6 +56,7 @@ auto check_op_vinsert(Register_usage_profile& register_usage_profile,
     }
 
     check_use_of_register(register_usage_profile, *source);
+    assert_type_of_element(register_usage_profile, *result, *source);
 
     if (key) {
         check_use_of_register(register_usage_profile, *key);
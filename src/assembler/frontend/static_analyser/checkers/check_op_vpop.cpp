@@ -64,7 +64,8 @@ auto check_op_vpop(Register_usage_profile& register_usage_profile,
     }
 
     if (result) {
-        auto val = Register(*result);
+        auto val       = Register(*result);
+        val.value_type = element_type_of(register_usage_profile, *source);
         register_usage_profile.define(val, result->tokens.at(0));
     }
 }
@@ -45,6 +45,7 @@ auto check_op_vpush(Register_usage_profile& register_usage_profile,
     }
 
     check_use_of_register(register_usage_profile, *source);
+    assert_type_of_element(register_usage_profile, *target, *source);
     erase_if_direct_access(register_usage_profile, source, instruction);
 }
 }}}}}  // namespace viua::assembler::frontend::static_analyser::checkers
@@ -198,6 +198,20 @@ auto check_use_of_register(Register_usage_profile& rup,
     }
     rup.use(Register(r), r.tokens.at(0));
 }
+auto element_type_of(Register_usage_profile const& rup,
+                     viua::assembler::frontend::parser::RegisterIndex const& r)
+    -> viua::internals::ValueTypes {
+    /*
+     * Element types are only tracked for vectors held directly in local
+     * registers.
+     */
+    if (r.rss == RegisterSets::GLOBAL
+        or r.as == viua::internals::AccessSpecifier::POINTER_DEREFERENCE
+        or not rup.defined(Register(r))) {
+        return viua::internals::ValueTypes::UNDEFINED;
+    }
+    return rup.at(Register(r)).second.element_type;
+}
 
 using ValueTypes            = viua::internals::ValueTypes;
 using ValueTypesType        = viua::internals::ValueTypesType;
@@ -277,6 +291,14 @@ auto const value_type_names = std::map<ValueTypes, std::string>{
         ValueTypes::OBJECT,
         "object",
     },
+    {
+        ValueTypes::HASHMAP,
+        "hashmap",
+    },
+    {
+        ValueTypes::COROUTINE,
+        "coroutine",
+    },
 };
 auto operator|(const ValueTypes lhs, const ValueTypes rhs) -> ValueTypes {
     // FIXME find out if it is possible to remove the outermost static_cast<>
@@ -307,4 +329,14 @@ auto depointerise_type_if_needed(ValueTypes const t,
     -> ValueTypes {
     return (access_via_pointer_dereference ? (t ^ ValueTypes::POINTER) : t);
 }
+auto assert_type_of_element(Register_usage_profile& rup,
+                            RegisterIndex const& vector,
+                            RegisterIndex const& element) -> void {
+    auto const element_type = element_type_of(rup, vector);
+    if (element_type == ValueTypes::INTEGER) {
+        assert_type_of_register<ValueTypes::INTEGER>(rup, element);
+    } else if (element_type == ValueTypes::FLOAT) {
+        assert_type_of_register<ValueTypes::FLOAT>(rup, element);
+    }
+}
 }}}}}  // namespace viua::assembler::frontend::static_analyser::checkers
@@ -231,6 +231,9 @@ auto check_register_usage_for_instruction_block_impl(
             case VECTOR:
                 check_op_vector(register_usage_profile, *instruction);
                 break;
+            case VECTOROF:
+                check_op_vectorof(register_usage_profile, *instruction);
+                break;
             case VINSERT:
                 check_op_vinsert(register_usage_profile, *instruction);
                 break;
@@ -373,9 +376,36 @@ auto check_register_usage_for_instruction_block_impl(
             case RECEIVE:
                 check_op_receive(register_usage_profile, *instruction);
                 break;
+            case SENDALL:
+                check_op_sendall(register_usage_profile, *instruction);
+                break;
+            case BROADCAST:
+                check_op_broadcast(register_usage_profile, *instruction);
+                break;
+            case RECEIVEMANY:
+                check_op_receivemany(register_usage_profile, *instruction);
+                break;
+            case RECEIVEMATCH:
+                check_op_receivematch(register_usage_profile, *instruction);
+                break;
+            case SLEEP:
+                check_op_sleep(register_usage_profile, *instruction);
+                break;
+            case PRIORITY:
+                check_op_priority(register_usage_profile, *instruction);
+                break;
             case WATCHDOG:
                 check_op_watchdog(register_usage_profile, *instruction);
                 break;
+            case COROUTINE:
+                check_op_coroutine(register_usage_profile, *instruction);
+                break;
+            case RESUME:
+                check_op_resume(register_usage_profile, *instruction);
+                break;
+            case YIELD:
+                check_op_yield(register_usage_profile, *instruction);
+                break;
             case JUMP:
                 check_op_jump(register_usage_profile,
                               ps,
@@ -465,6 +495,27 @@ auto check_register_usage_for_instruction_block_impl(
             case STRUCTKEYS:
                 check_op_structkeys(register_usage_profile, *instruction);
                 break;
+            case HASHMAP:
+                check_op_hashmap(register_usage_profile, *instruction);
+                break;
+            case HASHMAPINSERT:
+                check_op_hashmapinsert(register_usage_profile, *instruction);
+                break;
+            case HASHMAPREMOVE:
+                check_op_hashmapremove(register_usage_profile, *instruction);
+                break;
+            case HASHMAPLOOKUP:
+                check_op_hashmaplookup(register_usage_profile, *instruction);
+                break;
+            case HASHMAPCONTAINS:
+                check_op_hashmapcontains(register_usage_profile, *instruction);
+                break;
+            case HASHMAPKEYS:
+                check_op_hashmapkeys(register_usage_profile, *instruction);
+                break;
+            case HASHMAPSIZE:
+                check_op_hashmapsize(register_usage_profile, *instruction);
+                break;
             case NEW:
                 check_op_new(register_usage_profile, *instruction);
                 break;
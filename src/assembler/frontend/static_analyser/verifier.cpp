@@ -186,14 +186,16 @@ auto viua::assembler::frontend::static_analyser::verify_frame_balance(
 
                 auto opcode = instruction->opcode;
                 if (not(opcode == CALL or opcode == TAILCALL or opcode == DEFER
-                        or opcode == PROCESS or opcode == FRAME or opcode == MSG
+                        or opcode == PROCESS or opcode == COROUTINE
+                        or opcode == FRAME or opcode == MSG
                         or opcode == RETURN or opcode == LEAVE
                         or opcode == THROW)) {
                     continue;
                 }
 
                 if (opcode == CALL or opcode == TAILCALL or opcode == DEFER
-                    or opcode == PROCESS or opcode == MSG) {
+                    or opcode == PROCESS or opcode == COROUTINE
+                    or opcode == MSG) {
                     --balance;
                 } else if (opcode == FRAME) {
                     ++balance;
@@ -245,7 +247,8 @@ auto viua::assembler::frontend::static_analyser::verify_function_call_arities(
 
                 auto opcode = instruction->opcode;
                 if (not(opcode == CALL or opcode == PROCESS or opcode == DEFER
-                        or opcode == MSG or opcode == FRAME)) {
+                        or opcode == COROUTINE or opcode == MSG
+                        or opcode == FRAME)) {
                     continue;
                 }
 
@@ -267,7 +270,8 @@ auto viua::assembler::frontend::static_analyser::verify_function_call_arities(
 
                 viua::assembler::frontend::parser::Operand* operand = nullptr;
                 Token operand_token;
-                if (opcode == CALL or opcode == PROCESS or opcode == MSG) {
+                if (opcode == CALL or opcode == PROCESS or opcode == COROUTINE
+                    or opcode == MSG) {
                     operand = instruction->operands.at(1).get();
                 } else if (opcode == DEFER) {
                     operand = instruction->operands.at(0).get();
@@ -353,7 +357,8 @@ auto viua::assembler::frontend::static_analyser::verify_frames_have_no_gaps(
 
                 auto opcode = instruction->opcode;
                 if (not(opcode == CALL or opcode == PROCESS or opcode == MSG
-                        or opcode == DEFER or opcode == FRAME or opcode == PARAM
+                        or opcode == DEFER or opcode == COROUTINE
+                        or opcode == FRAME or opcode == PARAM
                         or opcode == PAMV)) {
                     continue;
                 }
@@ -0,0 +1,754 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <viua/assembler/optimiser.h>
+#include <viua/support/string.h>
+using namespace std;
+
+
+using viua::cg::lex::Token;
+using viua::internals::types::register_index;
+using viua::assembler::optimiser::tokens::Token_index;
+using viua::assembler::optimiser::tokens::consumer_of_frame;
+using viua::assembler::optimiser::tokens::end_of_line;
+using viua::assembler::optimiser::tokens::index_of;
+using viua::assembler::optimiser::tokens::is_directive;
+using viua::assembler::optimiser::tokens::is_frame_consumer;
+using viua::assembler::optimiser::tokens::is_local_register_mention;
+
+
+/*
+ * Size of the local register set the entry function gives to the main
+ * function (see generate_entry_function() in src/front/asm/generate.cpp).
+ */
+static register_index const MAIN_FUNCTION_REGISTER_SET_SIZE = 16;
+
+/*
+ * A function is hot if at least one in this many calls made during the
+ * profiled run was made to it.
+ * Hot functions may be this many times bigger than the usual threshold and
+ * still be inlined.
+ */
+static viua::kernel::profile_counter_type const HOT_FUNCTION_SHARE = 16;
+static vector<Token>::size_type const HOT_FUNCTION_THRESHOLD_MULTIPLIER = 2;
+
+/*
+ * Instructions that may appear in inlined functions.
+ * None of them creates frames, jumps, throws on purpose, observes the
+ * process it runs in, or produces pointers or references; so executing them
+ * inside of the caller's frame is indistinguishable from executing them
+ * inside of a frame of their own.
+ */
+static set<string> const INLINABLE = {
+    "izero",
+    "integer",
+    "iinc",
+    "idec",
+    "float",
+    "itof",
+    "ftoi",
+    "stoi",
+    "stof",
+    "add",
+    "sub",
+    "mul",
+    "div",
+    "lt",
+    "lte",
+    "gt",
+    "gte",
+    "eq",
+    "string",
+    "streq",
+    "text",
+    "texteq",
+    "textat",
+    "textsub",
+    "textlength",
+    "textcommonprefix",
+    "textcommonsuffix",
+    "textconcat",
+    "vector",
+    "vectorof",
+    "vpush",
+    "vlen",
+    "not",
+    "and",
+    "or",
+    "bits",
+    "bitand",
+    "bitor",
+    "bitnot",
+    "bitxor",
+    "atom",
+    "atomeq",
+    "move",
+    "copy",
+    "delete",
+    "print",
+    "echo",
+    "arg",
+};
+
+/*
+ * Blocks share the register set of the function that enters them so
+ * registers used by them are not visible when looking at the function alone.
+ */
+static set<string> const BLOCK_INSTRUCTIONS = {
+    "try",
+    "catch",
+    "enter",
+    "leave",
+    "draw",
+};
+
+/*
+ * Instructions whose first operand is only read.
+ */
+static set<string> const READ_ONLY_TARGET = {
+    "iinc",
+    "idec",
+    "vpush",
+    "delete",
+    "print",
+    "echo",
+};
+
+
+namespace {
+/*
+ * A function that can be inlined, with its instructions split into lines.
+ */
+struct Leaf {
+    vector<vector<Token>> body;
+    register_index size = 0;
+    set<register_index> arguments;
+
+    /*
+     * Local registers which hold values when the function returns.
+     * They must be emptied after the inlined body so that the next execution
+     * of the same inlined body finds them empty just as a fresh frame would.
+     */
+    set<register_index> full_on_return;
+};
+}  // namespace
+
+
+static auto is_register_token(Token const& token) -> bool {
+    auto const& s = token.str();
+    return (s.size() > 1
+            and (s.at(0) == '%' or s.at(0) == '*' or s.at(0) == '@')
+            and str::isnum(s.substr(1), false));
+}
+
+static auto gather_leaf(vector<Token> const& tokens,
+                        vector<Token>::size_type const threshold,
+                        Leaf& leaf) -> bool {
+    auto full         = set<register_index>{};
+    auto returned     = false;
+    auto instructions = vector<Token>::size_type{0};
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        auto const& mnemonic = tokens.at(i);
+        if (mnemonic == "\n" or mnemonic == ".name:"
+            or mnemonic == ".unused:") {
+            continue;
+        }
+        if (returned or is_directive(mnemonic)) {
+            return false;
+        }
+        if (++instructions > threshold) {
+            return false;
+        }
+
+        auto const eol = end_of_line(tokens, i);
+        if (mnemonic == "return") {
+            if (eol != i + 1) {
+                return false;
+            }
+            returned = true;
+            continue;
+        }
+        if (not INLINABLE.count(mnemonic.str())) {
+            return false;
+        }
+
+        auto mentions = vector<register_index>{};
+        for (auto j = i + 1; j < eol; ++j) {
+            if (not is_register_token(tokens.at(j))) {
+                continue;
+            }
+            if (mnemonic == "vector" and j == i + 3) {
+                /*
+                 * Start of the packed range is ignored if no registers are
+                 * packed, and packing of registers is not supported.
+                 */
+                if (tokens.at(i + 5) != "%0") {
+                    return false;
+                }
+                ++j;
+                continue;
+            }
+            if (mnemonic == "vector" and j + 1 == eol) {
+                continue;
+            }
+            if (mnemonic == "arg" and j + 1 == eol) {
+                /*
+                 * Every argument must be received at most once because
+                 * arguments passed by move are gone after they are received.
+                 */
+                auto const index = index_of(tokens.at(j));
+                if (leaf.arguments.count(index)) {
+                    return false;
+                }
+                leaf.arguments.insert(index);
+                continue;
+            }
+
+            /*
+             * Only direct accesses to local registers are allowed.
+             * Static and global register sets are specific to the function,
+             * and pointer dereferences may reach outside of it.
+             */
+            if (tokens.at(j).str().at(0) != '%'
+                or not is_local_register_mention(tokens, j)) {
+                return false;
+            }
+            mentions.push_back(index_of(tokens.at(j)));
+            leaf.size = max(leaf.size, mentions.back() + 1);
+            ++j;
+        }
+
+        if (mnemonic == "delete") {
+            full.erase(mentions.at(0));
+        } else if ((mnemonic == "move" or mnemonic == "vpush")
+                   and mentions.size() == 2) {
+            full.erase(mentions.at(1));
+        }
+        if (is_register_token(tokens.at(i + 1))
+            and not READ_ONLY_TARGET.count(mnemonic.str())) {
+            full.insert(mentions.at(0));
+        }
+    }
+
+    if (not returned) {
+        return false;
+    }
+    leaf.full_on_return = std::move(full);
+
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        auto const& mnemonic = tokens.at(i);
+        if (mnemonic == "\n" or is_directive(mnemonic)
+            or mnemonic == "return") {
+            continue;
+        }
+        leaf.body.emplace_back(
+            tokens.begin() + static_cast<long>(i),
+            tokens.begin() + static_cast<long>(end_of_line(tokens, i)));
+    }
+    return true;
+}
+
+static auto local_register(Token const& origin, register_index const index)
+    -> vector<Token> {
+    return {Token{origin.line(), origin.character(), "%" + to_string(index)},
+            Token{origin.line(), origin.character(), "local"}};
+}
+
+static auto emit(vector<Token>& output,
+                 Token const& origin,
+                 string const& mnemonic,
+                 vector<vector<Token>> const& operands) -> void {
+    output.emplace_back(origin.line(), origin.character(), mnemonic);
+    for (auto const& each : operands) {
+        output.insert(output.end(), each.begin(), each.end());
+    }
+    output.emplace_back(origin.line(), origin.character(), "\n");
+}
+
+/*
+ * Returns the number of local registers a function uses, or zero if this
+ * cannot be determined.
+ */
+static auto registers_used_by(vector<Token> const& tokens) -> register_index {
+    auto used = register_index{1};
+    for (auto i = Token_index{0}; i < tokens.size(); ++i) {
+        if (not is_local_register_mention(tokens, i)) {
+            continue;
+        }
+        if (tokens.at(i).str().at(0) == '@') {
+            return 0;
+        }
+        auto last = index_of(tokens.at(i));
+        if (i >= 1 and tokens.at(i - 1) == "vector"
+            and is_register_token(tokens.at(i + 3))) {
+            last += index_of(tokens.at(i + 3));
+        }
+        used = max(used, last + 1);
+    }
+    return used;
+}
+
+/*
+ * Jumps to instruction indexes (as opposed to jumps to markers) would be
+ * broken by changing the number of instructions in a function.
+ * Only jumps to the next instruction stay valid.
+ */
+static auto uses_only_marker_jumps(vector<Token> const& tokens) -> bool {
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        auto targets = vector<Token_index>{};
+        if (tokens.at(i) == "jump") {
+            targets.push_back(i + 1);
+        } else if (tokens.at(i) == "if") {
+            targets.push_back(i + 3);
+            targets.push_back(i + 4);
+        }
+        for (auto const each : targets) {
+            auto const& target = tokens.at(each).str();
+            if (target == "+1") {
+                continue;
+            }
+            if (str::isnum(target, false) or target.at(0) == '+'
+                or target.at(0) == '-' or str::startswith(target, "0x")) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+namespace {
+struct Call_site {
+    Token_index frame;
+    Token_index call;
+    string callee;
+
+    /*
+     * Registers of the caller which hold parameters, and to which local
+     * registers of the inlined function are mapped.
+     */
+    register_index parameters;
+    register_index base;
+
+    /*
+     * Indexes of passed parameters.
+     */
+    set<register_index> passed;
+};
+}  // namespace
+
+static auto find_call_sites(vector<Token> const& tokens,
+                            map<string, Leaf> const& leaves,
+                            register_index const capacity,
+                            register_index& used)
+    -> map<Token_index, Call_site> {
+    auto sites = map<Token_index, Call_site>{};
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        if (tokens.at(i) != "frame") {
+            continue;
+        }
+        auto const consumer = consumer_of_frame(tokens, i);
+        if (consumer == tokens.size() or tokens.at(consumer) != "call") {
+            continue;
+        }
+        auto const callee = tokens.at(end_of_line(tokens, consumer) - 1).str();
+        if (not leaves.count(callee)) {
+            continue;
+        }
+
+        auto const& leaf     = leaves.at(callee);
+        auto const arguments = index_of(tokens.at(i + 1));
+
+        /*
+         * Only call sites which are guaranteed to succeed are inlined: each
+         * parameter must be passed exactly once, and every parameter the
+         * function receives must be passed.
+         */
+        auto passed          = set<register_index>{};
+        auto parameters_sane = true;
+        for (auto j = end_of_line(tokens, i) + 1; j < consumer;
+             j = end_of_line(tokens, j) + 1) {
+            if (tokens.at(j) != "param" and tokens.at(j) != "pamv") {
+                continue;
+            }
+            auto const index = index_of(tokens.at(j + 1));
+            parameters_sane =
+                parameters_sane and index < arguments
+                and passed.insert(index).second
+                and str::startswith(tokens.at(j + 2).str(), "%");
+        }
+        auto const all_arguments_passed =
+            all_of(leaf.arguments.begin(),
+                   leaf.arguments.end(),
+                   [&passed](register_index const each) {
+                       return passed.count(each) == 1;
+                   });
+        auto const returns_value = (tokens.at(consumer + 1) != "void");
+        if (not(parameters_sane and all_arguments_passed)) {
+            continue;
+        }
+        if (returns_value and not leaf.full_on_return.count(0)) {
+            continue;
+        }
+        if (used + arguments + leaf.size > capacity) {
+            continue;
+        }
+
+        auto site       = Call_site{};
+        site.frame      = i;
+        site.call       = consumer;
+        site.callee     = callee;
+        site.parameters = used;
+        site.base       = used + arguments;
+        site.passed     = std::move(passed);
+        sites[consumer] = std::move(site);
+
+        used += arguments + leaf.size;
+    }
+    return sites;
+}
+
+static auto inline_call_site(vector<Token>& output,
+                             vector<Token> const& tokens,
+                             Call_site const& site,
+                             Leaf const& leaf) -> void {
+    auto const& call = tokens.at(site.call);
+    auto passed      = site.passed;
+
+    auto const rename = [&call, &site](Token const& index) -> vector<Token> {
+        return local_register(call, site.base + index_of(index));
+    };
+
+    for (auto const& line : leaf.body) {
+        if (line.front() == "arg") {
+            auto const index     = index_of(line.back());
+            auto const parameter = local_register(call, site.parameters + index);
+            passed.erase(index);
+            if (line.at(1) == "void") {
+                emit(output, call, "delete", {parameter});
+            } else {
+                emit(output, call, "move", {rename(line.at(1)), parameter});
+            }
+            continue;
+        }
+
+        output.emplace_back(call.line(), call.character(), line.front().str());
+        for (auto j = Token_index{1}; j < line.size(); ++j) {
+            auto const is_vector_start =
+                (line.front() == "vector" and (j == 3 or j == 4));
+            if ((not is_vector_start) and is_local_register_mention(line, j)) {
+                auto const renamed = rename(line.at(j));
+                output.insert(output.end(), renamed.begin(), renamed.end());
+                ++j;
+                continue;
+            }
+            output.emplace_back(
+                call.line(), call.character(), line.at(j).str());
+        }
+        output.emplace_back(call.line(), call.character(), "\n");
+    }
+
+    /*
+     * Parameters that were passed but never received, and values left in
+     * local registers of the inlined function are destroyed just as they
+     * would be when the frame of the called function is dropped.
+     * The return value is moved to the register that would receive it.
+     */
+    for (auto const each : passed) {
+        emit(output,
+             call,
+             "delete",
+             {local_register(call, site.parameters + each)});
+    }
+    auto const returns_value = (tokens.at(site.call + 1) != "void");
+    for (auto const each : leaf.full_on_return) {
+        auto const renamed = local_register(call, site.base + each);
+        if (each == 0 and returns_value) {
+            emit(output,
+                 call,
+                 "move",
+                 {{tokens.at(site.call + 1), tokens.at(site.call + 2)},
+                  renamed});
+        } else {
+            emit(output, call, "delete", {renamed});
+        }
+    }
+}
+
+/*
+ * Inlines calls to given leaf functions into a function.
+ * Registers for parameters and for local registers of inlined functions
+ * are allocated above registers used by the caller, and are not shared
+ * between call sites (the register allocation pass may coalesce them later).
+ * The number of local registers the function needs after inlining is
+ * stored in the "used" parameter.
+ */
+static auto inline_into(vector<Token> const& tokens,
+                        map<string, Leaf> const& leaves,
+                        register_index const capacity,
+                        register_index& used) -> vector<Token> {
+    auto const sites = find_call_sites(tokens, leaves, capacity, used);
+    if (sites.empty()) {
+        return tokens;
+    }
+
+    auto frames = map<Token_index, Token_index>{};
+    for (auto const& each : sites) {
+        frames[each.second.frame] = each.first;
+    }
+
+    auto output = vector<Token>{};
+    auto site   = sites.end();
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        auto const eol = end_of_line(tokens, i);
+        if (frames.count(i)) {
+            site = sites.find(frames.at(i));
+            continue;
+        }
+
+        if (site != sites.end()
+            and (tokens.at(i) == "param" or tokens.at(i) == "pamv")) {
+            auto const parameter = local_register(
+                tokens.at(i),
+                site->second.parameters + index_of(tokens.at(i + 1)));
+            emit(output,
+                 tokens.at(i),
+                 (tokens.at(i) == "param" ? "copy" : "move"),
+                 {parameter, {tokens.at(i + 2), tokens.at(i + 3)}});
+            continue;
+        }
+
+        if (site != sites.end() and i == site->first) {
+            inline_call_site(
+                output, tokens, site->second, leaves.at(site->second.callee));
+            site = sites.end();
+            continue;
+        }
+
+        output.insert(output.end(),
+                      tokens.begin() + static_cast<long>(i),
+                      tokens.begin() + static_cast<long>(eol + 1));
+    }
+
+    return output;
+}
+
+/*
+ * Inlining makes local register sets of callers bigger, so frames for them
+ * must be enlarged.
+ * This is only possible if all frames in which a function may be called are
+ * known.
+ * A function is "closed" if it is only ever called by its name from call
+ * sites with frames that can be found, so it can not end up being called
+ * with a frame the assembler does not know about.
+ * Returns false if there are frames whose consumers cannot be found, as then
+ * no function is closed.
+ */
+static auto find_closed_functions(
+    viua::assembler::optimiser::Invocable_bodies const& functions,
+    vector<Token> const& tokens,
+    set<string>& closed) -> bool {
+    auto consumers = set<Token_index>{};
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        auto const eol = end_of_line(tokens, i);
+        if (tokens.at(i) == "frame") {
+            auto const consumer = consumer_of_frame(tokens, i);
+            if (consumer == tokens.size()
+                or not is_register_token(tokens.at(i + 2))) {
+                return false;
+            }
+            consumers.insert(consumer);
+        }
+
+        for (auto j = i; j < eol; ++j) {
+            if (not functions.count(tokens.at(j).str())) {
+                continue;
+            }
+            auto const called_by_name =
+                (j + 1 == eol and consumers.count(i)
+                 and tokens.at(i) != "tailcall" and tokens.at(i) != "msg");
+            if (not called_by_name) {
+                closed.erase(tokens.at(j).str());
+            }
+        }
+    }
+    return true;
+}
+
+static auto enlarge_frames(vector<Token>& tokens,
+                           string const& callee,
+                           register_index const needed) -> void {
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        if (tokens.at(i) != "frame") {
+            continue;
+        }
+        auto const consumer = consumer_of_frame(tokens, i);
+        if (consumer == tokens.size()
+            or tokens.at(end_of_line(tokens, consumer) - 1) != callee) {
+            continue;
+        }
+        if (index_of(tokens.at(i + 2)) < needed) {
+            tokens.at(i + 2).str("%" + to_string(needed));
+        }
+    }
+}
+
+/*
+ * Returns the size threshold for a function given its call count in the
+ * profile.
+ * Functions that receive a big enough share of all the calls made by the
+ * program are considered hot.
+ */
+static auto threshold_of(string const& name,
+                         vector<Token>::size_type const threshold,
+                         viua::kernel::Profile const* const profile)
+    -> vector<Token>::size_type {
+    if (not profile) {
+        return threshold;
+    }
+    auto const calls = profile->calls_of(name);
+    if (calls == 0) {
+        return 0;
+    }
+    if ((calls * HOT_FUNCTION_SHARE) >= profile->total_calls()) {
+        return (threshold * HOT_FUNCTION_THRESHOLD_MULTIPLIER);
+    }
+    return threshold;
+}
+
+static auto inline_leaves(
+    viua::assembler::optimiser::Invocable_bodies& functions,
+    viua::assembler::optimiser::Invocable_bodies& blocks,
+    set<string> const& closures,
+    vector<Token>::size_type const threshold,
+    viua::kernel::Profile const* const profile) -> bool {
+    auto leaves = map<string, Leaf>{};
+    for (auto const& each : functions) {
+        auto leaf = Leaf{};
+        if ((not closures.count(each.first))
+            and gather_leaf(each.second,
+                            threshold_of(each.first, threshold, profile),
+                            leaf)) {
+            leaves[each.first] = std::move(leaf);
+        }
+    }
+    if (leaves.empty()) {
+        return false;
+    }
+
+    auto closed = set<string>{};
+    for (auto const& each : functions) {
+        closed.insert(each.first);
+    }
+    for (auto const& each : functions) {
+        if (not find_closed_functions(functions, each.second, closed)) {
+            return false;
+        }
+    }
+    for (auto const& each : blocks) {
+        if (not find_closed_functions(functions, each.second, closed)) {
+            return false;
+        }
+    }
+
+    auto inlined = false;
+    for (auto& each : functions) {
+        auto const& name = each.first;
+        auto& tokens     = each.second;
+
+        auto const is_main =
+            (name == "main/0" or name == "main/1" or name == "main/2");
+        if (closures.count(name) or leaves.count(name)
+            or not(closed.count(name) or is_main)) {
+            continue;
+        }
+        if (not uses_only_marker_jumps(tokens)) {
+            continue;
+        }
+        if (any_of(tokens.begin(), tokens.end(), [](Token const& token) {
+                return BLOCK_INSTRUCTIONS.count(token.str());
+            })) {
+            continue;
+        }
+
+        auto used = registers_used_by(tokens);
+        if (not used) {
+            continue;
+        }
+        auto const used_before = used;
+        auto const capacity =
+            (is_main ? max(MAIN_FUNCTION_REGISTER_SET_SIZE, used)
+                     : numeric_limits<register_index>::max());
+        tokens = inline_into(tokens, leaves, capacity, used);
+        if (used == used_before) {
+            continue;
+        }
+        inlined = true;
+
+        for (auto& caller : functions) {
+            enlarge_frames(caller.second, name, used);
+        }
+        for (auto& caller : blocks) {
+            enlarge_frames(caller.second, name, used);
+        }
+    }
+
+    return inlined;
+}
+
+
+namespace viua { namespace assembler { namespace optimiser {
+auto inline_calls(Invocable_bodies& functions,
+                  Invocable_bodies& blocks,
+                  set<string> const& closures,
+                  bool const as_library,
+                  vector<Token>::size_type const threshold,
+                  viua::kernel::Profile const* const profile) -> void {
+    /*
+     * Functions of a library may be called by code that is not visible to
+     * the assembler so it is impossible to make sure that the frames they get
+     * are big enough to hold registers of inlined functions.
+     */
+    if (as_library) {
+        return;
+    }
+
+    /*
+     * Inlining a function may turn its caller into a leaf function, so the
+     * process is repeated until there is nothing more to inline.
+     */
+    for (auto inlined = true; inlined;) {
+        inlined =
+            inline_leaves(functions, blocks, closures, threshold, profile);
+    }
+}
+}}}  // namespace viua::assembler::optimiser
@@ -0,0 +1,42 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <viua/assembler/optimiser.h>
+using namespace std;
+
+
+namespace viua { namespace assembler { namespace optimiser {
+auto order_by_profile(vector<string>& names,
+                      viua::kernel::Profile const& profile) -> void {
+    /*
+     * Placing functions that call each other often next to each other keeps
+     * the hot part of the bytecode small, so it stays in cache.
+     * Functions that were never called during the profiled run end up at the
+     * end of the bytecode, out of the way.
+     */
+    stable_sort(names.begin(),
+                names.end(),
+                [&profile](string const& lhs, string const& rhs) -> bool {
+                    return (profile.calls_of(lhs) > profile.calls_of(rhs));
+                });
+}
+}}}  // namespace viua::assembler::optimiser
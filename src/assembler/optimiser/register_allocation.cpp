@@ -0,0 +1,613 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+#include <viua/assembler/optimiser.h>
+#include <viua/cg/assembler/assembler.h>
+#include <viua/support/string.h>
+using namespace std;
+
+
+using viua::cg::lex::Token;
+using viua::internals::types::register_index;
+using Instruction_index = vector<Token>::size_type;
+using viua::assembler::optimiser::tokens::Token_index;
+using viua::assembler::optimiser::tokens::consumer_of_frame;
+using viua::assembler::optimiser::tokens::end_of_line;
+using viua::assembler::optimiser::tokens::index_of;
+using viua::assembler::optimiser::tokens::is_directive;
+using viua::assembler::optimiser::tokens::is_local_register_mention;
+using viua::assembler::optimiser::tokens::is_terminator;
+
+
+/*
+ * Instructions which write a fresh value to the register given as their first
+ * operand without reading it first.
+ * The values they produce are never references so it is safe to overwrite
+ * them once they are dead.
+ */
+static set<string> const PURE_PRODUCERS = {
+    "izero",
+    "integer",
+    "float",
+    "itof",
+    "ftoi",
+    "stoi",
+    "stof",
+    "add",
+    "sub",
+    "mul",
+    "div",
+    "lt",
+    "lte",
+    "gt",
+    "gte",
+    "eq",
+    "string",
+    "streq",
+    "text",
+    "texteq",
+    "textat",
+    "textsub",
+    "textlength",
+    "textcommonprefix",
+    "textcommonsuffix",
+    "textconcat",
+    "vector",
+    "vectorof",
+    "vlen",
+    "receivemany",
+    "not",
+    "and",
+    "or",
+    "bits",
+    "bitand",
+    "bitor",
+    "bitnot",
+    "bitxor",
+    "bitswidth",
+    "bitat",
+    "bitseq",
+    "bitslt",
+    "bitslte",
+    "bitsgt",
+    "bitsgte",
+    "bitaeq",
+    "bitalt",
+    "bitalte",
+    "bitagt",
+    "bitagte",
+    "wrapadd",
+    "wrapsub",
+    "wrapmul",
+    "wrapdiv",
+    "checkedsadd",
+    "checkedssub",
+    "checkedsmul",
+    "checkedsdiv",
+    "checkeduadd",
+    "checkedusub",
+    "checkedumul",
+    "checkedudiv",
+    "saturatingsadd",
+    "saturatingssub",
+    "saturatingsmul",
+    "saturatingsdiv",
+    "saturatinguadd",
+    "saturatingusub",
+    "saturatingumul",
+    "saturatingudiv",
+    "atom",
+    "atomeq",
+    "struct",
+    "structkeys",
+    "hashmap",
+    "hashmapcontains",
+    "hashmapkeys",
+    "hashmapsize",
+    "closure",
+    "function",
+    "ptr",
+    "isnull",
+    "self",
+    "process",
+    "coroutine",
+    "argc",
+    "new",
+};
+
+/*
+ * Instructions which write a value to the register given as their first
+ * operand without reading it first, but the value may be a reference (e.g.
+ * a value returned from a closure that captured by reference).
+ * Overwriting a reference rebinds it, so once such a register dies its index
+ * must not be given to any other register.
+ */
+static set<string> const IMPURE_PRODUCERS = {
+    "move",
+    "copy",
+    "call",
+    "msg",
+    "arg",
+    "receive",
+    "receivematch",
+    "join",
+    "vpop",
+    "vat",
+    "remove",
+    "structremove",
+    "hashmapremove",
+    "hashmaplookup",
+    "resume",
+};
+
+/*
+ * Instructions whose source registers must keep their values for the rest
+ * of the function: "ptr", "vat", and "hashmaplookup" create pointers to them, "capture" turns
+ * them into references shared with a closure, and "isnull" observes whether
+ * a register is empty so it must not see leftovers of other registers.
+ */
+static set<string> const PINS_SOURCE_REGISTERS = {
+    "ptr",
+    "vat",
+    "hashmaplookup",
+    "capture",
+    "isnull",
+};
+
+/*
+ * Blocks share the register set of the function that enters them, and
+ * register usage inside them is not visible when looking at the function
+ * alone.
+ */
+static set<string> const BLOCK_INSTRUCTIONS = {
+    "try",
+    "catch",
+    "enter",
+    "leave",
+    "draw",
+};
+
+
+namespace {
+struct Mention {
+    Token_index token;
+    register_index index;
+};
+
+struct Instruction {
+    Token_index mnemonic;
+    vector<Mention> mentions;
+    set<register_index> uses;
+    set<register_index> kills;
+    vector<Instruction_index> successors;
+};
+
+struct Register_info {
+    Token_index first_mention   = 0;
+    bool exclusive              = false;
+    set<register_index> interferes_with;
+};
+}  // namespace
+
+
+namespace viua { namespace assembler { namespace optimiser {
+auto allocate_registers(vector<Token>& tokens) -> register_index {
+    auto instructions = vector<Instruction>{};
+    auto registers    = map<register_index, Register_info>{};
+
+    /*
+     * Control flow can only be reconstructed if all jumps can be resolved to
+     * instruction indexes.
+     * If it cannot, registers are still renumbered, but never share indexes.
+     */
+    auto control_flow_known = true;
+
+    /*
+     * First, gather register mentions for every instruction.
+     */
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        if (tokens.at(i) == "\n") {
+            continue;
+        }
+        if (is_directive(tokens.at(i))) {
+            /*
+             * Markers are resolved by counting lines, and only ".name:" and
+             * ".mark:" lines are not counted.
+             * Any other directive makes jumps to markers unreliable.
+             */
+            if (tokens.at(i) != ".name:" and tokens.at(i) != ".mark:") {
+                control_flow_known = false;
+            }
+            continue;
+        }
+
+        auto const mnemonic = tokens.at(i).str();
+        if (BLOCK_INSTRUCTIONS.count(mnemonic)) {
+            return 0;
+        }
+
+        auto instruction     = Instruction{};
+        instruction.mnemonic = i;
+
+        auto const eol = end_of_line(tokens, i);
+        for (auto j = i + 1; j < eol; ++j) {
+            if (not is_local_register_mention(tokens, j)) {
+                continue;
+            }
+            if (tokens.at(j).str().at(0) == '@') {
+                /*
+                 * Register-indirect accesses select registers at runtime so
+                 * it is impossible to tell which registers are used.
+                 */
+                return 0;
+            }
+
+            if (mnemonic == "vector" and j == i + 3) {
+                /*
+                 * Packing takes a range of registers which would have to
+                 * remain contiguous after renumbering.
+                 * Empty packs are fine, though, and their start register is
+                 * not really used.
+                 */
+                if (eol > i + 5 and tokens.at(i + 5) != "%0") {
+                    return 0;
+                }
+                continue;
+            }
+
+            auto const index = index_of(tokens.at(j));
+            instruction.mentions.push_back(Mention{j, index});
+            if (not registers.count(index)) {
+                registers[index].first_mention = j;
+            }
+
+            auto const is_target = (j == i + 1);
+            auto const direct    = (tokens.at(j).str().at(0) == '%');
+            if (is_target and direct
+                and (PURE_PRODUCERS.count(mnemonic)
+                     or IMPURE_PRODUCERS.count(mnemonic))) {
+                instruction.kills.insert(index);
+            } else {
+                instruction.uses.insert(index);
+            }
+
+            if (is_target and IMPURE_PRODUCERS.count(mnemonic)) {
+                registers[index].exclusive = true;
+            }
+            if ((not is_target) and PINS_SOURCE_REGISTERS.count(mnemonic)) {
+                registers[index].exclusive = true;
+            }
+            if (mnemonic == "swap") {
+                registers[index].exclusive = true;
+            }
+        }
+
+        if (mnemonic == "return") {
+            /*
+             * Return value is implicitly read from local register 0.
+             */
+            instruction.uses.insert(0);
+        }
+
+        instructions.push_back(std::move(instruction));
+    }
+
+    /*
+     * Then, reconstruct the control flow graph.
+     */
+    auto const marks = ::assembler::ce::getmarks(tokens);
+    auto resolve     = [&marks, &instructions](Token const& target,
+                                           Instruction_index const current,
+                                           vector<Instruction_index>& out)
+        -> bool {
+        auto const s = target.str();
+        auto destination = Instruction_index{0};
+        if (str::isnum(s, false)) {
+            destination = stoul(s);
+        } else if (s.at(0) == '+' and str::isnum(s.substr(1), false)) {
+            destination = current + stoul(s.substr(1));
+        } else if (s.at(0) == '-' and str::isnum(s.substr(1), false)) {
+            auto const back = stoul(s.substr(1));
+            if (back > current) {
+                return false;
+            }
+            destination = current - back;
+        } else if (marks.count(s)) {
+            destination = marks.at(s);
+        } else {
+            return false;
+        }
+        if (destination < instructions.size()) {
+            out.push_back(destination);
+        }
+        return true;
+    };
+    for (auto i = Instruction_index{0};
+         control_flow_known and i < instructions.size();
+         ++i) {
+        auto& instruction  = instructions.at(i);
+        auto const& mnemonic = tokens.at(instruction.mnemonic);
+        if (mnemonic == "jump") {
+            control_flow_known = resolve(
+                tokens.at(instruction.mnemonic + 1), i, instruction.successors);
+        } else if (mnemonic == "if") {
+            control_flow_known =
+                resolve(tokens.at(instruction.mnemonic + 3),
+                        i,
+                        instruction.successors)
+                and resolve(tokens.at(instruction.mnemonic + 4),
+                            i,
+                            instruction.successors);
+        } else if (not is_terminator(tokens.at(instruction.mnemonic))
+                   and (i + 1) < instructions.size()) {
+            instruction.successors.push_back(i + 1);
+        }
+    }
+
+    /*
+     * Compute liveness and register interference.
+     * Two registers interfere if they are both occupied (live, or mentioned)
+     * at any single instruction.
+     */
+    if (control_flow_known) {
+        auto live_in  = vector<set<register_index>>(instructions.size());
+        auto live_out = vector<set<register_index>>(instructions.size());
+
+        auto changed = true;
+        while (changed) {
+            changed = false;
+            for (auto i = instructions.size(); i > 0; --i) {
+                auto const& instruction = instructions.at(i - 1);
+
+                auto out = set<register_index>{};
+                for (auto const each : instruction.successors) {
+                    out.insert(live_in.at(each).begin(), live_in.at(each).end());
+                }
+
+                auto in = instruction.uses;
+                for (auto const each : out) {
+                    if (not instruction.kills.count(each)) {
+                        in.insert(each);
+                    }
+                }
+
+                if (in != live_in.at(i - 1) or out != live_out.at(i - 1)) {
+                    live_in.at(i - 1)  = std::move(in);
+                    live_out.at(i - 1) = std::move(out);
+                    changed            = true;
+                }
+            }
+        }
+
+        for (auto i = Instruction_index{0}; i < instructions.size(); ++i) {
+            auto occupied = live_in.at(i);
+            occupied.insert(live_out.at(i).begin(), live_out.at(i).end());
+            for (auto const& each : instructions.at(i).mentions) {
+                occupied.insert(each.index);
+            }
+            for (auto const a : occupied) {
+                for (auto const b : occupied) {
+                    if (a != b and registers.count(a)) {
+                        registers.at(a).interferes_with.insert(b);
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * Assign new indexes in the order in which registers are first mentioned.
+     * Register 0 holds the return value so it always stays where it is.
+     */
+    auto order = vector<register_index>{};
+    for (auto const& each : registers) {
+        order.push_back(each.first);
+    }
+    sort(order.begin(), order.end(), [&registers](auto const a, auto const b) {
+        return registers.at(a).first_mention < registers.at(b).first_mention;
+    });
+
+    auto assigned  = map<register_index, register_index>{};
+    auto occupants = vector<vector<register_index>>{{}};
+    for (auto const each : order) {
+        if (each == 0) {
+            assigned[0] = 0;
+            continue;
+        }
+
+        auto const& info = registers.at(each);
+        auto chosen      = static_cast<register_index>(occupants.size());
+        if (control_flow_known and not info.exclusive) {
+            for (auto c = register_index{1}; c < occupants.size(); ++c) {
+                auto const& sharing = occupants.at(c);
+                auto const compatible = all_of(
+                    sharing.begin(),
+                    sharing.end(),
+                    [&registers, &info](auto const other) {
+                        return not registers.at(other).exclusive
+                               and not info.interferes_with.count(other);
+                    });
+                if (compatible) {
+                    chosen = c;
+                    break;
+                }
+            }
+        }
+        if (chosen == occupants.size()) {
+            occupants.emplace_back();
+        }
+        occupants.at(chosen).push_back(each);
+        assigned[each] = chosen;
+    }
+
+    /*
+     * Finally, rewrite the function.
+     */
+    for (auto const& instruction : instructions) {
+        for (auto const& each : instruction.mentions) {
+            auto& token = tokens.at(each.token);
+            token.str(token.str().substr(0, 1)
+                      + to_string(assigned.at(each.index)));
+        }
+        if (tokens.at(instruction.mnemonic) == "vector"
+            and is_local_register_mention(tokens, instruction.mnemonic + 3)) {
+            tokens.at(instruction.mnemonic + 3).str("%0");
+        }
+    }
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        if (tokens.at(i) != ".name:" and tokens.at(i) != ".unused:") {
+            continue;
+        }
+        auto& token = tokens.at(i + 1);
+        auto const s = token.str();
+        auto const prefixed = (not s.empty() and s.at(0) == '%');
+        auto const digits   = (prefixed ? s.substr(1) : s);
+        if (not str::isnum(digits, false)) {
+            continue;
+        }
+        auto const index = static_cast<register_index>(stoul(digits));
+        if (assigned.count(index)) {
+            token.str((prefixed ? "%" : "") + to_string(assigned.at(index)));
+        }
+    }
+
+    return static_cast<register_index>(occupants.size());
+}
+
+auto shrink_frames(vector<Token>& tokens,
+                   map<string, register_index> const& sizes) -> void {
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        if (tokens.at(i) != "frame") {
+            continue;
+        }
+
+        auto& size_token = tokens.at(i + 2);
+        if (size_token.str().at(0) != '%'
+            or not str::isnum(size_token.str().substr(1), false)) {
+            continue;
+        }
+
+        auto const consumer = consumer_of_frame(tokens, i);
+        if (consumer == tokens.size() or tokens.at(consumer) == "msg") {
+            continue;
+        }
+        auto const callee = tokens.at(end_of_line(tokens, consumer) - 1).str();
+        if (not sizes.count(callee)) {
+            continue;
+        }
+
+        auto const requested = index_of(size_token);
+        auto const needed    = sizes.at(callee);
+        if (needed < requested) {
+            size_token.str("%" + to_string(needed));
+        }
+    }
+}
+
+static auto names_used_by(vector<Token> const& tokens, string const& mnemonic)
+    -> set<string> {
+    auto names = set<string>{};
+    for (auto i = Token_index{0}; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        if (tokens.at(i) == mnemonic) {
+            names.insert(tokens.at(end_of_line(tokens, i) - 1));
+        }
+    }
+    return names;
+}
+
+auto allocate_registers(Invocable_bodies& functions,
+                        Invocable_bodies& blocks,
+                        set<string> const& closures) -> void {
+    /*
+     * Functions may be instantiated as closures even if they were not
+     * declared as such, and then their register layout is dictated by the
+     * code capturing values into them.
+     */
+    auto instantiated = closures;
+    for (auto const& each : functions) {
+        auto const names = names_used_by(each.second, "closure");
+        instantiated.insert(names.begin(), names.end());
+    }
+    for (auto const& each : blocks) {
+        auto const names = names_used_by(each.second, "closure");
+        instantiated.insert(names.begin(), names.end());
+    }
+
+    auto sizes = map<string, register_index>{};
+    auto tail_calls = map<string, set<string>>{};
+    for (auto& each : functions) {
+        if (instantiated.count(each.first)) {
+            continue;
+        }
+        auto const needed = allocate_registers(each.second);
+
+        /*
+         * Closures get register sets of the same size as the register set of
+         * the function that created them so frames of such functions must be
+         * left alone.
+         */
+        if (needed and names_used_by(each.second, "closure").empty()) {
+            sizes[each.first]      = needed;
+            tail_calls[each.first] = names_used_by(each.second, "tailcall");
+        }
+    }
+
+    /*
+     * Tail called functions run in the local register set of the frame they
+     * replace so a function needs as many registers as any function it tail
+     * calls.
+     * If the tail called function is not known statically then the size of
+     * the frame must not be changed at all.
+     */
+    for (auto changed = true; changed;) {
+        changed = false;
+        for (auto const& each : tail_calls) {
+            if (not sizes.count(each.first)) {
+                continue;
+            }
+            for (auto const& callee : each.second) {
+                if (not sizes.count(callee)) {
+                    sizes.erase(each.first);
+                    changed = true;
+                    break;
+                }
+                if (sizes.at(callee) > sizes.at(each.first)) {
+                    sizes.at(each.first) = sizes.at(callee);
+                    changed              = true;
+                }
+            }
+        }
+    }
+
+    for (auto& each : functions) {
+        shrink_frames(each.second, sizes);
+    }
+    for (auto& each : blocks) {
+        shrink_frames(each.second, sizes);
+    }
+}
+}}}  // namespace viua::assembler::optimiser
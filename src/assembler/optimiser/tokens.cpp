@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <set>
+#include <string>
+#include <vector>
+#include <viua/assembler/optimiser.h>
+#include <viua/support/string.h>
+using namespace std;
+
+
+using viua::cg::lex::Token;
+using viua::internals::types::register_index;
+
+
+/*
+ * Instructions after which execution does not fall through to the next
+ * instruction.
+ */
+static set<string> const TERMINATORS = {
+    "return",
+    "halt",
+    "tailcall",
+    "throw",
+};
+
+/*
+ * Instructions which consume a frame prepared by "frame" instruction.
+ * All of them except "msg" may receive a function name as their last
+ * operand ("msg" receives a name of a method, and the function that is called
+ * is only known at runtime).
+ */
+static set<string> const FRAME_CONSUMERS = {
+    "call",
+    "tailcall",
+    "defer",
+    "process",
+    "watchdog",
+    "coroutine",
+    "msg",
+};
+
+
+namespace viua { namespace assembler { namespace optimiser { namespace tokens {
+auto end_of_line(vector<Token> const& tokens, Token_index i) -> Token_index {
+    while (i < tokens.size() and tokens.at(i) != "\n") {
+        ++i;
+    }
+    return i;
+}
+
+auto is_directive(Token const& token) -> bool {
+    return (token.str().at(0) == '.');
+}
+
+auto is_terminator(Token const& token) -> bool {
+    return TERMINATORS.count(token.str());
+}
+
+auto is_frame_consumer(Token const& token) -> bool {
+    return FRAME_CONSUMERS.count(token.str());
+}
+
+auto is_local_register_mention(vector<Token> const& tokens,
+                               Token_index const i) -> bool {
+    auto const& s = tokens.at(i).str();
+    if (s.size() < 2 or (s.at(0) != '%' and s.at(0) != '*' and s.at(0) != '@')) {
+        return false;
+    }
+    if (not str::isnum(s.substr(1), false)) {
+        return false;
+    }
+    if (i + 1 >= tokens.size()) {
+        return false;
+    }
+    return (tokens.at(i + 1) == "local" or tokens.at(i + 1) == "current");
+}
+
+auto index_of(Token const& token) -> register_index {
+    return static_cast<register_index>(stoul(token.str().substr(1)));
+}
+
+auto consumer_of_frame(vector<Token> const& tokens, Token_index const frame)
+    -> Token_index {
+    for (auto i = end_of_line(tokens, frame) + 1; i < tokens.size();
+         i = end_of_line(tokens, i) + 1) {
+        auto const& mnemonic = tokens.at(i);
+        if (is_frame_consumer(mnemonic)) {
+            return i;
+        }
+        if (mnemonic == "frame" or mnemonic == "jump" or mnemonic == "if"
+            or mnemonic == ".mark:" or is_terminator(mnemonic)) {
+            break;
+        }
+    }
+    return tokens.size();
+}
+}}}}  // namespace viua::assembler::optimiser::tokens
@@ -0,0 +1,281 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <viua/assembler/frontend/parser.h>
+#include <viua/assembler/util/compilation_cache.h>
+#include <viua/bytecode/maps.h>
+#include <viua/bytecode/operand_types.h>
+#include <viua/loader.h>
+#include <viua/support/env.h>
+#include <viua/util/memory.h>
+using namespace std;
+
+using viua::util::memory::aligned_write;
+
+
+static char const CACHE_ENTRY_MAGIC[] = "VIUAC";
+
+/*
+ * Version of the encoding of operands in bytecode.
+ * Bump it whenever the way operands are laid out in bytecode changes without
+ * a change in the opcode table (e.g. when an operand type is added, or when
+ * a size of an encoded value changes).
+ */
+static auto const ENCODING_VERSION = 1;
+
+/*
+ * FNV-1a is used to hash token streams.
+ * It is not a cryptographic hash, but it is fast, simple, and good enough to
+ * tell two versions of a function apart.
+ */
+using hash_type                    = uint64_t;
+static hash_type const FNV_OFFSET  = 14695981039346656037ull;
+static hash_type const FNV_PRIME   = 1099511628211ull;
+
+static auto fnv1a(hash_type h, string const& s) -> hash_type {
+    for (auto const each : s) {
+        h ^= static_cast<hash_type>(static_cast<unsigned char>(each));
+        h *= FNV_PRIME;
+    }
+    /*
+     * Mix in a separator so that token streams ["ab", "c"] and ["a", "bc"]
+     * produce different hashes.
+     */
+    h ^= hash_type{0};
+    h *= FNV_PRIME;
+    return h;
+}
+
+static auto to_hex(hash_type const h) -> string {
+    auto oss = ostringstream{};
+    oss << hex << setw(16) << setfill('0') << h;
+    return oss.str();
+}
+
+static auto hash_line(hash_type h,
+                      viua::assembler::frontend::parser::Line const& line)
+    -> hash_type {
+    for (auto const& token : line.tokens) {
+        h = fnv1a(h, token.str());
+    }
+    return fnv1a(h, "\n");
+}
+
+static auto hash_block(
+    hash_type h,
+    viua::assembler::frontend::parser::InstructionsBlock const& block)
+    -> hash_type {
+    h = fnv1a(h, block.name.str());
+    for (auto const& each : block.attributes) {
+        h = fnv1a(h, each.first);
+        h = fnv1a(h, each.second);
+    }
+    for (auto const& line : block.body) {
+        h = hash_line(h, *line);
+    }
+    return h;
+}
+
+
+static auto salt_of(std::string const& version) -> std::string {
+    /*
+     * The micro version is only bumped by commit hooks so it cannot be relied
+     * on to tell encodings of instructions apart (e.g. between builds made
+     * during development).
+     * Opcode table and sizes of encoded values are a part of the salt, too.
+     */
+    auto oss = ostringstream{};
+    oss << version << " encoding:" << ENCODING_VERSION;
+    oss << " operand-types:" << static_cast<int>(OT_FALSE);
+    oss << " sizes:" << sizeof(viua::internals::types::byte) << ','
+        << sizeof(viua::internals::types::bytecode_size) << ','
+        << sizeof(viua::internals::types::register_index) << ','
+        << sizeof(viua::internals::types::plain_int) << ','
+        << sizeof(viua::internals::types::plain_float);
+    for (auto const& each : OP_NAMES) {
+        oss << ' ' << static_cast<int>(each.first) << '=' << each.second;
+    }
+    return oss.str();
+}
+
+
+namespace viua { namespace assembler { namespace util {
+auto Compiled_invocable::relocate(
+    viua::internals::types::bytecode_size const offset) -> void {
+    for (auto const jump : jumps) {
+        aligned_write(bytecode.get() + jump) += offset;
+    }
+}
+
+Compilation_cache::Compilation_cache(std::string dir,
+                                     std::string const& version)
+        : directory(std::move(dir)), salt(salt_of(version)) {
+    struct stat sf;
+    if (stat(directory.c_str(), &sf) == -1) {
+        if (mkdir(directory.c_str(), 0755) == -1) {
+            throw("could not create compilation cache directory: "
+                  + directory);
+        }
+    } else if (not S_ISDIR(sf.st_mode)) {
+        throw("compilation cache path is not a directory: " + directory);
+    }
+}
+
+auto Compilation_cache::path_of(std::string const& key,
+                                std::string const& kind) const -> std::string {
+    return (directory + '/' + key + '.' + kind);
+}
+
+auto Compilation_cache::key_of(
+    std::vector<viua::cg::lex::Token> const& tokens) const -> key_type {
+    auto h = fnv1a(FNV_OFFSET, salt);
+    for (auto const& each : tokens) {
+        h = fnv1a(h, each.str());
+    }
+    return to_hex(h);
+}
+auto Compilation_cache::key_of(
+    viua::assembler::frontend::parser::InstructionsBlock const& block,
+    key_type const& dependencies) const -> key_type {
+    auto h = fnv1a(FNV_OFFSET, salt);
+    h      = fnv1a(h, dependencies);
+    return to_hex(hash_block(h, block));
+}
+auto Compilation_cache::key_of_dependencies(
+    viua::assembler::frontend::parser::ParsedSource const& source) const
+    -> key_type {
+    /*
+     * Static analysis of a function depends not only on the function itself,
+     * but also on signatures of functions it may call, and on bodies of the
+     * closures and blocks it may instantiate or enter.
+     * All of these are hashed together and mixed into keys of functions.
+     */
+    auto h = fnv1a(FNV_OFFSET, salt);
+    h      = fnv1a(h, (source.as_library ? "lib" : "exec"));
+    for (auto const& each : source.function_signatures) {
+        h = fnv1a(h, each.str());
+    }
+    for (auto const& each : source.block_signatures) {
+        h = fnv1a(h, each.str());
+    }
+    for (auto const& each : source.functions) {
+        h = fnv1a(h, each.name.str());
+        if (each.closure) {
+            h = hash_block(h, each);
+        }
+    }
+    for (auto const& each : source.blocks) {
+        h = hash_block(h, each);
+    }
+    return to_hex(h);
+}
+
+auto Compilation_cache::fetch(key_type const& key,
+                              Compiled_invocable& compiled) const -> bool {
+    auto in = ifstream{path_of(key, "bc"), ios::in | ios::binary};
+    if (not in) {
+        return false;
+    }
+
+    char magic[sizeof(CACHE_ENTRY_MAGIC)];
+    in.read(magic, sizeof(magic));
+    if ((not in) or string{magic} != CACHE_ENTRY_MAGIC) {
+        return false;
+    }
+
+    auto size = viua::internals::types::bytecode_size{0};
+    readinto(in, &size);
+    auto bytecode = make_unique<viua::internals::types::byte[]>(size);
+    in.read(reinterpret_cast<char*>(bytecode.get()),
+            static_cast<std::streamsize>(size));
+
+    auto no_of_jumps = viua::internals::types::bytecode_size{0};
+    readinto(in, &no_of_jumps);
+    auto jumps = decltype(compiled.jumps){};
+    for (auto i = decltype(no_of_jumps){0}; in and i < no_of_jumps; ++i) {
+        auto jump = viua::internals::types::bytecode_size{0};
+        readinto(in, &jump);
+        if (jump + sizeof(viua::internals::types::bytecode_size) > size) {
+            return false;
+        }
+        jumps.push_back(jump);
+    }
+
+    /*
+     * A truncated entry (e.g. if the assembler was killed while writing it)
+     * is treated as a miss.
+     */
+    if (not in) {
+        return false;
+    }
+
+    compiled.size     = size;
+    compiled.bytecode = std::move(bytecode);
+    compiled.jumps    = std::move(jumps);
+    return true;
+}
+auto Compilation_cache::store(key_type const& key,
+                              Compiled_invocable const& compiled) const
+    -> void {
+    /*
+     * Entries are written to a temporary file first, and then renamed to
+     * their final names so that concurrent assembler runs sharing a cache
+     * never see half-written entries.
+     */
+    auto const final_path = path_of(key, "bc");
+    auto const tmp_path =
+        final_path + ".tmp." + std::to_string(static_cast<long>(getpid()));
+
+    {
+        auto out = ofstream{tmp_path, ios::out | ios::binary};
+        out.write(CACHE_ENTRY_MAGIC, sizeof(CACHE_ENTRY_MAGIC));
+        out.write(reinterpret_cast<char const*>(&compiled.size),
+                  sizeof(compiled.size));
+        out.write(reinterpret_cast<char const*>(compiled.bytecode.get()),
+                  static_cast<std::streamsize>(compiled.size));
+        auto const no_of_jumps =
+            viua::internals::types::bytecode_size{compiled.jumps.size()};
+        out.write(reinterpret_cast<char const*>(&no_of_jumps),
+                  sizeof(no_of_jumps));
+        for (auto const each : compiled.jumps) {
+            out.write(reinterpret_cast<char const*>(&each), sizeof(each));
+        }
+        if (not out) {
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    std::rename(tmp_path.c_str(), final_path.c_str());
+}
+
+auto Compilation_cache::verified(key_type const& key) const -> bool {
+    return support::env::is_file(path_of(key, "sa"));
+}
+auto Compilation_cache::mark_verified(key_type const& key) const -> void {
+    auto out = ofstream{path_of(key, "sa"), ios::out | ios::binary};
+}
+}}}  // namespace viua::assembler::util
@@ -623,7 +623,8 @@ static void check_block_body(const TokenVector& body_tokens,
 
             i = skip_till_next_line(body_tokens, i);
             continue;
-        } else if (token == "insert" or token == "structinsert") {
+        } else if (token == "insert" or token == "structinsert"
+                   or token == "hashmapinsert") {
             TokenIndex target = i + 1;
             TokenIndex key    = target + 2;
             TokenIndex source = key + 2;
@@ -802,7 +803,8 @@ static void check_block_body(const TokenVector& body_tokens,
             // early return because we already checked both true, and false
             // branches
             return;
-        } else if (token == "echo" or token == "print") {
+        } else if (token == "echo" or token == "print" or token == "sleep"
+                   or token == "priority" or token == "yield") {
             TokenIndex source = get_token_index_of_operand(body_tokens, i, 1);
 
             check_use_of_register(body_tokens,
@@ -890,7 +892,9 @@ static void check_block_body(const TokenVector& body_tokens,
 
             i = skip_till_next_line(body_tokens, i);
         } else if (token == "copy" or token == "ptr" or token == "textlength"
-                   or token == "structkeys") {
+                   or token == "structkeys" or token == "hashmapkeys"
+                   or token == "hashmapsize" or token == "receivemany"
+                   or token == "resume") {
             TokenIndex target = i + 1;
             TokenIndex source = target + 2;
 
@@ -944,7 +948,8 @@ static void check_block_body(const TokenVector& body_tokens,
 
             i = skip_till_next_line(body_tokens, i);
             continue;
-        } else if (token == "send") {
+        } else if (token == "send" or token == "sendall"
+                   or token == "broadcast") {
             TokenIndex target = i + 1;
             TokenIndex source = target + 2;
 
@@ -1041,7 +1046,8 @@ static void check_block_body(const TokenVector& body_tokens,
                    or token == "textat" or token == "textcommonprefix"
                    or token == "textcommonsuffix" or token == "textconcat"
                    or token == "atomeq" or token == "bitand" or token == "bitor"
-                   or token == "bitxor" or token == "bitat") {
+                   or token == "bitxor" or token == "bitat"
+                   or token == "hashmaplookup" or token == "hashmapcontains") {
             ++i;  // skip mnemonic token
 
             TokenIndex target = i;
@@ -1175,6 +1181,31 @@ static void check_block_body(const TokenVector& body_tokens,
                                  body_tokens.at(target));
             }
 
+            i = skip_till_next_line(body_tokens, i);
+            continue;
+        } else if (token == "receivematch") {
+            TokenIndex target  = i + 1;
+            TokenIndex filter  = target + 2;
+            TokenIndex timeout = filter + 2;
+
+            if (body_tokens.at(target) == "void") {
+                --filter;
+                --timeout;
+            }
+
+            check_timeout_operand(body_tokens.at(timeout));
+            check_use_of_register(body_tokens,
+                                  filter,
+                                  i,
+                                  registers,
+                                  named_registers,
+                                  "receive with filter from empty register");
+            if (body_tokens.at(target) != "void") {
+                registers.insert(resolve_register_name(named_registers,
+                                                       body_tokens.at(target)),
+                                 body_tokens.at(target));
+            }
+
             i = skip_till_next_line(body_tokens, i);
             continue;
         } else if (token == "receive") {
@@ -1218,7 +1249,8 @@ static void check_block_body(const TokenVector& body_tokens,
                 registers, named_registers, body_tokens.at(target), token);
 
             i = skip_till_next_line(body_tokens, i);
-        } else if (token == "msg" or token == "call" or token == "process") {
+        } else if (token == "msg" or token == "call" or token == "process"
+                   or token == "coroutine") {
             TokenIndex target   = get_token_index_of_operand(body_tokens, i, 1);
             TokenIndex function = target + 2;
 
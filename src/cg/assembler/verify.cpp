@@ -62,7 +62,8 @@ void assembler::verify::function_calls_are_defined(
     for (decltype(tokens.size()) i = 0; i < tokens.size(); ++i) {
         auto token = tokens.at(i);
         if (not(token == "call" or token == "process" or token == "watchdog"
-                or token == "tailcall" or token == "defer")) {
+                or token == "tailcall" or token == "defer"
+                or token == "coroutine")) {
             continue;
         }
 
@@ -87,7 +88,8 @@ void assembler::verify::function_calls_are_defined(
                     function_name,
                     "watchdog from undefined function " + function_name.str());
             }
-        } else if (token == "call" or token == "process") {
+        } else if (token == "call" or token == "process"
+                   or token == "coroutine") {
             Token function_name = tokens.at(i + 2);
             if (tokens.at(i + 1) != "void") {
                 function_name = tokens.at(i + 3);
@@ -98,7 +100,10 @@ void assembler::verify::function_calls_are_defined(
                         function_name, function_names, function_signatures)) {
                     throw viua::cg::lex::InvalidSyntax(
                         function_name,
-                        (string(token == "call" ? "call to" : "process from")
+                        (string(token == "call"
+                                    ? "call to"
+                                    : (token == "process" ? "process from"
+                                                          : "coroutine from"))
                          + " undefined function " + function_name.str()));
                 }
             }
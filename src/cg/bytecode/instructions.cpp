@@ -392,6 +392,15 @@ auto opvector(viua::internals::types::byte* addr_ptr,
     return insert_ri_operand(addr_ptr, pack_length);
 }
 
+auto opvectorof(viua::internals::types::byte* addr_ptr,
+                int_op index,
+                string element_type) -> viua::internals::types::byte* {
+    *(addr_ptr++) = VECTOROF;
+    addr_ptr      = insert_ri_operand(addr_ptr, index);
+    return insert_string(addr_ptr,
+                         element_type.substr(1, element_type.size() - 2));
+}
+
 auto opvinsert(viua::internals::types::byte* addr_ptr,
                int_op vec,
                int_op src,
@@ -966,12 +975,83 @@ auto opreceive(viua::internals::types::byte* addr_ptr,
     return addr_ptr;
 }
 
+auto opsendall(viua::internals::types::byte* addr_ptr,
+               int_op target,
+               int_op source) -> viua::internals::types::byte* {
+    return insert_two_ri_instruction(addr_ptr, SENDALL, target, source);
+}
+
+auto opbroadcast(viua::internals::types::byte* addr_ptr,
+                 int_op targets,
+                 int_op source) -> viua::internals::types::byte* {
+    return insert_two_ri_instruction(addr_ptr, BROADCAST, targets, source);
+}
+
+auto opreceivemany(viua::internals::types::byte* addr_ptr,
+                   int_op target,
+                   int_op count) -> viua::internals::types::byte* {
+    return insert_two_ri_instruction(addr_ptr, RECEIVEMANY, target, count);
+}
+
+auto opreceivematch(viua::internals::types::byte* addr_ptr,
+                    int_op target,
+                    int_op filter,
+                    timeout_op timeout) -> viua::internals::types::byte* {
+    *(addr_ptr++) = RECEIVEMATCH;
+    addr_ptr      = insert_ri_operand(addr_ptr, target);
+    addr_ptr      = insert_ri_operand(addr_ptr, filter);
+
+    /*
+     * Timeouts are encoded as integer operands; fetch_timeout() expects
+     * OT_INT and there is no separate operand type for them.
+     */
+    *(reinterpret_cast<OperandType*>(addr_ptr)) = OT_INT;
+    pointer::inc<OperandType, viua::internals::types::byte>(addr_ptr);
+    aligned_write(addr_ptr) = timeout.value;
+    pointer::inc<viua::internals::types::timeout, viua::internals::types::byte>(
+        addr_ptr);
+
+    return addr_ptr;
+}
+
+auto opsleep(viua::internals::types::byte* addr_ptr, int_op duration)
+    -> viua::internals::types::byte* {
+    *(addr_ptr++) = SLEEP;
+    return insert_ri_operand(addr_ptr, duration);
+}
+
+auto oppriority(viua::internals::types::byte* addr_ptr, int_op priority_class)
+    -> viua::internals::types::byte* {
+    *(addr_ptr++) = PRIORITY;
+    return insert_ri_operand(addr_ptr, priority_class);
+}
+
 auto opwatchdog(viua::internals::types::byte* addr_ptr, const string& fn_name)
     -> viua::internals::types::byte* {
     *(addr_ptr++) = WATCHDOG;
     return insert_string(addr_ptr, fn_name);
 }
 
+auto opcoroutine(viua::internals::types::byte* addr_ptr,
+                 int_op reg,
+                 const string& fn_name) -> viua::internals::types::byte* {
+    *(addr_ptr++) = COROUTINE;
+    addr_ptr      = insert_ri_operand(addr_ptr, reg);
+    return insert_string(addr_ptr, fn_name);
+}
+
+auto opresume(viua::internals::types::byte* addr_ptr,
+              int_op target,
+              int_op coroutine) -> viua::internals::types::byte* {
+    return insert_two_ri_instruction(addr_ptr, RESUME, target, coroutine);
+}
+
+auto opyield(viua::internals::types::byte* addr_ptr, int_op value)
+    -> viua::internals::types::byte* {
+    *(addr_ptr++) = YIELD;
+    return insert_ri_operand(addr_ptr, value);
+}
+
 auto opjump(viua::internals::types::byte* addr_ptr,
             viua::internals::types::bytecode_size addr)
     -> viua::internals::types::byte* {
@@ -1134,6 +1214,56 @@ auto opstructkeys(viua::internals::types::byte* addr_ptr,
     return insert_two_ri_instruction(addr_ptr, STRUCTKEYS, target, source);
 }
 
+auto ophashmap(viua::internals::types::byte* addr_ptr, int_op regno)
+    -> viua::internals::types::byte* {
+    *(addr_ptr++) = HASHMAP;
+    return insert_ri_operand(addr_ptr, regno);
+}
+
+auto ophashmapinsert(viua::internals::types::byte* addr_ptr,
+                     int_op target,
+                     int_op key,
+                     int_op source) -> viua::internals::types::byte* {
+    return insert_three_ri_instruction(
+        addr_ptr, HASHMAPINSERT, target, key, source);
+}
+
+auto ophashmapremove(viua::internals::types::byte* addr_ptr,
+                     int_op target,
+                     int_op source,
+                     int_op key) -> viua::internals::types::byte* {
+    return insert_three_ri_instruction(
+        addr_ptr, HASHMAPREMOVE, target, source, key);
+}
+
+auto ophashmaplookup(viua::internals::types::byte* addr_ptr,
+                     int_op target,
+                     int_op source,
+                     int_op key) -> viua::internals::types::byte* {
+    return insert_three_ri_instruction(
+        addr_ptr, HASHMAPLOOKUP, target, source, key);
+}
+
+auto ophashmapcontains(viua::internals::types::byte* addr_ptr,
+                       int_op target,
+                       int_op source,
+                       int_op key) -> viua::internals::types::byte* {
+    return insert_three_ri_instruction(
+        addr_ptr, HASHMAPCONTAINS, target, source, key);
+}
+
+auto ophashmapkeys(viua::internals::types::byte* addr_ptr,
+                   int_op target,
+                   int_op source) -> viua::internals::types::byte* {
+    return insert_two_ri_instruction(addr_ptr, HASHMAPKEYS, target, source);
+}
+
+auto ophashmapsize(viua::internals::types::byte* addr_ptr,
+                   int_op target,
+                   int_op source) -> viua::internals::types::byte* {
+    return insert_two_ri_instruction(addr_ptr, HASHMAPSIZE, target, source);
+}
+
 auto opnew(viua::internals::types::byte* addr_ptr,
            int_op reg,
            const string& class_name) -> viua::internals::types::byte* {
@@ -354,7 +354,7 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
             ++ptr;  // for null character terminating the C-style string not
                     // included in std::string
         }
-    } else if (op == ATOM) {
+    } else if (op == ATOM or op == VECTOROF) {
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
 
         auto const s = string{reinterpret_cast<char*>(ptr)};
@@ -362,7 +362,7 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
         ptr += s.size();
         ++ptr;  // for null character terminating the C-style string not
                 // included in std::string
-    } else if ((op == CLOSURE) or (op == FUNCTION)) {
+    } else if ((op == CLOSURE) or (op == FUNCTION) or (op == COROUTINE)) {
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
 
         oss << ' ';
@@ -458,6 +458,7 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
     case STRING:
     case TEXT:
     case ATOM:
+    case VECTOROF:
     case CLOSURE:
     case FUNCTION:
     case CALL:
@@ -471,6 +472,7 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
     case IMPORT:
     case ENTER:
     case WATCHDOG:
+    case COROUTINE:
     case CATCH:
     case ATTACH:
         // Already handled in the `if` above.
@@ -491,6 +493,9 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
     case IZERO:
     case PRINT:
     case ECHO:
+    case SLEEP:
+    case PRIORITY:
+    case YIELD:
     case THROW:
     case DRAW:
     case DELETE:
@@ -499,6 +504,7 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
     case SELF:
     case ARGC:
     case STRUCT:
+    case HASHMAP:
     case WRAPINCREMENT:
     case WRAPDECREMENT:
     case CHECKEDSINCREMENT:
@@ -534,6 +540,10 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
         break;
     case SEND:
+    case SENDALL:
+    case BROADCAST:
+    case RECEIVEMANY:
+    case RESUME:
     case ITOF:
     case FTOI:
     case STOI:
@@ -548,6 +558,8 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
     case VLEN:
     case TEXTLENGTH:
     case STRUCTKEYS:
+    case HASHMAPKEYS:
+    case HASHMAPSIZE:
     case BITNOT:
     case ROL:
     case ROR:
@@ -654,6 +666,10 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
     case ATOMEQ:
     case STRUCTINSERT:
     case STRUCTREMOVE:
+    case HASHMAPINSERT:
+    case HASHMAPREMOVE:
+    case HASHMAPLOOKUP:
+    case HASHMAPCONTAINS:
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
@@ -708,6 +724,7 @@ auto disassembler::instruction(viua::internals::types::byte* ptr)
                      viua::internals::types::byte>(ptr);
         break;
     case JOIN:
+    case RECEIVEMATCH:
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
         ptr = disassemble_ri_operand_with_rs_type(oss, ptr);
 
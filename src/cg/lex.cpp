@@ -369,7 +369,8 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
     const auto limit = input_tokens.size();
     for (decltype(input_tokens)::size_type i = 0; i < limit; ++i) {
         Token token = input_tokens.at(i);
-        if (token == "call" or token == "process" or token == "msg") {
+        if (token == "call" or token == "process" or token == "msg"
+            or token == "coroutine") {
             tokens.push_back(token);
             if (is_register_index(input_tokens.at(i + 1))
                 or (input_tokens.at(i + 1) == "void")) {
@@ -643,7 +644,8 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "insert" or token == "structinsert") {
+        } else if (token == "insert" or token == "structinsert"
+                   or token == "hashmapinsert") {
             tokens.push_back(token);  // mnemonic
 
             tokens.push_back(input_tokens.at(++i));  // target register
@@ -669,7 +671,8 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "remove" or token == "structremove") {
+        } else if (token == "remove" or token == "structremove"
+                   or token == "hashmapremove") {
             tokens.push_back(token);  // mnemonic
 
             tokens.push_back(input_tokens.at(++i));  // target register
@@ -698,7 +701,7 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "join") {
+        } else if (token == "join" or token == "receivematch") {
             tokens.push_back(token);
 
             tokens.push_back(input_tokens.at(++i));
@@ -948,7 +951,8 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
                 }
                 continue;
             }
-        } else if (token == "texteq" or token == "atomeq") {
+        } else if (token == "texteq" or token == "atomeq"
+                   or token == "hashmaplookup" or token == "hashmapcontains") {
             tokens.push_back(token);  // mnemonic
 
             tokens.push_back(input_tokens.at(++i));  // target register
@@ -974,7 +978,7 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "atom") {
+        } else if (token == "atom" or token == "vectorof") {
             tokens.push_back(token);                 // mnemonic
             tokens.push_back(input_tokens.at(++i));  // target register
             if (not is_register_set_name(input_tokens.at(i + 1))) {
@@ -1082,7 +1086,10 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
             }
         } else if (token == "move" or token == "copy" or token == "swap"
                    or token == "ptr" or token == "isnull" or token == "send"
-                   or token == "textlength" or token == "structkeys"
+                   or token == "sendall" or token == "broadcast"
+                   or token == "receivemany" or token == "textlength"
+                   or token == "structkeys" or token == "hashmapkeys"
+                   or token == "hashmapsize" or token == "resume"
                    or token == "bits" or token == "bitset"
                    or token == "bitat") {
             tokens.push_back(token);  // mnemonic
@@ -1129,7 +1136,9 @@ auto standardise(vector<Token> input_tokens) -> vector<Token> {
         } else if (token == "izero" or token == "print" or token == "argc"
                    or token == "echo" or token == "delete" or token == "draw"
                    or token == "throw" or token == "iinc" or token == "idec"
-                   or token == "self" or token == "struct") {
+                   or token == "self" or token == "struct" or token == "hashmap"
+                   or token == "sleep"
+                   or token == "priority" or token == "yield") {
             tokens.push_back(token);                 // mnemonic
             tokens.push_back(input_tokens.at(++i));  // target register
             if (input_tokens.at(i + 1) == "\n") {
@@ -1162,7 +1171,8 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
          */
         tokens.push_back(token);
 
-        if (token == "call" or token == "process" or token == "msg") {
+        if (token == "call" or token == "process" or token == "msg"
+            or token == "coroutine") {
             if (is_register_index(input_tokens.at(i + 1))
                 or (input_tokens.at(i + 1) == "void")) {
                 tokens.push_back(input_tokens.at(++i));
@@ -1416,7 +1426,8 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "insert" or token == "structinsert") {
+        } else if (token == "insert" or token == "structinsert"
+                   or token == "hashmapinsert") {
             tokens.push_back(input_tokens.at(++i));  // target register
             if (not is_register_set_name(input_tokens.at(i + 1))) {
                 tokens.emplace_back(
@@ -1440,7 +1451,8 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "remove" or token == "structremove") {
+        } else if (token == "remove" or token == "structremove"
+                   or token == "hashmapremove") {
             tokens.push_back(input_tokens.at(++i));  // target register
             if (tokens.back() != "void") {
                 if (not is_register_set_name(input_tokens.at(i + 1))) {
@@ -1467,7 +1479,7 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "join") {
+        } else if (token == "join" or token == "receivematch") {
             tokens.push_back(input_tokens.at(++i));
             if (tokens.back() != "void") {
                 if (is_register_set_name(input_tokens.at(i + 1))) {
@@ -1704,7 +1716,8 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
                 }
                 continue;
             }
-        } else if (token == "texteq" or token == "atomeq") {
+        } else if (token == "texteq" or token == "atomeq"
+                   or token == "hashmaplookup" or token == "hashmapcontains") {
             tokens.push_back(input_tokens.at(++i));  // target register
             if (not is_register_set_name(input_tokens.at(i + 1))) {
                 tokens.emplace_back(
@@ -1728,7 +1741,7 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
             } else {
                 tokens.push_back(input_tokens.at(++i));
             }
-        } else if (token == "atom") {
+        } else if (token == "atom" or token == "vectorof") {
             tokens.push_back(input_tokens.at(++i));  // target register
             if (not is_register_set_name(input_tokens.at(i + 1))) {
                 tokens.emplace_back(input_tokens.at(i).line(),
@@ -1830,7 +1843,10 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
             }
         } else if (token == "move" or token == "copy" or token == "swap"
                    or token == "ptr" or token == "isnull" or token == "send"
-                   or token == "textlength" or token == "structkeys"
+                   or token == "sendall" or token == "broadcast"
+                   or token == "receivemany" or token == "textlength"
+                   or token == "structkeys" or token == "hashmapkeys"
+                   or token == "hashmapsize" or token == "resume"
                    or token == "bitset" or token == "bitat") {
             if (input_tokens.at(i + 1) == "[[") {  // FIXME attributes
                 do {
@@ -1891,7 +1907,9 @@ auto normalise(vector<Token> input_tokens) -> vector<Token> {
         } else if (token == "izero" or token == "print" or token == "argc"
                    or token == "echo" or token == "delete" or token == "draw"
                    or token == "throw" or token == "iinc" or token == "idec"
-                   or token == "self" or token == "struct"
+                   or token == "self" or token == "struct" or token == "hashmap"
+                   or token == "sleep"
+                   or token == "priority" or token == "yield"
                    or token == "wrapincrement" or token == "wrapdecrement") {
             tokens.push_back(input_tokens.at(++i));  // target register
             if (input_tokens.at(i + 1) == "\n") {
@@ -894,6 +894,32 @@ static auto size_of_join(TokenVector const& tokens, TokenVector::size_type i)
 }
 static auto size_of_send =
     size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_sendall =
+    size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_broadcast =
+    size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_receivemany =
+    size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_sleep = size_of_instruction_with_one_ri_operand;
+static auto size_of_priority = size_of_instruction_with_one_ri_operand;
+static auto size_of_receivematch(TokenVector const& tokens,
+                                 TokenVector::size_type i)
+    -> tuple<bytecode_size_type, decltype(i)> {
+    auto calculated_size = bytecode_size_type{0};
+    tie(calculated_size, i) =
+        size_of_instruction_with_two_ri_operands_with_rs_types(tokens, i);
+
+    if (str::is_timeout_literal(tokens.at(i))) {
+        calculated_size += sizeof(viua::internals::types::byte);
+        calculated_size += sizeof(viua::internals::types::timeout);
+        ++i;
+    } else {
+        throw viua::cg::lex::InvalidSyntax(
+            tokens.at(i), "invalid timeout token in 'receivematch'");
+    }
+
+    return tuple<bytecode_size_type, decltype(i)>(calculated_size, i);
+}
 static auto size_of_receive(TokenVector const& tokens, TokenVector::size_type i)
     -> tuple<bytecode_size_type, decltype(i)> {
     auto calculated_size = bytecode_size_type{0};
@@ -923,6 +949,11 @@ static auto size_of_watchdog(TokenVector const& tokens,
 
     return tuple<bytecode_size_type, decltype(i)>(calculated_size, i);
 }
+static auto size_of_coroutine = size_of_process;
+static auto size_of_resume =
+    size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_yield =
+    size_of_instruction_with_one_ri_operand_with_rs_type;
 static auto size_of_jump(TokenVector const&, TokenVector::size_type i)
     -> tuple<bytecode_size_type, decltype(i)> {
     auto calculated_size =
@@ -1092,6 +1123,7 @@ static auto size_of_atom(TokenVector const& tokens, TokenVector::size_type i)
 
     return tuple<bytecode_size_type, decltype(i)>(calculated_size, i);
 }
+static auto size_of_vectorof = size_of_atom;
 static auto size_of_atomeq =
     size_of_instruction_with_three_ri_operands_with_rs_types;
 static auto size_of_struct = size_of_instruction_with_one_ri_operand;
@@ -1101,6 +1133,19 @@ static auto size_of_structremove =
     size_of_instruction_with_three_ri_operands_with_rs_types;
 static auto size_of_structkeys =
     size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_hashmap = size_of_instruction_with_one_ri_operand;
+static auto size_of_hashmapinsert =
+    size_of_instruction_with_three_ri_operands_with_rs_types;
+static auto size_of_hashmapremove =
+    size_of_instruction_with_three_ri_operands_with_rs_types;
+static auto size_of_hashmaplookup =
+    size_of_instruction_with_three_ri_operands_with_rs_types;
+static auto size_of_hashmapcontains =
+    size_of_instruction_with_three_ri_operands_with_rs_types;
+static auto size_of_hashmapkeys =
+    size_of_instruction_with_two_ri_operands_with_rs_types;
+static auto size_of_hashmapsize =
+    size_of_instruction_with_two_ri_operands_with_rs_types;
 static auto size_of_new(TokenVector const& tokens, TokenVector::size_type i)
     -> tuple<bytecode_size_type, decltype(i)> {
     auto calculated_size = bytecode_size_type{
@@ -1297,6 +1342,9 @@ auto calculate_bytecode_size_of_first_n_instructions2(
         } else if (tokens.at(i) == "vector") {
             ++i;
             tie(increase, i) = size_of_vec(tokens, i);
+        } else if (tokens.at(i) == "vectorof") {
+            ++i;
+            tie(increase, i) = size_of_vectorof(tokens, i);
         } else if (tokens.at(i) == "vinsert") {
             ++i;
             tie(increase, i) = size_of_vinsert(tokens, i);
@@ -1531,9 +1579,36 @@ auto calculate_bytecode_size_of_first_n_instructions2(
         } else if (tokens.at(i) == "receive") {
             ++i;
             tie(increase, i) = size_of_receive(tokens, i);
+        } else if (tokens.at(i) == "sendall") {
+            ++i;
+            tie(increase, i) = size_of_sendall(tokens, i);
+        } else if (tokens.at(i) == "broadcast") {
+            ++i;
+            tie(increase, i) = size_of_broadcast(tokens, i);
+        } else if (tokens.at(i) == "receivemany") {
+            ++i;
+            tie(increase, i) = size_of_receivemany(tokens, i);
+        } else if (tokens.at(i) == "receivematch") {
+            ++i;
+            tie(increase, i) = size_of_receivematch(tokens, i);
+        } else if (tokens.at(i) == "sleep") {
+            ++i;
+            tie(increase, i) = size_of_sleep(tokens, i);
+        } else if (tokens.at(i) == "priority") {
+            ++i;
+            tie(increase, i) = size_of_priority(tokens, i);
         } else if (tokens.at(i) == "watchdog") {
             ++i;
             tie(increase, i) = size_of_watchdog(tokens, i);
+        } else if (tokens.at(i) == "coroutine") {
+            ++i;
+            tie(increase, i) = size_of_coroutine(tokens, i);
+        } else if (tokens.at(i) == "resume") {
+            ++i;
+            tie(increase, i) = size_of_resume(tokens, i);
+        } else if (tokens.at(i) == "yield") {
+            ++i;
+            tie(increase, i) = size_of_yield(tokens, i);
         } else if (tokens.at(i) == "jump") {
             ++i;
             tie(increase, i) = size_of_jump(tokens, i);
@@ -1594,6 +1669,27 @@ auto calculate_bytecode_size_of_first_n_instructions2(
         } else if (tokens.at(i) == "structkeys") {
             ++i;
             tie(increase, i) = size_of_structkeys(tokens, i);
+        } else if (tokens.at(i) == "hashmap") {
+            ++i;
+            tie(increase, i) = size_of_hashmap(tokens, i);
+        } else if (tokens.at(i) == "hashmapinsert") {
+            ++i;
+            tie(increase, i) = size_of_hashmapinsert(tokens, i);
+        } else if (tokens.at(i) == "hashmapremove") {
+            ++i;
+            tie(increase, i) = size_of_hashmapremove(tokens, i);
+        } else if (tokens.at(i) == "hashmaplookup") {
+            ++i;
+            tie(increase, i) = size_of_hashmaplookup(tokens, i);
+        } else if (tokens.at(i) == "hashmapcontains") {
+            ++i;
+            tie(increase, i) = size_of_hashmapcontains(tokens, i);
+        } else if (tokens.at(i) == "hashmapkeys") {
+            ++i;
+            tie(increase, i) = size_of_hashmapkeys(tokens, i);
+        } else if (tokens.at(i) == "hashmapsize") {
+            ++i;
+            tie(increase, i) = size_of_hashmapsize(tokens, i);
         } else if (tokens.at(i) == "new") {
             ++i;
             tie(increase, i) = size_of_new(tokens, i);
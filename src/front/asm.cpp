@@ -19,9 +19,13 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <set>
 #include <stdlib.h>
 #include <unistd.h>
 #include <viua/assembler/frontend/static_analyser.h>
+#include <viua/assembler/optimiser.h>
+#include <viua/assembler/util/compilation_cache.h>
 #include <viua/assembler/util/pretty_printer.h>
 #include <viua/cg/assembler/assembler.h>
 #include <viua/cg/lex.h>
@@ -55,6 +59,20 @@ bool PERFORM_STATIC_ANALYSIS = true;
 bool USE_NEW_SA              = true;
 bool SHOW_META               = false;
 
+// should local registers be renumbered to shrink register sets?
+bool ALLOCATE_REGISTERS = false;
+
+// should calls to small leaf functions be replaced by their bodies?
+bool INLINE_CALLS = false;
+// how many instructions may a function have to be inlined?
+vector<viua::cg::lex::Token>::size_type INLINE_THRESHOLD = 8;
+
+// where are compiled functions cached between runs (empty if nowhere)?
+string CACHE_DIRECTORY = "";
+
+// which profile should guide optimisations (empty if none)?
+string PROFILE_PATH = "";
+
 bool VERBOSE = false;
 bool DEBUG   = false;
 bool SCREAM  = false;
@@ -141,7 +159,32 @@ static bool usage(const char* program,
                 "false positives)\n"
              << "    --new-sa             - use new static analyser (more "
                 "precise, with better features, but "
-                "without coverage of all instructions yet)\n";
+                "without coverage of all instructions yet)\n"
+             << "    "
+             << "    --allocate-registers - renumber local registers to make "
+                "register sets of functions as small\n"
+             << "    "
+             << "                           as possible\n"
+             << "    "
+             << "    --inline             - replace calls to small leaf "
+                "functions with their bodies\n"
+             << "    "
+             << "    --inline-threshold <n>\n"
+             << "    "
+             << "                         - inline only functions with at most "
+                "<n> instructions (default: 8)\n"
+             << "    "
+             << "    --cache <dir>        - reuse bytecode of functions that "
+                "did not change since the previous\n"
+             << "    "
+             << "                           compilation (compiled functions "
+                "are stored in given directory)\n"
+             << "    "
+             << "    --profile-use <file> - use profile written by the kernel "
+                "(see VIUA_PROFILE_OUTPUT) to lay out\n"
+             << "    "
+             << "                           functions and to choose which "
+                "calls to inline\n";
     }
 
     return (show_help or show_version);
@@ -215,6 +258,51 @@ int main(int argc, char* argv[]) {
         } else if (option == "--new-sa") {
             USE_NEW_SA = true;
             continue;
+        } else if (option == "--allocate-registers") {
+            ALLOCATE_REGISTERS = true;
+            continue;
+        } else if (option == "--inline") {
+            INLINE_CALLS = true;
+            continue;
+        } else if (option == "--inline-threshold") {
+            if (i < argc - 1 and str::isnum(argv[i + 1], false)) {
+                INLINE_THRESHOLD = stoul(argv[++i]);
+            } else {
+                cout << send_control_seq(COLOR_FG_RED) << "error"
+                     << send_control_seq(ATTR_RESET);
+                cout << ": option '" << send_control_seq(COLOR_FG_WHITE)
+                     << argv[i] << send_control_seq(ATTR_RESET)
+                     << "' requires an argument: number of instructions";
+                cout << endl;
+                exit(1);
+            }
+            continue;
+        } else if (option == "--cache") {
+            if (i < argc - 1) {
+                CACHE_DIRECTORY = string(argv[++i]);
+            } else {
+                cout << send_control_seq(COLOR_FG_RED) << "error"
+                     << send_control_seq(ATTR_RESET);
+                cout << ": option '" << send_control_seq(COLOR_FG_WHITE)
+                     << argv[i] << send_control_seq(ATTR_RESET)
+                     << "' requires an argument: directory";
+                cout << endl;
+                exit(1);
+            }
+            continue;
+        } else if (option == "--profile-use") {
+            if (i < argc - 1) {
+                PROFILE_PATH = string(argv[++i]);
+            } else {
+                cout << send_control_seq(COLOR_FG_RED) << "error"
+                     << send_control_seq(ATTR_RESET);
+                cout << ": option '" << send_control_seq(COLOR_FG_WHITE)
+                     << argv[i] << send_control_seq(ATTR_RESET)
+                     << "' requires an argument: filename";
+                cout << endl;
+                exit(1);
+            }
+            continue;
         } else if (str::startswith(option, "-")) {
             cerr << send_control_seq(COLOR_FG_RED) << "error"
                  << send_control_seq(ATTR_RESET);
@@ -278,6 +366,45 @@ int main(int argc, char* argv[]) {
     }
 
 
+    //////////////////////////////////
+    // OPEN CACHE OF COMPILED FUNCTIONS
+    unique_ptr<viua::assembler::util::Compilation_cache> cache;
+    if (not CACHE_DIRECTORY.empty()) {
+        try {
+            cache = make_unique<viua::assembler::util::Compilation_cache>(
+                CACHE_DIRECTORY, (string{VERSION} + '.' + MICRO));
+        } catch (const string& e) {
+            cout << send_control_seq(COLOR_FG_RED) << "error"
+                 << send_control_seq(ATTR_RESET);
+            cout << ": " << e << endl;
+            return 1;
+        }
+    }
+
+
+    ///////////////////////////////////////
+    // READ PROFILE GUIDING THE OPTIMISATIONS
+    unique_ptr<viua::kernel::Profile> profile;
+    if (not PROFILE_PATH.empty()) {
+        auto in = ifstream{PROFILE_PATH, ios::in};
+        if (not in) {
+            cout << send_control_seq(COLOR_FG_RED) << "error"
+                 << send_control_seq(ATTR_RESET);
+            cout << ": could not open profile: " << PROFILE_PATH << endl;
+            return 1;
+        }
+        try {
+            profile = make_unique<viua::kernel::Profile>(
+                viua::kernel::Profile::read(in));
+        } catch (const string& e) {
+            cout << send_control_seq(COLOR_FG_RED) << "error"
+                 << send_control_seq(ATTR_RESET);
+            cout << ": " << PROFILE_PATH << ": " << e << endl;
+            return 1;
+        }
+    }
+
+
     //////////////////////////////////////////
     // GATHER LINKS OBTAINED FROM COMMAND LINE
     vector<string> commandline_given_links;
@@ -342,8 +469,39 @@ int main(int argc, char* argv[]) {
         viua::assembler::frontend::static_analyser::verify(parsed_source);
         if (PERFORM_STATIC_ANALYSIS) {
             if (USE_NEW_SA) {
+                /*
+                 * Functions that were already successfully analysed (and did
+                 * not change since then, and neither did anything they depend
+                 * on) need not be analysed again.
+                 * Closures are never skipped since they are analysed as part
+                 * of functions that instantiate them.
+                 */
+                auto analysed_keys = vector<string>{};
+                if (cache) {
+                    auto const dependencies =
+                        cache->key_of_dependencies(parsed_source);
+                    auto& fns = parsed_source.functions;
+                    for (auto it = fns.begin(); it != fns.end();) {
+                        if (it->closure) {
+                            ++it;
+                            continue;
+                        }
+                        auto key = cache->key_of(*it, dependencies);
+                        if (cache->verified(key)) {
+                            it = fns.erase(it);
+                        } else {
+                            analysed_keys.push_back(std::move(key));
+                            ++it;
+                        }
+                    }
+                }
+
                 viua::assembler::frontend::static_analyser::
                     check_register_usage(parsed_source);
+
+                for (auto const& each : analysed_keys) {
+                    cache->mark_verified(each);
+                }
             } else {
                 assembler::verify::manipulation_of_defined_registers(
                     cooked_tokens_without_names_replaced, blocks.tokens, DEBUG);
@@ -369,11 +527,35 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    auto closures = set<string>{};
+    for (auto const& each : assembler::ce::get_invokables_token_bodies(
+             "closure", cooked_tokens)) {
+        closures.insert(each.first);
+    }
+    if (INLINE_CALLS) {
+        viua::assembler::optimiser::inline_calls(functions.tokens,
+                                                 blocks.tokens,
+                                                 closures,
+                                                 AS_LIB,
+                                                 INLINE_THRESHOLD,
+                                                 profile.get());
+    }
+    if (ALLOCATE_REGISTERS) {
+        viua::assembler::optimiser::allocate_registers(
+            functions.tokens, blocks.tokens, closures);
+    }
+    if (profile) {
+        viua::assembler::optimiser::order_by_profile(functions.names,
+                                                     *profile);
+        viua::assembler::optimiser::order_by_profile(blocks.names, *profile);
+    }
+
     compilationflags_t flags;
     flags.as_lib  = AS_LIB;
     flags.verbose = VERBOSE;
     flags.debug   = DEBUG;
     flags.scream  = SCREAM;
+    flags.cache   = cache.get();
 
     if (SHOW_META) {
         auto meta = gather_meta_information(cooked_tokens);
@@ -223,6 +223,7 @@ using viua::assembler::backend::op_assemblers::assemble_op_call;
 using viua::assembler::backend::op_assemblers::assemble_op_if;
 using viua::assembler::backend::op_assemblers::assemble_op_jump;
 using viua::assembler::backend::op_assemblers::assemble_op_structremove;
+using viua::assembler::backend::op_assemblers::assemble_op_hashmapremove;
 using viua::assembler::backend::op_assemblers::assemble_op_msg;
 using viua::assembler::backend::op_assemblers::assemble_op_remove;
 using viua::assembler::backend::op_assemblers::assemble_op_float;
@@ -300,6 +301,8 @@ viua::internals::types::bytecode_size assemble_instruction(
         assemble_three_register_op<&Program::optextconcat>(program, tokens, i);
     } else if (tokens.at(i) == "vector") {
         viua::assembler::backend::op_assemblers::assemble_op_vector(program, tokens, i);
+    } else if (tokens.at(i) == "vectorof") {
+        assemble_fn_ctor_op<&Program::opvectorof>(program, tokens, i);
     } else if (tokens.at(i) == "vinsert") {
         assemble_op_vinsert(program, tokens, i);
     } else if (tokens.at(i) == "vpush") {
@@ -484,8 +487,26 @@ viua::internals::types::bytecode_size assemble_instruction(
         assemble_double_register_op<&Program::opsend>(program, tokens, i);
     } else if (tokens.at(i) == "receive") {
         viua::assembler::backend::op_assemblers::assemble_op_receive(program, tokens, i);
+    } else if (tokens.at(i) == "sendall") {
+        assemble_double_register_op<&Program::opsendall>(program, tokens, i);
+    } else if (tokens.at(i) == "broadcast") {
+        assemble_double_register_op<&Program::opbroadcast>(program, tokens, i);
+    } else if (tokens.at(i) == "receivemany") {
+        assemble_double_register_op<&Program::opreceivemany>(program, tokens, i);
+    } else if (tokens.at(i) == "receivematch") {
+        viua::assembler::backend::op_assemblers::assemble_op_receivematch(program, tokens, i);
+    } else if (tokens.at(i) == "sleep") {
+        assemble_single_register_op<&Program::opsleep>(program, tokens, i);
+    } else if (tokens.at(i) == "priority") {
+        assemble_single_register_op<&Program::oppriority>(program, tokens, i);
     } else if (tokens.at(i) == "watchdog") {
         program.opwatchdog(tokens.at(i + 1));
+    } else if (tokens.at(i) == "coroutine") {
+        viua::assembler::backend::op_assemblers::assemble_op_coroutine(program, tokens, i);
+    } else if (tokens.at(i) == "resume") {
+        assemble_double_register_op<&Program::opresume>(program, tokens, i);
+    } else if (tokens.at(i) == "yield") {
+        assemble_single_register_op<&Program::opyield>(program, tokens, i);
     } else if (tokens.at(i) == "if") {
         assemble_op_if(program, tokens, i, instruction, marks);
     } else if (tokens.at(i) == "jump") {
@@ -524,6 +545,20 @@ viua::internals::types::bytecode_size assemble_instruction(
         assemble_op_structremove(program, tokens, i);
     } else if (tokens.at(i) == "structkeys") {
         assemble_double_register_op<&Program::opstructkeys>(program, tokens, i);
+    } else if (tokens.at(i) == "hashmap") {
+        assemble_single_register_op<&Program::ophashmap>(program, tokens, i);
+    } else if (tokens.at(i) == "hashmapinsert") {
+        assemble_three_register_op<&Program::ophashmapinsert>(program, tokens, i);
+    } else if (tokens.at(i) == "hashmapremove") {
+        assemble_op_hashmapremove(program, tokens, i);
+    } else if (tokens.at(i) == "hashmaplookup") {
+        assemble_three_register_op<&Program::ophashmaplookup>(program, tokens, i);
+    } else if (tokens.at(i) == "hashmapcontains") {
+        assemble_three_register_op<&Program::ophashmapcontains>(program, tokens, i);
+    } else if (tokens.at(i) == "hashmapkeys") {
+        assemble_double_register_op<&Program::ophashmapkeys>(program, tokens, i);
+    } else if (tokens.at(i) == "hashmapsize") {
+        assemble_double_register_op<&Program::ophashmapsize>(program, tokens, i);
     } else if (tokens.at(i) == "new") {
         assemble_fn_ctor_op<&Program::opnew>(program, tokens, i);
     } else if (tokens.at(i) == "msg") {
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <viua/assembler/util/compilation_cache.h>
 #include <viua/assembler/util/pretty_printer.h>
 #include <viua/bytecode/maps.h>
 #include <viua/cg/assembler/assembler.h>
@@ -559,7 +560,9 @@ void generate(vector<Token> const& tokens,
         block_addresses = map_invocable_addresses(starting_instruction, blocks);
         function_addresses =
             map_invocable_addresses(starting_instruction, functions);
-        bytes = viua::cg::tools::calculate_bytecode_size2(tokens);
+        // sizes of invocables are used instead of the size of the whole
+        // source because optimisation passes may have changed their bodies
+        bytes = starting_instruction;
     } catch (const string& e) {
         throw("bytecode size calculation failed: " + e);
     }
@@ -591,9 +594,14 @@ void generate(vector<Token> const& tokens,
         }
     }
 
+    // every linked module is loaded only once even though it is inspected
+    // twice: first to gather function names, and then to get its bytecode
+    map<string, unique_ptr<Loader>> linked_modules;
+
     // gather all linked function names
     for (string lnk : links) {
-        Loader loader(lnk);
+        auto& loader =
+            *(linked_modules[lnk] = make_unique<Loader>(lnk));
         loader.load();
 
         vector<string> fn_names = loader.get_functions();
@@ -697,8 +705,7 @@ void generate(vector<Token> const& tokens,
             cout << "'" << endl;
         }
 
-        Loader loader(lnk);
-        loader.load();
+        auto& loader = *linked_modules.at(lnk);
 
         vector<string> fn_names = loader.get_functions();
 
@@ -837,65 +844,85 @@ void generate(vector<Token> const& tokens,
                  << send_control_seq(ATTR_RESET);
             cout << '"';
         }
-        viua::internals::types::bytecode_size fun_bytes = 0;
-        try {
-            fun_bytes = viua::cg::tools::calculate_bytecode_size2(
-                blocks.tokens.at(name));
+        viua::assembler::util::Compiled_invocable compiled;
+        auto const cache_key =
+            (flags.cache ? flags.cache->key_of(blocks.tokens.at(name)) : "");
+        if (flags.cache and flags.cache->fetch(cache_key, compiled)) {
             if (VERBOSE or DEBUG) {
-                cout << " (" << fun_bytes << " bytes at byte "
-                     << block_bodies_section_size << ')' << endl;
+                cout << " (" << compiled.size << " bytes at byte "
+                     << block_bodies_section_size << ", cached)" << endl;
+            }
+        } else {
+            viua::internals::types::bytecode_size fun_bytes = 0;
+            try {
+                fun_bytes = viua::cg::tools::calculate_bytecode_size2(
+                    blocks.tokens.at(name));
+                if (VERBOSE or DEBUG) {
+                    cout << " (" << fun_bytes << " bytes at byte "
+                         << block_bodies_section_size << ')' << endl;
+                }
+            } catch (const string& e) {
+                throw("failed block size count (during pre-assembling): " + e);
+            } catch (const std::out_of_range& e) {
+                throw("in block '" + name + "': " + e.what());
             }
-        } catch (const string& e) {
-            throw("failed block size count (during pre-assembling): " + e);
-        } catch (const std::out_of_range& e) {
-            throw("in block '" + name + "': " + e.what());
-        }
 
-        Program func(fun_bytes);
-        func.setdebug(DEBUG).setscream(SCREAM);
-        try {
-            if (DEBUG) {
-                cout << send_control_seq(COLOR_FG_WHITE) << filename
-                     << send_control_seq(ATTR_RESET);
-                cout << ": ";
-                cout << send_control_seq(COLOR_FG_YELLOW) << "debug"
-                     << send_control_seq(ATTR_RESET);
-                cout << ": ";
-                cout << "assembling block '";
-                cout << send_control_seq(COLOR_FG_LIGHT_GREEN) << name
-                     << send_control_seq(ATTR_RESET);
-                cout << "'\n";
+            Program func(fun_bytes);
+            func.setdebug(DEBUG).setscream(SCREAM);
+            try {
+                if (DEBUG) {
+                    cout << send_control_seq(COLOR_FG_WHITE) << filename
+                         << send_control_seq(ATTR_RESET);
+                    cout << ": ";
+                    cout << send_control_seq(COLOR_FG_YELLOW) << "debug"
+                         << send_control_seq(ATTR_RESET);
+                    cout << ": ";
+                    cout << "assembling block '";
+                    cout << send_control_seq(COLOR_FG_LIGHT_GREEN) << name
+                         << send_control_seq(ATTR_RESET);
+                    cout << "'\n";
+                }
+                assemble(func, strip_attributes(blocks.tokens.at(name)));
+            } catch (const string& e) {
+                throw("in block '" + name + "': " + e);
+            } catch (const char*& e) {
+                throw("in block '" + name + "': " + e);
+            } catch (const std::out_of_range& e) {
+                throw("in block '" + name + "': " + e.what());
             }
-            assemble(func, strip_attributes(blocks.tokens.at(name)));
-        } catch (const string& e) {
-            throw("in block '" + name + "': " + e);
-        } catch (const char*& e) {
-            throw("in block '" + name + "': " + e);
-        } catch (const std::out_of_range& e) {
-            throw("in block '" + name + "': " + e.what());
-        }
 
-        vector<viua::internals::types::bytecode_size> jumps = func.jumps();
+            vector<viua::internals::types::bytecode_size> jumps = func.jumps();
+
+            vector<tuple<viua::internals::types::bytecode_size,
+                         viua::internals::types::bytecode_size>>
+                local_jumps;
+            for (auto jmp : jumps) {
+                local_jumps.emplace_back(
+                    jmp, viua::internals::types::bytecode_size{0});
+            }
+            func.calculate_jumps(local_jumps, blocks.tokens.at(name));
 
-        vector<tuple<viua::internals::types::bytecode_size,
-                     viua::internals::types::bytecode_size>>
-            local_jumps;
-        for (auto jmp : jumps) {
-            local_jumps.emplace_back(jmp, block_bodies_section_size);
+            compiled.size     = func.size();
+            compiled.bytecode = func.bytecode();
+            compiled.jumps    = std::move(jumps);
+            if (flags.cache) {
+                flags.cache->store(cache_key, compiled);
+            }
         }
-        func.calculate_jumps(local_jumps, blocks.tokens.at(name));
 
-        auto btcode = func.bytecode();
+        // bytecode was generated as if the block was placed at the very
+        // beginning of the section so jump targets must be adjusted
+        compiled.relocate(block_bodies_section_size);
 
         // store generated bytecode fragment for future use (we must not yet
         // write it to the file to conform to bytecode format)
         block_bodies_bytecode[name] =
-            tuple<viua::internals::types::bytecode_size, decltype(btcode)>(
-                func.size(), std::move(btcode));
+            tuple<viua::internals::types::bytecode_size,
+                  unique_ptr<viua::internals::types::byte[]>>(
+                compiled.size, std::move(compiled.bytecode));
 
         // extend jump table with jumps from current block
-        for (decltype(jumps)::size_type i = 0; i < jumps.size(); ++i) {
-            viua::internals::types::bytecode_size jmp = jumps[i];
+        for (auto const jmp : compiled.jumps) {
             if (DEBUG) {
                 cout << send_control_seq(COLOR_FG_WHITE) << filename
                      << send_control_seq(ATTR_RESET);
@@ -909,7 +936,7 @@ void generate(vector<Token> const& tokens,
             jump_table.emplace_back(jmp + block_bodies_section_size);
         }
 
-        block_bodies_section_size += func.size();
+        block_bodies_section_size += compiled.size;
     }
 
     // functions section size, must be offset by the size of block section
@@ -936,75 +963,96 @@ void generate(vector<Token> const& tokens,
                  << send_control_seq(ATTR_RESET);
             cout << '"';
         }
-        viua::internals::types::bytecode_size fun_bytes = 0;
-        try {
-            fun_bytes = viua::cg::tools::calculate_bytecode_size2(
-                functions.tokens.at(name));
+        viua::assembler::util::Compiled_invocable compiled;
+        auto const cache_key =
+            (flags.cache ? flags.cache->key_of(functions.tokens.at(name))
+                         : "");
+        if (flags.cache and flags.cache->fetch(cache_key, compiled)) {
             if (VERBOSE or DEBUG) {
-                cout << " (" << fun_bytes << " bytes at byte "
-                     << functions_section_size << ')' << endl;
+                cout << " (" << compiled.size << " bytes at byte "
+                     << functions_section_size << ", cached)" << endl;
+            }
+        } else {
+            viua::internals::types::bytecode_size fun_bytes = 0;
+            try {
+                fun_bytes = viua::cg::tools::calculate_bytecode_size2(
+                    functions.tokens.at(name));
+                if (VERBOSE or DEBUG) {
+                    cout << " (" << fun_bytes << " bytes at byte "
+                         << functions_section_size << ')' << endl;
+                }
+            } catch (const string& e) {
+                throw("failed function size count (during pre-assembling): " + e);
+            } catch (const std::out_of_range& e) {
+                throw e.what();
             }
-        } catch (const string& e) {
-            throw("failed function size count (during pre-assembling): " + e);
-        } catch (const std::out_of_range& e) {
-            throw e.what();
-        }
 
-        Program func(fun_bytes);
-        func.setdebug(DEBUG).setscream(SCREAM);
-        try {
-            if (DEBUG) {
-                cout << send_control_seq(COLOR_FG_WHITE) << filename
-                     << send_control_seq(ATTR_RESET);
-                cout << ": ";
-                cout << send_control_seq(COLOR_FG_YELLOW) << "debug"
-                     << send_control_seq(ATTR_RESET);
-                cout << ": ";
-                cout << "assembling function '";
-                cout << send_control_seq(COLOR_FG_LIGHT_GREEN) << name
-                     << send_control_seq(ATTR_RESET);
-                cout << "'\n";
+            Program func(fun_bytes);
+            func.setdebug(DEBUG).setscream(SCREAM);
+            try {
+                if (DEBUG) {
+                    cout << send_control_seq(COLOR_FG_WHITE) << filename
+                         << send_control_seq(ATTR_RESET);
+                    cout << ": ";
+                    cout << send_control_seq(COLOR_FG_YELLOW) << "debug"
+                         << send_control_seq(ATTR_RESET);
+                    cout << ": ";
+                    cout << "assembling function '";
+                    cout << send_control_seq(COLOR_FG_LIGHT_GREEN) << name
+                         << send_control_seq(ATTR_RESET);
+                    cout << "'\n";
+                }
+                assemble(func, strip_attributes(functions.tokens.at(name)));
+            } catch (const string& e) {
+                string msg =
+                    ("in function '" + send_control_seq(COLOR_FG_LIGHT_GREEN) + name
+                     + send_control_seq(ATTR_RESET) + "': " + e);
+                throw msg;
+            } catch (const char*& e) {
+                string msg =
+                    ("in function '" + send_control_seq(COLOR_FG_LIGHT_GREEN) + name
+                     + send_control_seq(ATTR_RESET) + "': " + e);
+                throw msg;
+            } catch (const std::out_of_range& e) {
+                string msg =
+                    ("in function '" + send_control_seq(COLOR_FG_LIGHT_GREEN) + name
+                     + send_control_seq(ATTR_RESET) + "': " + e.what());
+                throw msg;
             }
-            assemble(func, strip_attributes(functions.tokens.at(name)));
-        } catch (const string& e) {
-            string msg =
-                ("in function '" + send_control_seq(COLOR_FG_LIGHT_GREEN) + name
-                 + send_control_seq(ATTR_RESET) + "': " + e);
-            throw msg;
-        } catch (const char*& e) {
-            string msg =
-                ("in function '" + send_control_seq(COLOR_FG_LIGHT_GREEN) + name
-                 + send_control_seq(ATTR_RESET) + "': " + e);
-            throw msg;
-        } catch (const std::out_of_range& e) {
-            string msg =
-                ("in function '" + send_control_seq(COLOR_FG_LIGHT_GREEN) + name
-                 + send_control_seq(ATTR_RESET) + "': " + e.what());
-            throw msg;
-        }
 
-        vector<viua::internals::types::bytecode_size> jumps = func.jumps();
+            vector<viua::internals::types::bytecode_size> jumps = func.jumps();
 
-        vector<tuple<viua::internals::types::bytecode_size,
-                     viua::internals::types::bytecode_size>>
-            local_jumps;
-        for (decltype(jumps)::size_type i = 0; i < jumps.size(); ++i) {
-            viua::internals::types::bytecode_size jmp = jumps[i];
-            local_jumps.emplace_back(jmp, functions_section_size);
+            vector<tuple<viua::internals::types::bytecode_size,
+                         viua::internals::types::bytecode_size>>
+                local_jumps;
+            for (decltype(jumps)::size_type i = 0; i < jumps.size(); ++i) {
+                viua::internals::types::bytecode_size jmp = jumps[i];
+                local_jumps.emplace_back(
+                    jmp, viua::internals::types::bytecode_size{0});
+            }
+            func.calculate_jumps(local_jumps, functions.tokens.at(name));
+
+            compiled.size     = func.size();
+            compiled.bytecode = func.bytecode();
+            compiled.jumps    = std::move(jumps);
+            if (flags.cache) {
+                flags.cache->store(cache_key, compiled);
+            }
         }
-        func.calculate_jumps(local_jumps, functions.tokens.at(name));
 
-        auto btcode = func.bytecode();
+        // bytecode was generated as if the function was placed at the very
+        // beginning of the section so jump targets must be adjusted
+        compiled.relocate(functions_section_size);
 
         // store generated bytecode fragment for future use (we must not yet
         // write it to the file to conform to bytecode format)
         functions_bytecode[name] =
-            tuple<viua::internals::types::bytecode_size, decltype(btcode)>{
-                func.size(), std::move(btcode)};
+            tuple<viua::internals::types::bytecode_size,
+                  unique_ptr<viua::internals::types::byte[]>>{
+                compiled.size, std::move(compiled.bytecode)};
 
         // extend jump table with jumps from current function
-        for (decltype(jumps)::size_type i = 0; i < jumps.size(); ++i) {
-            viua::internals::types::bytecode_size jmp = jumps[i];
+        for (auto const jmp : compiled.jumps) {
             if (DEBUG) {
                 cout << send_control_seq(COLOR_FG_WHITE) << filename
                      << send_control_seq(ATTR_RESET);
@@ -1018,7 +1066,7 @@ void generate(vector<Token> const& tokens,
             jump_table.emplace_back(jmp + functions_section_size);
         }
 
-        functions_section_size += func.size();
+        functions_section_size += compiled.size;
     }
 
 
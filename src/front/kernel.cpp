@@ -86,7 +86,9 @@ static bool usage(const string program, const vector<string>& args) {
              << "\", \"sched\": {\"ffi\": "
              << viua::kernel::Kernel::no_of_ffi_schedulers() << ", ";
         cout << "\"vp\": " << viua::kernel::Kernel::no_of_vp_schedulers()
-             << "}}\n";
+             << "}, ";
+        cout << "\"baseline\": "
+             << viua::kernel::Kernel::baseline_compiler_threshold() << "}\n";
         return true;
     }
 
@@ -105,7 +107,14 @@ static bool usage(const string program, const vector<string>& args) {
              << ']';
         cout << ' ';
         cout << "[sched:vp=" << viua::kernel::Kernel::no_of_vp_schedulers()
-             << ']' << endl;
+             << ']';
+        cout << ' ';
+        if (auto const threshold =
+                viua::kernel::Kernel::baseline_compiler_threshold()) {
+            cout << "[baseline=" << threshold << ']' << endl;
+        } else {
+            cout << "[baseline=off]" << endl;
+        }
     }
     if (show_help) {
         cout << "\nUSAGE:\n";
@@ -124,6 +133,15 @@ static bool usage(const string program, const vector<string>& args) {
                "version etc.)\n"
             << "    "
             << "    --json               - same as --info but in JSON format\n";
+        cout << "\nENVIRONMENT:\n";
+        cout << "    "
+             << "VIUA_BASELINE_COMPILER=no    - run all code in the "
+                "interpreter\n"
+             << "    "
+             << "VIUA_BASELINE_THRESHOLD=<n>  - number of calls (or loop "
+                "iterations) after\n"
+             << "                                   which a function is "
+                "compiled\n";
     }
 
     return (show_help or show_version or show_info);
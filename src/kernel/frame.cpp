@@ -26,6 +26,23 @@ void Frame::set_local_register_set(viua::kernel::RegisterSet* rs,
                                    bool receives_ownership) {
     local_register_set.reset(rs, receives_ownership);
 }
+auto Frame::reaches(viua::types::Value const* value) -> bool {
+    if (arguments and arguments->reaches(value)) {
+        return true;
+    }
+    if (local_register_set.get() and local_register_set.get()->reaches(value)) {
+        return true;
+    }
+    if (return_value and return_value->reaches(value)) {
+        return true;
+    }
+    for (auto const& each : deferred_calls) {
+        if (each->reaches(value)) {
+            return true;
+        }
+    }
+    return (postponed_frame_new and postponed_frame_new->reaches(value));
+}
 
 Frame::Frame(viua::internals::types::byte* ra,
              viua::internals::types::register_index argsize,
@@ -17,9 +17,11 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <dlfcn.h>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -37,6 +39,7 @@
 #include <viua/support/env.h>
 #include <viua/support/pointer.h>
 #include <viua/support/string.h>
+#include <viua/types/closure.h>
 #include <viua/types/exception.h>
 #include <viua/types/function.h>
 #include <viua/types/integer.h>
@@ -49,22 +52,76 @@ using namespace std;
 
 
 viua::kernel::Mailbox::Mailbox(Mailbox&& that)
-        : messages(std::move(that.messages)) {}
+        : messages(std::move(that.messages)), owner(that.owner) {}
 
-auto viua::kernel::Mailbox::send(unique_ptr<viua::types::Value> message)
-    -> void {
+auto viua::kernel::Mailbox::open(
+    viua::process::PID::generation_type const generation) -> void {
     unique_lock<mutex> lck{mailbox_mutex};
-    messages.push_back(std::move(message));
+    owner = generation;
+}
+auto viua::kernel::Mailbox::close() -> void {
+    unique_lock<mutex> lck{mailbox_mutex};
+    owner   = 0;
+    waiting = nullptr;
+    messages.clear();
 }
 
-auto viua::kernel::Mailbox::receive(queue<unique_ptr<viua::types::Value>>& mq)
-    -> void {
+auto viua::kernel::Mailbox::send(
+    viua::process::PID::generation_type const generation,
+    unique_ptr<viua::types::Value> message) -> void {
     unique_lock<mutex> lck{mailbox_mutex};
+    if (generation != owner) {
+        /*
+         * The slot has been reused after the lookup so the message was sent
+         * to a process that is no longer running.
+         */
+        return;
+    }
+    messages.push_back(std::move(message));
+    wake_waiting_process();
+}
+auto viua::kernel::Mailbox::send(
+    viua::process::PID::generation_type const generation,
+    vector<unique_ptr<viua::types::Value>> batch) -> void {
+    unique_lock<mutex> lck{mailbox_mutex};
+    if (generation != owner) {
+        return;
+    }
+    messages.reserve(messages.size() + batch.size());
+    for (auto& message : batch) {
+        messages.push_back(std::move(message));
+    }
+    if (not messages.empty()) {
+        wake_waiting_process();
+    }
+}
+auto viua::kernel::Mailbox::receive(deque<unique_ptr<viua::types::Value>>& mq,
+                                    viua::process::Process* waiter) -> void {
+    unique_lock<mutex> lck{mailbox_mutex};
+    waiting = nullptr;
+    if (messages.empty()) {
+        /*
+         * The process is suspended while the mailbox is locked so that a
+         * message sent concurrently cannot slip in between the check and the
+         * suspension, and leave the process asleep with a message waiting.
+         */
+        if (waiter) {
+            waiter->suspend();
+            waiting = waiter;
+        }
+        return;
+    }
     for (auto& message : messages) {
-        mq.push(std::move(message));
+        mq.push_back(std::move(message));
     }
     messages.clear();
 }
+auto viua::kernel::Mailbox::wake_waiting_process() -> void {
+    if (waiting) {
+        waiting->wakeup();
+        waiting = nullptr;
+    }
+}
 
 auto viua::kernel::Mailbox::size() const -> decltype(messages)::size_type {
     unique_lock<mutex> lck{mailbox_mutex};
@@ -110,6 +167,12 @@ auto viua::kernel::ProcessResult::transfer_result()
     unique_lock<mutex> lck{result_mutex};
     return std::move(value_returned);
 }
+auto viua::kernel::ProcessResult::reset() -> void {
+    unique_lock<mutex> lck{result_mutex};
+    value_returned.reset();
+    exception_thrown.reset();
+    done.store(false, std::memory_order_release);
+}
 
 
 viua::kernel::Kernel& viua::kernel::Kernel::load(
@@ -143,9 +206,19 @@ viua::kernel::Kernel& viua::kernel::Kernel::mapfunction(
     /** Maps function name to bytecode address.
      */
     function_addresses[name] = address;
+    assign_function_id(name);
     return (*this);
 }
 
+auto viua::kernel::Kernel::assign_function_id(string const& name) -> void {
+    /*
+     * Functions that are loaded again keep the identifiers they were given
+     * the first time.
+     */
+    unique_lock<mutex> lck{function_ids_mutex};
+    function_ids.emplace(name, function_ids.size());
+}
+
 viua::kernel::Kernel& viua::kernel::Kernel::mapblock(
     const string& name,
     viua::internals::types::bytecode_size address) {
@@ -251,6 +324,7 @@ void viua::kernel::Kernel::load_native_library(const string& module) {
             linked_functions[fn_linkname] =
                 pair<string, viua::internals::types::byte*>(
                     module, (lnk_btcd.get() + fn_addrs.at(fn_linkname)));
+            assign_function_id(fn_linkname);
         }
 
         auto const bl_names = loader.get_blocks();
@@ -372,6 +446,17 @@ bool viua::kernel::Kernel::is_native_function(const string& name) const {
     return (function_addresses.count(name) or linked_functions.count(name));
 }
 
+auto viua::kernel::Kernel::function_id_of(string const& name) const
+    -> viua::internals::types::function_id {
+    unique_lock<mutex> lck{function_ids_mutex};
+    auto const id = function_ids.find(name);
+    if (id == function_ids.end()) {
+        throw make_unique<viua::types::Exception>(
+            "no identifier for function: " + name);
+    }
+    return id->second;
+}
+
 bool viua::kernel::Kernel::is_foreign_method(const string& name) const {
     return foreign_methods.count(name);
 }
@@ -467,51 +552,44 @@ void viua::kernel::Kernel::request_foreign_method_call(
 }
 
 void viua::kernel::Kernel::post_free_process(
-    unique_ptr<viua::process::Process> p) {
+    unique_ptr<viua::process::Process> p,
+    viua::scheduler::Topology::node_type const node) {
     unique_lock<mutex> lock(free_virtual_processes_mutex);
-    free_virtual_processes.emplace_back(std::move(p));
+    free_virtual_processes.at(node).emplace_back(std::move(p));
     lock.unlock();
     free_virtual_processes_cv.notify_one();
 }
 
-auto viua::kernel::Kernel::create_mailbox(const viua::process::PID pid)
-    -> viua::internals::types::processes_count {
-    unique_lock<mutex> lck(mailbox_mutex);
+auto viua::kernel::Kernel::create_process_slot() -> viua::process::PID {
+    auto const pid = process_table.allocate();
 #if VIUA_VM_DEBUG_LOG
-    cerr << "[kernel:mailbox:create] pid = " << pid.get() << endl;
+    cerr << "[kernel:process-table:create] pid = " << pid.str() << endl;
 #endif
-    mailboxes.emplace(pid, Mailbox{});
-    return ++running_processes;
+    return pid;
 }
-auto viua::kernel::Kernel::delete_mailbox(const viua::process::PID pid)
-    -> viua::internals::types::processes_count {
-    unique_lock<mutex> lck(mailbox_mutex);
+auto viua::kernel::Kernel::delete_process_slot(const viua::process::PID pid)
+    -> void {
 #if VIUA_VM_DEBUG_LOG
-    cerr << "[kernel:mailbox:delete] pid = " << pid.get()
-         << ", queued messages = " << mailboxes[pid].size() << endl;
+    cerr << "[kernel:process-table:delete] pid = " << pid.str() << endl;
 #endif
-    mailboxes.erase(pid);
-    return --running_processes;
+    process_table.retire(pid);
 }
 auto viua::kernel::Kernel::create_result_slot_for(viua::process::PID pid)
     -> void {
-    unique_lock<mutex> lck{process_results_mutex};
-    process_results.emplace(pid, ProcessResult{});
+    process_table.make_joinable(pid);
 }
 auto viua::kernel::Kernel::detach_process(const viua::process::PID pid)
     -> void {
-    unique_lock<mutex> lck{process_results_mutex};
-    process_results.erase(pid);
+    process_table.detach(pid);
 }
 auto viua::kernel::Kernel::record_process_result(
     viua::process::Process* done_process) -> void {
-    unique_lock<mutex> lck{process_results_mutex};
-
-    if (process_results.count(done_process->pid()) == 0) {
+    auto slot = process_table.find(done_process->pid());
+    if (slot == nullptr or not slot->joinable.load(memory_order_acquire)) {
         return;
     }
 
-    if (process_results.at(done_process->pid()).stopped()) {
+    if (slot->result.stopped()) {
         /*
          * FIXME a process cannot return twice
          */
@@ -519,78 +597,124 @@ auto viua::kernel::Kernel::record_process_result(
     }
 
     if (done_process->terminated()) {
-        process_results.at(done_process->pid())
-            .raise(done_process->transfer_active_exception());
+        slot->result.raise(done_process->transfer_active_exception());
     } else {
-        process_results.at(done_process->pid())
-            .resolve(done_process->get_return_value());
+        slot->result.resolve(done_process->get_return_value());
     }
 }
 auto viua::kernel::Kernel::is_process_joinable(
     const viua::process::PID pid) const -> bool {
-    unique_lock<mutex> lck{process_results_mutex};
-    return process_results.count(pid);
+    auto slot = process_table.find(pid);
+    return (slot != nullptr and slot->joinable.load(memory_order_acquire));
 }
+/*
+ * A PID may become stale while the process is being joined only if some
+ * other process joined it first.
+ * Such processes are reported as terminated and get an exception when they
+ * try to fetch the result.
+ */
 auto viua::kernel::Kernel::is_process_stopped(
     const viua::process::PID pid) const -> bool {
-    unique_lock<mutex> lck{process_results_mutex};
-    return process_results.at(pid).stopped();
+    auto slot = process_table.find(pid);
+    return (slot == nullptr or slot->result.stopped());
 }
 auto viua::kernel::Kernel::is_process_terminated(
     const viua::process::PID pid) const -> bool {
-    unique_lock<mutex> lck{process_results_mutex};
-    return process_results.at(pid).terminated();
+    auto slot = process_table.find(pid);
+    return (slot == nullptr or slot->result.terminated());
 }
 auto viua::kernel::Kernel::transfer_exception_of(const viua::process::PID pid)
     -> unique_ptr<viua::types::Value> {
-    unique_lock<mutex> lck{process_results_mutex};
-    auto tmp = process_results.at(pid).transfer_exception();
-    process_results.erase(pid);
+    auto slot = process_table.find(pid);
+    if (slot == nullptr) {
+        return make_unique<viua::types::Exception>("invalid PID");
+    }
+    auto tmp = slot->result.transfer_exception();
+    process_table.detach(pid);
     return tmp;
 }
 auto viua::kernel::Kernel::transfer_result_of(const viua::process::PID pid)
     -> unique_ptr<viua::types::Value> {
-    unique_lock<mutex> lck{process_results_mutex};
-    auto tmp = process_results.at(pid).transfer_result();
-    process_results.erase(pid);
+    auto slot = process_table.find(pid);
+    if (slot == nullptr) {
+        throw make_unique<viua::types::Exception>("invalid PID");
+    }
+    auto tmp = slot->result.transfer_result();
+    process_table.detach(pid);
     return tmp;
 }
 
 void viua::kernel::Kernel::send(const viua::process::PID pid,
                                 unique_ptr<viua::types::Value> message) {
-    unique_lock<mutex> lck(mailbox_mutex);
-    if (mailboxes.count(pid) == 0) {
+    auto slot = process_table.find(pid);
+    if (slot == nullptr) {
         // sending a message to an unknown address just drops the message
         // instead of crashing the sending process
         return;
     }
 #if VIUA_VM_DEBUG_LOG
-    cerr << "[kernel:receive:send] pid = " << pid.get()
-         << ", queued messages = " << mailboxes[pid].size() << "+1" << endl;
+    cerr << "[kernel:receive:send] pid = " << pid.str()
+         << ", queued messages = " << slot->mailbox.size() << "+1" << endl;
 #endif
-    mailboxes[pid].send(std::move(message));
+    slot->mailbox.send(pid.generation(), std::move(message));
+}
+void viua::kernel::Kernel::send(const viua::process::PID pid,
+                                vector<unique_ptr<viua::types::Value>> batch) {
+    auto slot = process_table.find(pid);
+    if (slot == nullptr) {
+        return;
+    }
+#if VIUA_VM_DEBUG_LOG
+    cerr << "[kernel:receive:send] pid = " << pid.str()
+         << ", queued messages = " << slot->mailbox.size() << "+"
+         << batch.size() << endl;
+#endif
+    slot->mailbox.send(pid.generation(), std::move(batch));
+}
+void viua::kernel::Kernel::broadcast(vector<viua::process::PID> const& pids,
+                                     unique_ptr<viua::types::Value> message) {
+    if (pids.empty()) {
+        return;
+    }
+
+    /*
+     * The last receiver gets the original message, and all the others get
+     * copies.
+     * Copies of a closure share its register set so they must be isolated
+     * before they are handed to different processes.
+     */
+    auto const last = (pids.size() - 1);
+    for (auto i = decltype(pids.size()){0}; i < last; ++i) {
+        auto copy = message->copy();
+        if (auto closure = dynamic_cast<viua::types::Closure*>(copy.get())) {
+            closure->isolate();
+        }
+        send(pids[i], std::move(copy));
+    }
+    send(pids[last], std::move(message));
 }
 void viua::kernel::Kernel::receive(
     const viua::process::PID pid,
-    queue<unique_ptr<viua::types::Value>>& message_queue) {
-    unique_lock<mutex> lck(mailbox_mutex);
-    if (mailboxes.count(pid) == 0) {
+    deque<unique_ptr<viua::types::Value>>& message_queue,
+    viua::process::Process* waiter) {
+    auto slot = process_table.find(pid);
+    if (slot == nullptr) {
         throw make_unique<viua::types::Exception>("invalid PID");
     }
 
 #if VIUA_VM_DEBUG_LOG
-    cerr << "[kernel:receive:pre] pid = " << pid.get()
+    cerr << "[kernel:receive:pre] pid = " << pid.str()
          << ", queued messages = " << message_queue.size() << endl;
 #endif
-    mailboxes[pid].receive(message_queue);
+    slot->mailbox.receive(message_queue, waiter);
 #if VIUA_VM_DEBUG_LOG
-    cerr << "[kernel:receive:post] pid = " << pid.get()
+    cerr << "[kernel:receive:post] pid = " << pid.str()
          << ", queued messages = " << message_queue.size() << endl;
 #endif
 }
 
 uint64_t viua::kernel::Kernel::pids() const {
-    return running_processes;
+    return process_table.size();
 }
 
 int viua::kernel::Kernel::exit() const {
@@ -630,6 +754,228 @@ auto viua::kernel::Kernel::is_tracing_enabled() -> bool {
             or viua_enable_tracing == "1");
 }
 
+auto viua::kernel::Kernel::is_pinning_enabled() -> bool {
+    auto const env_text = getenv("VIUA_PIN_SCHEDULERS");
+    auto const pin      = string{env_text ? env_text : ""};
+    return (pin == "yes" or pin == "true" or pin == "1");
+}
+
+auto viua::kernel::Kernel::profile_output_path() -> string {
+    char* env_text = getenv("VIUA_PROFILE_OUTPUT");
+    return (env_text ? string(env_text) : string{});
+}
+
+auto viua::kernel::Kernel::scheduler_statistics_path() -> string {
+    char* env_text = getenv("VIUA_SCHEDULER_STATISTICS");
+    return (env_text ? string(env_text) : string{});
+}
+
+/*
+ * Writes a line for every priority class:
+ *
+ *      <class> <quanta> <mean latency in ns> <max latency in ns>
+ *
+ * where latency is the time processes of the class waited in run queues
+ * between becoming runnable and getting the processor.
+ */
+static auto write_scheduler_statistics(
+    string const& path,
+    vector<viua::scheduler::VirtualProcessScheduler> const& schedulers)
+    -> void {
+    auto out = ofstream{path, ios::out | ios::trunc};
+    if (not out) {
+        cerr << "could not write scheduler statistics to: " << path << endl;
+        return;
+    }
+
+    auto latency = std::array<viua::process::Run_queue_latency,
+                              viua::process::priority_classes>{};
+    for (auto const& each : schedulers) {
+        for (auto i = size_t{0}; i < latency.size(); ++i) {
+            latency.at(i).merge(each.run_queue_latency().at(i));
+        }
+    }
+    for (auto i = size_t{0}; i < latency.size(); ++i) {
+        out << viua::process::to_string(
+                   static_cast<viua::process::Priority_class>(i))
+            << ' ' << latency.at(i).quanta << ' '
+            << latency.at(i).mean().count() << ' '
+            << latency.at(i).max.count() << '\n';
+    }
+}
+
+auto viua::kernel::Kernel::is_profiling_enabled() const -> bool {
+    return (not profile_output.empty());
+}
+auto viua::kernel::Kernel::record_profile_of(
+    viua::process::Process const* done_process) -> void {
+    auto const profile = done_process->collected_profile();
+    if (not profile) {
+        return;
+    }
+
+    unique_lock<mutex> lck{collected_profile_mutex};
+    collected_profile.merge(*profile);
+}
+auto viua::kernel::Kernel::resolve_profile() const -> Profile {
+    /*
+     * Raw profiles record addresses of instructions.
+     * They are resolved to names of invocables containing them (and offsets
+     * from the beginnings of these invocables) using entry points of
+     * functions and blocks of every module loaded into the kernel.
+     */
+    using offset_type = viua::internals::types::bytecode_size;
+    struct Module_map {
+        viua::internals::types::byte const* base;
+        offset_type size;
+        map<offset_type, string> entry_points;
+    };
+
+    auto modules = vector<Module_map>{};
+    modules.push_back(Module_map{bytecode.get(), bytecode_size, {}});
+    for (auto const& each : function_addresses) {
+        modules.front().entry_points[each.second] = each.first;
+    }
+    for (auto const& each : block_addresses) {
+        modules.front().entry_points[each.second] = each.first;
+    }
+
+    auto module_indexes = map<string, decltype(modules)::size_type>{};
+    for (auto const& each : linked_modules) {
+        module_indexes[each.first] = modules.size();
+        modules.push_back(
+            Module_map{each.second.second.get(), each.second.first, {}});
+    }
+    for (auto const* linked : {&linked_functions, &linked_blocks}) {
+        for (auto const& each : *linked) {
+            auto& module = modules.at(module_indexes.at(each.second.first));
+            module.entry_points[static_cast<offset_type>(
+                each.second.second - module.base)] = each.first;
+        }
+    }
+
+    auto const resolve = [&modules](Raw_profile::address_type const address)
+        -> Profile::location_type {
+        for (auto const& module : modules) {
+            if (address < module.base or address >= module.base + module.size) {
+                continue;
+            }
+            auto const offset = static_cast<offset_type>(address - module.base);
+            auto it           = module.entry_points.upper_bound(offset);
+            if (it == module.entry_points.begin()) {
+                break;
+            }
+            --it;
+            return {it->second, (offset - it->first)};
+        }
+        return {"?", 0};
+    };
+
+    auto profile     = Profile{};
+    profile.calls    = collected_profile.calls;
+    profile.messages = collected_profile.messages;
+    for (auto const& each : collected_profile.branches) {
+        auto& counters = profile.branches[resolve(each.first)];
+        counters.first += each.second.first;
+        counters.second += each.second.second;
+    }
+    for (auto const& each : collected_profile.jumps) {
+        profile.jumps[resolve(each.first)] += each.second;
+    }
+    for (auto const& each : collected_profile.loops) {
+        profile.loops[resolve(each.first)] += each.second;
+    }
+    return profile;
+}
+auto viua::kernel::Kernel::write_profile() const -> void {
+    auto out = ofstream{profile_output, ios::out | ios::trunc};
+    if (not out) {
+        cerr << "could not write profile to: " << profile_output << endl;
+        return;
+    }
+    resolve_profile().write(out);
+}
+
+auto viua::kernel::Kernel::baseline_compiler_threshold() -> uint64_t {
+    char* env_enabled = getenv("VIUA_BASELINE_COMPILER");
+    if (env_enabled) {
+        auto const enabled = string(env_enabled);
+        if (enabled == "no" or enabled == "false" or enabled == "0") {
+            return 0;
+        }
+    }
+
+    auto threshold   = default_baseline_threshold;
+    char* env_thresh = getenv("VIUA_BASELINE_THRESHOLD");
+    if (env_thresh != nullptr) {
+        auto const raw_threshold = stoll(env_thresh);
+        if (raw_threshold > 0) {
+            threshold = static_cast<decltype(threshold)>(raw_threshold);
+        }
+    }
+    return threshold;
+}
+auto viua::kernel::Kernel::baseline_compilation_threshold() const
+    -> uint64_t {
+    return baseline_threshold;
+}
+auto viua::kernel::Kernel::code_extent_of(string const& name) const
+    -> pair<viua::internals::types::byte*, viua::internals::types::byte*> {
+    /*
+     * Functions and blocks are laid out one after another, so the code of
+     * a function ends where the next invocable in the same module begins (or
+     * where the module ends).
+     */
+    auto const entry = get_entry_point_of(name);
+    auto const base  = entry.second;
+
+    auto end = (base + bytecode_size);
+    if (base != bytecode.get()) {
+        end = (base + linked_modules.at(linked_functions.at(name).first).first);
+    }
+    auto const closer = [&entry, &end](viua::internals::types::byte* each) {
+        if (each > entry.first and each < end) {
+            end = each;
+        }
+    };
+    if (base == bytecode.get()) {
+        for (auto const& each : function_addresses) {
+            closer(bytecode.get() + each.second);
+        }
+        for (auto const& each : block_addresses) {
+            closer(bytecode.get() + each.second);
+        }
+    } else {
+        for (auto const* linked : {&linked_functions, &linked_blocks}) {
+            for (auto const& each : *linked) {
+                closer(each.second.second);
+            }
+        }
+    }
+
+    return {entry.first, end};
+}
+auto viua::kernel::Kernel::compile_baseline(string const& name)
+    -> viua::process::Baseline_function const* {
+    unique_lock<mutex> lck{baseline_functions_mutex};
+
+    auto& compiled = baseline_functions[name];
+    if (not compiled) {
+        auto const extent = code_extent_of(name);
+        compiled          = make_unique<viua::process::Baseline_function>(
+            extent.first, extent.second, get_entry_point_of(name).second);
+    }
+    return compiled.get();
+}
+auto viua::kernel::Kernel::compiled_baseline_of(string const& name)
+    -> viua::process::Baseline_function const* {
+    unique_lock<mutex> lck{baseline_functions_mutex};
+
+    auto const compiled = baseline_functions.find(name);
+    return ((compiled == baseline_functions.end()) ? nullptr
+                                                   : compiled->second.get());
+}
+
 int viua::kernel::Kernel::run() {
     /*  VM viua::kernel::Kernel implementation.
      */
@@ -639,28 +985,46 @@ int viua::kernel::Kernel::run() {
 
     vp_schedulers_limit = no_of_vp_schedulers();
     bool enable_tracing = is_tracing_enabled();
+    profile_output      = profile_output_path();
+    baseline_threshold  = baseline_compiler_threshold();
 
     vector<viua::scheduler::VirtualProcessScheduler> vp_schedulers;
 
     // reserver memory for all schedulers ahead of time
     vp_schedulers.reserve(vp_schedulers_limit);
 
+    /*
+     * Schedulers that are not pinned all belong to the same node as there is
+     * no telling on which CPUs they will run.
+     */
+    auto const node_of = [this](uint64_t const n) {
+        return (pin_schedulers ? topology.placement_of(n).first
+                               : viua::scheduler::Topology::node_type{0});
+    };
+
     vp_schedulers.emplace_back(this,
                                &free_virtual_processes,
                                &free_virtual_processes_mutex,
                                &free_virtual_processes_cv,
+                               node_of(0),
                                enable_tracing);
     vp_schedulers.front().bootstrap(commandline_arguments);
 
-    for (auto i = (vp_schedulers_limit - 1); i; --i) {
+    for (auto i = uint64_t{1}; i < vp_schedulers_limit; ++i) {
         vp_schedulers.emplace_back(this,
                                    &free_virtual_processes,
                                    &free_virtual_processes_mutex,
-                                   &free_virtual_processes_cv);
+                                   &free_virtual_processes_cv,
+                                   node_of(i));
     }
 
-    for (auto& sched : vp_schedulers) {
-        sched.launch();
+    for (auto i = uint64_t{0}; i < vp_schedulers.size(); ++i) {
+        auto& sched = vp_schedulers.at(i);
+        if (pin_schedulers) {
+            sched.launch(topology.placement_of(i).second);
+        } else {
+            sched.launch();
+        }
     }
 
     for (auto& sched : vp_schedulers) {
@@ -670,6 +1034,15 @@ int viua::kernel::Kernel::run() {
 
     return_code = vp_schedulers.front().exit();
 
+    if (is_profiling_enabled()) {
+        write_profile();
+    }
+
+    auto const statistics_output = scheduler_statistics_path();
+    if (not statistics_output.empty()) {
+        write_scheduler_statistics(statistics_output, vp_schedulers);
+    }
+
     return return_code;
 }
 
@@ -680,17 +1053,32 @@ viua::kernel::Kernel::Kernel()
         , return_code(0)
         , vp_schedulers_limit(default_vp_schedulers_limit)
         , ffi_schedulers_limit(default_ffi_schedulers_limit)
+        , pin_schedulers(is_pinning_enabled())
+        , topology(pin_schedulers ? viua::scheduler::Topology::discover()
+                                  : viua::scheduler::Topology{})
+        , baseline_threshold(0)
         , debug(false)
         , errors(false) {
+    free_virtual_processes.resize(pin_schedulers ? topology.nodes() : 1);
+
     ffi_schedulers_limit = no_of_ffi_schedulers();
     for (auto i = ffi_schedulers_limit; i; --i) {
-        foreign_call_workers.emplace_back(
-            make_unique<std::thread>(viua::scheduler::ffi::ff_call_processor,
-                                     &foreign_call_queue,
-                                     &foreign_functions,
-                                     &foreign_functions_mutex,
-                                     &foreign_call_queue_mutex,
-                                     &foreign_call_queue_condition));
+        /*
+         * FFI schedulers are spread over the machine in the same way as VP
+         * schedulers are, and pin themselves before they take any calls.
+         */
+        auto const n = foreign_call_workers.size();
+        foreign_call_workers.emplace_back(make_unique<std::thread>([this, n] {
+            if (pin_schedulers) {
+                viua::scheduler::pin(topology.placement_of(n).second);
+            }
+            viua::scheduler::ffi::ff_call_processor(
+                &foreign_call_queue,
+                &foreign_functions,
+                &foreign_functions_mutex,
+                &foreign_call_queue_mutex,
+                &foreign_call_queue_condition);
+        }));
     }
 }
 
@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <viua/kernel/kernel.h>
+#include <viua/types/exception.h>
+using namespace std;
+
+
+namespace viua { namespace kernel {
+constexpr Process_table::index_type Process_table::chunk_size;
+constexpr Process_table::index_type Process_table::max_chunks;
+constexpr Process_table::index_type Process_table::no_slot;
+constexpr size_t Process_table::counter_shards;
+
+auto Process_table::counter() -> Counter& {
+    static atomic<size_t> next_shard{0};
+    thread_local auto const shard =
+        (next_shard.fetch_add(1, memory_order_relaxed) % counter_shards);
+    return running[shard];
+}
+
+auto Process_table::slot_at(index_type const index) const -> Slot* {
+    auto const chunk = chunks[index / chunk_size].load(memory_order_acquire);
+    return (chunk ? (chunk + (index % chunk_size)) : nullptr);
+}
+
+auto Process_table::take_free_slot() -> index_type {
+    auto head = free_head.load(memory_order_acquire);
+    while (true) {
+        auto const index = static_cast<index_type>(head);
+        if (index == no_slot) {
+            return no_slot;
+        }
+        auto const next = slot_at(index)->next_free.load(memory_order_relaxed);
+        auto const tag  = ((head >> 32) + 1);
+        if (free_head.compare_exchange_weak(head,
+                                            ((tag << 32) | next),
+                                            memory_order_acq_rel,
+                                            memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+auto Process_table::put_free_slot(index_type const index) -> void {
+    auto head = free_head.load(memory_order_relaxed);
+    auto tag  = uint64_t{0};
+    do {
+        slot_at(index)->next_free.store(static_cast<index_type>(head),
+                                        memory_order_relaxed);
+        tag = ((head >> 32) + 1);
+    } while (not free_head.compare_exchange_weak(
+        head, ((tag << 32) | index), memory_order_release, memory_order_relaxed));
+}
+
+auto Process_table::release(index_type const index) -> void {
+    auto slot = slot_at(index);
+    if (slot->holds.fetch_sub(1, memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    /*
+     * Bumping the generation to an even number invalidates all PIDs
+     * referring to the slot before it is put back on the free list.
+     */
+    slot->generation.fetch_add(1, memory_order_acq_rel);
+    slot->result.reset();
+    put_free_slot(index);
+}
+
+auto Process_table::allocate() -> viua::process::PID {
+    auto index = take_free_slot();
+    if (index == no_slot) {
+        index = next_unused.fetch_add(1, memory_order_relaxed);
+        if (index >= (chunk_size * max_chunks)) {
+            next_unused.fetch_sub(1, memory_order_relaxed);
+            throw make_unique<viua::types::Exception>("process table is full");
+        }
+
+        /*
+         * The first process to reach a chunk allocates it, but any process
+         * may get to it before the first one is done so the chunk is
+         * installed atomically and losers throw their chunks away.
+         */
+        auto& chunk = chunks[index / chunk_size];
+        if (chunk.load(memory_order_acquire) == nullptr) {
+            auto fresh    = make_unique<Slot[]>(chunk_size);
+            auto expected = static_cast<Slot*>(nullptr);
+            if (chunk.compare_exchange_strong(expected,
+                                              fresh.get(),
+                                              memory_order_acq_rel,
+                                              memory_order_acquire)) {
+                fresh.release();
+            }
+        }
+    }
+
+    auto slot = slot_at(index);
+    slot->holds.store(1, memory_order_relaxed);
+    slot->joinable.store(false, memory_order_relaxed);
+
+    auto const generation =
+        (slot->generation.load(memory_order_relaxed) + 1);
+    slot->mailbox.open(generation);
+    slot->generation.store(generation, memory_order_release);
+
+    counter().value.fetch_add(1, memory_order_relaxed);
+
+    return viua::process::PID{index, generation};
+}
+auto Process_table::retire(viua::process::PID const pid) -> void {
+    auto slot = find(pid);
+    if (slot == nullptr) {
+        return;
+    }
+    slot->mailbox.close();
+    counter().value.fetch_sub(1, memory_order_relaxed);
+    release(pid.index());
+}
+
+auto Process_table::make_joinable(viua::process::PID const pid) -> void {
+    auto slot = find(pid);
+    if (slot == nullptr or slot->joinable.exchange(true)) {
+        return;
+    }
+    slot->holds.fetch_add(1, memory_order_acq_rel);
+}
+auto Process_table::detach(viua::process::PID const pid) -> void {
+    auto slot = find(pid);
+    if (slot == nullptr or not slot->joinable.exchange(false)) {
+        return;
+    }
+    release(pid.index());
+}
+
+auto Process_table::find(viua::process::PID const pid) const -> Slot* {
+    if (pid.index() >= next_unused.load(memory_order_acquire)) {
+        return nullptr;
+    }
+    auto slot = slot_at(pid.index());
+    if (slot == nullptr
+        or slot->generation.load(memory_order_acquire) != pid.generation()) {
+        return nullptr;
+    }
+    return slot;
+}
+
+auto Process_table::size() const -> viua::internals::types::processes_count {
+    auto total = int64_t{0};
+    for (auto const& each : running) {
+        total += each.value.load(memory_order_relaxed);
+    }
+    return static_cast<viua::internals::types::processes_count>(
+        (total < 0) ? 0 : total);
+}
+
+Process_table::Process_table()
+        : chunks(make_unique<atomic<Slot*>[]>(max_chunks)) {}
+Process_table::~Process_table() {
+    for (auto i = index_type{0}; i < max_chunks; ++i) {
+        delete[] chunks[i].load(memory_order_relaxed);
+    }
+}
+}}  // namespace viua::kernel
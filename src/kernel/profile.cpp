@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include <viua/kernel/profile.h>
+using namespace std;
+
+
+namespace viua { namespace kernel {
+auto Raw_profile::call(string const& name) -> void {
+    ++calls[name];
+}
+auto Raw_profile::branch(address_type const at, bool const taken) -> void {
+    auto& counters = branches[at];
+    if (taken) {
+        ++counters.first;
+    } else {
+        ++counters.second;
+    }
+}
+auto Raw_profile::jump(address_type const at) -> void {
+    ++jumps[at];
+}
+auto Raw_profile::loop(address_type const at) -> void {
+    ++loops[at];
+}
+auto Raw_profile::message(string const& method, string const& receiver)
+    -> void {
+    ++messages[{method, receiver}];
+}
+
+auto Raw_profile::merge(Raw_profile const& other) -> void {
+    for (auto const& each : other.calls) {
+        calls[each.first] += each.second;
+    }
+    for (auto const& each : other.branches) {
+        auto& counters = branches[each.first];
+        counters.first += each.second.first;
+        counters.second += each.second.second;
+    }
+    for (auto const& each : other.jumps) {
+        jumps[each.first] += each.second;
+    }
+    for (auto const& each : other.loops) {
+        loops[each.first] += each.second;
+    }
+    for (auto const& each : other.messages) {
+        messages[each.first] += each.second;
+    }
+}
+
+
+auto Profile::calls_of(string const& name) const -> profile_counter_type {
+    auto const it = calls.find(name);
+    return (it == calls.end() ? 0 : it->second);
+}
+auto Profile::total_calls() const -> profile_counter_type {
+    auto total = profile_counter_type{0};
+    for (auto const& each : calls) {
+        total += each.second;
+    }
+    return total;
+}
+
+auto Profile::write(ostream& out) const -> void {
+    for (auto const& each : calls) {
+        out << "call " << each.first << ' ' << each.second << '\n';
+    }
+    for (auto const& each : branches) {
+        out << "branch " << each.first.first << ' ' << each.first.second << ' '
+            << each.second.first << ' ' << each.second.second << '\n';
+    }
+    for (auto const& each : jumps) {
+        out << "jump " << each.first.first << ' ' << each.first.second << ' '
+            << each.second << '\n';
+    }
+    for (auto const& each : loops) {
+        out << "loop " << each.first.first << ' ' << each.first.second << ' '
+            << each.second << '\n';
+    }
+    for (auto const& each : messages) {
+        out << "msg " << each.first.first << ' ' << each.first.second << ' '
+            << each.second << '\n';
+    }
+}
+
+auto Profile::read(istream& in) -> Profile {
+    auto profile = Profile{};
+
+    auto line    = string{};
+    auto line_no = decltype(profile.calls)::size_type{0};
+    while (getline(in, line)) {
+        ++line_no;
+        if (line.empty()) {
+            continue;
+        }
+
+        auto fields = istringstream{line};
+        auto kind   = string{};
+        fields >> kind;
+
+        /*
+         * Counters for the same location are summed so that profiles
+         * gathered during several runs of a program may be simply
+         * concatenated.
+         */
+        auto name      = string{};
+        auto offset    = viua::internals::types::bytecode_size{0};
+        auto count     = profile_counter_type{0};
+        auto not_taken = profile_counter_type{0};
+        auto receiver  = string{};
+        if (kind == "call" and fields >> name >> count) {
+            profile.calls[name] += count;
+        } else if (kind == "branch"
+                   and fields >> name >> offset >> count >> not_taken) {
+            auto& counters = profile.branches[{name, offset}];
+            counters.first += count;
+            counters.second += not_taken;
+        } else if (kind == "jump" and fields >> name >> offset >> count) {
+            profile.jumps[{name, offset}] += count;
+        } else if (kind == "loop" and fields >> name >> offset >> count) {
+            profile.loops[{name, offset}] += count;
+        } else if (kind == "msg" and fields >> name >> receiver >> count) {
+            profile.messages[{name, receiver}] += count;
+        } else {
+            throw("malformed profile line " + to_string(line_no) + ": "
+                  + line);
+        }
+    }
+
+    return profile;
+}
+}}  // namespace viua::kernel
@@ -21,6 +21,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <typeinfo>
 #include <viua/kernel/registerset.h>
 #include <viua/types/exception.h>
 #include <viua/types/integer.h>
@@ -29,14 +30,34 @@
 using namespace std;
 
 
-void viua::kernel::Register::reset(unique_ptr<viua::types::Value> o) {
-    if (dynamic_cast<viua::types::Reference*>(value.get())) {
+static auto is_a_reference(viua::types::Value const* const value) -> bool {
+    return (value != nullptr
+            and typeid(*value) == typeid(viua::types::Reference));
+}
+
+void viua::kernel::Register::store(unique_ptr<viua::types::Value> o,
+                                   bool const is_reference) {
+    /*
+     * Checking the mask instead of the dynamic type of the held value keeps
+     * plain writes (which are the overwhelming majority) down to a single,
+     * well-predicted branch.
+     */
+    if (mask & REFERENCE) {
         static_cast<viua::types::Reference*>(value.get())->rebind(o.release());
-    } else {
-        value = std::move(o);
+        return;
+    }
+
+    value = std::move(o);
+    if (is_reference) {
+        mask = static_cast<mask_type>(mask | REFERENCE);
     }
 }
 
+void viua::kernel::Register::reset(unique_ptr<viua::types::Value> o) {
+    auto const reference = is_a_reference(o.get());
+    store(std::move(o), reference);
+}
+
 bool viua::kernel::Register::empty() const {
     return value == nullptr;
 }
@@ -92,7 +113,9 @@ bool viua::kernel::Register::is_flagged(mask_type filter) const {
 viua::kernel::Register::Register() : value(nullptr), mask(0) {}
 
 viua::kernel::Register::Register(std::unique_ptr<viua::types::Value> o)
-        : value(std::move(o)), mask(0) {}
+        : value(std::move(o))
+        , mask(is_a_reference(value.get()) ? mask_type{REFERENCE}
+                                           : mask_type{0}) {}
 
 viua::kernel::Register::Register(Register&& that)
         : value(std::move(that.value)), mask(that.mask) {
@@ -104,15 +127,19 @@ viua::kernel::Register::operator bool() const {
 }
 
 auto viua::kernel::Register::operator=(Register&& that) -> Register& {
-    reset(std::move(that.value));
-    mask      = that.mask;
+    /*
+     * The mask of the source register already tells whether the moved value
+     * is a reference so there is no need to inspect it.
+     */
+    store(std::move(that.value), (that.mask & REFERENCE));
+    mask      = static_cast<mask_type>((mask & REFERENCE) | that.mask);
     that.mask = 0;
     return *this;
 }
 
 auto viua::kernel::Register::operator=(decltype(value)&& o) -> Register& {
     reset(std::move(o));
-    mask = 0;
+    mask = static_cast<mask_type>(mask & REFERENCE);
     return *this;
 }
 
@@ -151,12 +178,7 @@ void viua::kernel::RegisterSet::set(
             "register access out of bounds: write");
     }
 
-    if (dynamic_cast<viua::types::Reference*>(registers.at(index).get())) {
-        static_cast<viua::types::Reference*>(registers.at(index).get())
-            ->rebind(object.release());
-    } else {
-        registers.at(index).reset(std::move(object));
-    }
+    registers.at(index).reset(std::move(object));
 }
 
 viua::types::Value* viua::kernel::RegisterSet::get(
@@ -322,12 +344,15 @@ void viua::kernel::RegisterSet::clear(
     /** Clear masks for given register.
      *
      *  Performs bounds checking.
+     *  Does not clear the REFERENCE flag as it describes the contents of the
+     *  register, and not the way they should be treated.
      */
     if (index >= registerset_size) {
         throw make_unique<viua::types::Exception>(
             "register access out of bounds: mask_clear");
     }
-    registers.at(index).set_mask(0);
+    registers.at(index).set_mask(
+        static_cast<mask_type>(registers.at(index).get_mask() & REFERENCE));
 }
 
 bool viua::kernel::RegisterSet::isflagged(
@@ -343,7 +368,7 @@ bool viua::kernel::RegisterSet::isflagged(
             "register access out of bounds: mask_isenabled");
     }
     // FIXME: should throw when accessing empty register, but that breaks set()
-    if (index >= registers.size()) {
+    if (index < registers.size()) {
         return registers.at(index).is_flagged(filter);
     } else {
         return false;
@@ -402,6 +427,23 @@ void viua::kernel::RegisterSet::drop() {
     }
 }
 
+auto viua::kernel::RegisterSet::reset(
+    viua::internals::types::register_index const sz) -> void {
+    registers.clear();
+    registers.resize(sz);
+    registerset_size = sz;
+}
+
+auto viua::kernel::RegisterSet::reaches(viua::types::Value const* value)
+    -> bool {
+    for (auto& each : registers) {
+        if (each.get() and each.get()->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 
 unique_ptr<viua::kernel::RegisterSet> viua::kernel::RegisterSet::copy() {
     auto rscopy = make_unique<viua::kernel::RegisterSet>(size());
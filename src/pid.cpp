@@ -32,37 +32,38 @@
 using namespace std;
 
 
-viua::process::PID::PID(const viua::process::Process* p)
-        : associated_process(p) {}
+viua::process::PID::PID(index_type const i, generation_type const g)
+        : slot_index(i), slot_generation(g) {}
 bool viua::process::PID::operator==(const viua::process::PID& that) const {
-    return (associated_process == that.associated_process);
-}
-bool viua::process::PID::operator==(const viua::process::Process* that) const {
-    return (associated_process == that);
+    return (slot_index == that.slot_index
+            and slot_generation == that.slot_generation);
 }
 bool viua::process::PID::operator<(const viua::process::PID& that) const {
     // PIDs can't really have a less-than relation
     // they are either equal or not, and that's it
     // less-than relation is implemented only so that viua::process::PID objects
     // may be used as keys in std::map<>
-    return (reinterpret_cast<uint64_t>(associated_process)
-            < reinterpret_cast<uint64_t>(that.associated_process));
+    return (slot_index < that.slot_index
+            or (slot_index == that.slot_index
+                and slot_generation < that.slot_generation));
 }
 bool viua::process::PID::operator>(const viua::process::PID& that) const {
     // PIDs can't really have a greater-than relation
     // they are either equal or not, and that's it
     // greater-than relation is implemented only so that viua::process::PID
     // objects may be used as keys in std::map<>
-    return (reinterpret_cast<uint64_t>(associated_process)
-            > reinterpret_cast<uint64_t>(that.associated_process));
+    return (that < *this);
 }
 
-auto viua::process::PID::get() const -> decltype(associated_process) {
-    return associated_process;
+auto viua::process::PID::index() const -> index_type {
+    return slot_index;
+}
+auto viua::process::PID::generation() const -> generation_type {
+    return slot_generation;
 }
 
 auto viua::process::PID::str() const -> string {
     ostringstream oss;
-    oss << hex << associated_process;
+    oss << "0x" << hex << ((uint64_t{slot_generation} << 32) | slot_index);
     return oss.str();
 }
@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <new>
+#include <vector>
 #include <viua/bytecode/maps.h>
 #include <viua/bytecode/opcodes.h>
 #include <viua/kernel/kernel.h>
@@ -36,6 +38,56 @@ viua::internals::types::register_index const
     viua::process::Process::DEFAULT_REGISTER_SIZE;
 
 
+/*
+ * Blocks of memory big enough to hold a process.
+ * Every thread has its own pool so no synchronisation is needed; processes
+ * are spawned and destroyed by schedulers, each running in its own thread.
+ */
+class Process_pool {
+    std::vector<void*> blocks;
+
+  public:
+    static std::vector<void*>::size_type const limit = 1024;
+
+    auto take() -> void* {
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        auto const block = blocks.back();
+        blocks.pop_back();
+        return block;
+    }
+    auto give(void* const block) -> bool {
+        if (blocks.size() == limit) {
+            return false;
+        }
+        blocks.push_back(block);
+        return true;
+    }
+
+    Process_pool() {
+        blocks.reserve(limit);
+    }
+    ~Process_pool() {
+        for (auto const each : blocks) {
+            ::operator delete(each);
+        }
+    }
+};
+static thread_local Process_pool process_pool;
+
+void* viua::process::Process::operator new(std::size_t const size) {
+    auto const block = (size == sizeof(Process) ? process_pool.take() : nullptr);
+    return (block ? block : ::operator new(size));
+}
+void viua::process::Process::operator delete(void* const block,
+                                             std::size_t const size) {
+    if (size != sizeof(Process) or not process_pool.give(block)) {
+        ::operator delete(block);
+    }
+}
+
+
 viua::types::Value* viua::process::Process::fetch(
     viua::internals::types::register_index index) const {
     /*  Return pointer to object at given register.
@@ -66,11 +118,14 @@ viua::kernel::Register* viua::process::Process::register_at(
     } else if (rs == viua::internals::RegisterSets::LOCAL) {
         return stack->back()->local_register_set->register_at(i);
     } else if (rs == viua::internals::RegisterSets::STATIC) {
-        ensure_static_registers(stack->back()->function_name);
-        return static_registers.at(stack->back()->function_name)
-            ->register_at(i);
+        auto const frame = stack->back().get();
+        if (frame->static_register_set == nullptr) {
+            frame->static_register_set =
+                static_registers_of(frame->function_name);
+        }
+        return frame->static_register_set->register_at(i);
     } else if (rs == viua::internals::RegisterSets::GLOBAL) {
-        return global_register_set->register_at(i);
+        return global_registers()->register_at(i);
     } else {
         throw make_unique<viua::types::Exception>(
             "unsupported register set type");
@@ -96,18 +151,30 @@ void viua::process::Process::put(viua::internals::types::register_index index,
                                  unique_ptr<viua::types::Value> o) {
     place(index, std::move(o));
 }
-void viua::process::Process::ensure_static_registers(string function_name) {
-    /** Makes sure that static register set for requested function is
-     * initialized.
+auto viua::process::Process::global_registers()
+    -> viua::kernel::RegisterSet* {
+    if (not global_register_set) {
+        global_register_set =
+            make_unique<viua::kernel::RegisterSet>(DEFAULT_REGISTER_SIZE);
+    }
+    return global_register_set.get();
+}
+auto viua::process::Process::static_registers_of(string const& function_name)
+    -> viua::kernel::RegisterSet* {
+    /** Returns static register set of requested function, initialising it
+     *  if needed.
      */
-    try {
-        static_registers.at(function_name);
-    } catch (const std::out_of_range& e) {
+    auto const id = scheduler->kernel()->function_id_of(function_name);
+    if (id >= static_registers.size()) {
+        static_registers.resize(id + 1);
+    }
+    auto& registers = static_registers[id];
+    if (not registers) {
         // FIXME: amount of static registers should be customizable
         // FIXME: amount of static registers shouldn't be a magic number
-        static_registers[function_name] =
-            make_unique<viua::kernel::RegisterSet>(16);
+        registers = make_unique<viua::kernel::RegisterSet>(16);
     }
+    return registers.get();
 }
 
 Frame* viua::process::Process::request_new_frame(
@@ -143,6 +210,56 @@ viua::internals::types::byte* viua::process::Process::adjust_jump_base_for(
     const string& call_name) {
     return stack->adjust_jump_base_for(call_name);
 }
+auto viua::process::Process::compiled_code_of(string const& function_name)
+    -> viua::process::Baseline_function const* {
+    /*
+     * The baseline compiler is not used for profiled runs so that the
+     * profile describes the execution of the program by the interpreter.
+     */
+    auto const threshold =
+        scheduler->kernel()->baseline_compilation_threshold();
+    if (threshold == 0 or profile) {
+        return nullptr;
+    }
+
+    auto const id = scheduler->kernel()->function_id_of(function_name);
+    if (id >= baseline_calls.size()) {
+        baseline_calls.resize(id + 1);
+    }
+    auto& calls = baseline_calls[id];
+    if (calls.second) {
+        return calls.second;
+    }
+
+    /*
+     * Calls are counted by every process on its own, but compiled code is
+     * shared so a function that became hot in another process (e.g. the
+     * one that spawned this one) is used right away.
+     */
+    if (calls.first == 0) {
+        calls.second = scheduler->kernel()->compiled_baseline_of(function_name);
+    }
+    if ((not calls.second) and (++calls.first >= threshold)) {
+        calls.second = scheduler->kernel()->compile_baseline(function_name);
+    }
+    return calls.second;
+}
+auto viua::process::Process::count_backward_jump() -> void {
+    auto const frame = stack->back().get();
+    if (frame->compiled_code) {
+        return;
+    }
+
+    auto const threshold =
+        scheduler->kernel()->baseline_compilation_threshold();
+    if (threshold == 0 or profile) {
+        return;
+    }
+    if (++frame->backward_jumps >= threshold) {
+        frame->compiled_code =
+            scheduler->kernel()->compile_baseline(frame->function_name);
+    }
+}
 viua::internals::types::byte* viua::process::Process::call_native(
     viua::internals::types::byte* return_address,
     const string& call_name,
@@ -163,6 +280,11 @@ viua::internals::types::byte* viua::process::Process::call_native(
     stack->frame_new->return_register = return_register;
 
     push_frame();
+    stack->back()->compiled_code = compiled_code_of(call_name);
+
+    if (profile) {
+        profile->call(call_name);
+    }
 
     return call_address;
 }
@@ -260,6 +382,21 @@ auto viua::process::Process::push_deferred(string call_name) -> void {
     stack->back()->deferred_calls.push_back(std::move(stack->frame_new));
 }
 
+auto viua::process::Process::leave_coroutine(
+    unique_ptr<viua::types::Value> value) -> void {
+    auto const coroutine = stack;
+    if (value) {
+        *coroutine->resume_register = std::move(value);
+    } else {
+        coroutine->resume_register->give();
+    }
+
+    stack                       = coroutine->resumer;
+    coroutine->resumer          = nullptr;
+    coroutine->resume_register  = nullptr;
+    currently_used_register_set = stack->back()->local_register_set.get();
+}
+
 void viua::process::Process::handle_active_exception() {
     stack->unwind();
 }
@@ -278,11 +415,6 @@ viua::internals::types::byte* viua::process::Process::tick() {
         // When stack is in a RUNNING state it can be executed normally with
         // no special conditions.
         case Stack::STATE::RUNNING:
-        // When stack is in SUSPENDED_BY_DEFERRED_ON_FRAME_POP state a dispatch
-        // should be performed to run the opcode that put the process in this
-        // state the second time as such opcodes first suspend the stack, and
-        // then continue it when they are entered again.
-        case Stack::STATE::SUSPENDED_BY_DEFERRED_ON_FRAME_POP:
             saved_stack->instruction_pointer =
                 dispatch(stack->instruction_pointer);
             break;
@@ -329,8 +461,9 @@ viua::internals::types::byte* viua::process::Process::tick() {
      * recursive function),
      *      - the offending opcode is JOIN (as this means that a process is
      * waiting for another process to finish),
-     *      - the offending opcode is RECEIVE (as this means that a process is
-     * waiting for a message),
+     *      - the offending opcode is RECEIVE or RECEIVEMATCH (as this means
+     * that a process is waiting for a message),
+     *      - the offending opcode is SLEEP,
      *      - an object has been thrown, as the instruction pointer will be
      * adjusted by catchers or execution will be halted on unhandled types,
      */
@@ -338,7 +471,9 @@ viua::internals::types::byte* viua::process::Process::tick() {
         and stack->state_of() == viua::process::Stack::STATE::RUNNING
         and (OPCODE(*stack->instruction_pointer) != RETURN
              and OPCODE(*stack->instruction_pointer) != JOIN
-             and OPCODE(*stack->instruction_pointer) != RECEIVE)
+             and OPCODE(*stack->instruction_pointer) != RECEIVE
+             and OPCODE(*stack->instruction_pointer) != RECEIVEMATCH
+             and OPCODE(*stack->instruction_pointer) != SLEEP)
         and (not stack->thrown)) {
         stack->thrown =
             make_unique<viua::types::Exception>("InstructionUnchanged");
@@ -398,12 +533,37 @@ void viua::process::Process::suspend() {
     is_suspended.store(true, std::memory_order_release);
 }
 void viua::process::Process::wakeup() {
+    ready_since(std::chrono::steady_clock::now());
     is_suspended.store(false, std::memory_order_release);
 }
 bool viua::process::Process::suspended() const {
     return is_suspended.load(std::memory_order_acquire);
 }
 
+auto viua::process::Process::start_waiting(
+    viua::internals::types::timeout const timeout) -> void {
+    if (timeout_active) {
+        return;
+    }
+    timeout_active = true;
+    if (timeout) {
+        // timeouts are encoded as one more than the number of milliseconds
+        scheduler->schedule_timer(timeout_timer,
+                                  std::chrono::milliseconds(timeout - 1));
+    } else {
+        wait_until_infinity = true;
+    }
+}
+auto viua::process::Process::stop_waiting() -> void {
+    timeout_active      = false;
+    wait_until_infinity = false;
+    timeout_timer.cancel();
+}
+auto viua::process::Process::timed_out() const -> bool {
+    return (timeout_active and (not wait_until_infinity)
+            and timeout_timer.expired());
+}
+
 viua::process::Process* viua::process::Process::parent() const {
     return parent_process;
 }
@@ -419,6 +579,25 @@ void viua::process::Process::priority(decltype(process_priority) p) {
     process_priority = p;
 }
 
+auto viua::process::Process::priority_class() const -> Priority_class {
+    return process_priority_class;
+}
+auto viua::process::Process::priority_class(Priority_class const c) -> void {
+    process_priority_class = c;
+}
+
+auto viua::process::Process::ready_since() const
+    -> std::chrono::steady_clock::time_point {
+    return std::chrono::steady_clock::time_point{
+        std::chrono::steady_clock::duration{
+            waiting_in_run_queue_since.load(std::memory_order_acquire)}};
+}
+auto viua::process::Process::ready_since(
+    std::chrono::steady_clock::time_point const t) -> void {
+    waiting_in_run_queue_since.store(t.time_since_epoch().count(),
+                                     std::memory_order_release);
+}
+
 bool viua::process::Process::stopped() const {
     return (finished.load(std::memory_order_acquire) or terminated());
 }
@@ -428,7 +607,7 @@ bool viua::process::Process::terminated() const {
 }
 
 void viua::process::Process::pass(unique_ptr<viua::types::Value> message) {
-    message_queue.push(std::move(message));
+    message_queue.push_back(std::move(message));
     wakeup();
 }
 
@@ -474,6 +653,11 @@ viua::internals::types::byte* viua::process::Process::become(
     stack->frame_new            = std::move(frame_to_use);
 
     push_frame();
+    stack->back()->compiled_code = compiled_code_of(function_name);
+
+    if (profile) {
+        profile->call(function_name);
+    }
 
     return (stack->instruction_pointer = adjust_jump_base_for(function_name));
 }
@@ -483,6 +667,11 @@ viua::internals::types::byte* viua::process::Process::begin() {
         throw make_unique<viua::types::Exception>(
             "process from undefined function: " + stack->at(0)->function_name);
     }
+    stack->at(0)->compiled_code =
+        compiled_code_of(stack->at(0)->function_name);
+    if (profile) {
+        profile->call(stack->at(0)->function_name);
+    }
     return (stack->instruction_pointer =
                 adjust_jump_base_for(stack->at(0)->function_name));
 }
@@ -514,6 +703,28 @@ bool viua::process::Process::empty() const {
     return message_queue.empty();
 }
 
+auto viua::process::Process::owns(viua::types::Value const* value) const
+    -> bool {
+    /*
+     * Stacks of coroutines are not on the list of stacks of the process, but
+     * are reached through the coroutines that own them.
+     */
+    for (auto s = stacks.get(); s; s = s->next.get()) {
+        if (s->reaches(value)) {
+            return true;
+        }
+    }
+    if (global_register_set and global_register_set->reaches(value)) {
+        return true;
+    }
+    for (auto const& each : static_registers) {
+        if (each and each->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void viua::process::Process::migrate_to(
     viua::scheduler::VirtualProcessScheduler* sch) {
     scheduler = sch;
@@ -533,20 +744,68 @@ viua::process::Process::Process(unique_ptr<Frame> frm,
         , is_joinable(true)
         , is_suspended(false)
         , process_priority(512)
-        , process_id(this)
-        , is_hidden(false) {
-    global_register_set =
-        make_unique<viua::kernel::RegisterSet>(DEFAULT_REGISTER_SIZE);
+        , process_priority_class(Priority_class::NORMAL)
+        , waiting_in_run_queue_since(
+              std::chrono::steady_clock::now().time_since_epoch().count())
+        , process_id(scheduler->kernel()->create_process_slot())
+        , is_hidden(false)
+        , timeout_timer(this) {
+    if (scheduler->kernel()->is_profiling_enabled()) {
+        profile = make_unique<viua::kernel::Raw_profile>();
+    }
+
     currently_used_register_set = frm->local_register_set.get();
-    auto s                      = make_unique<Stack>(frm->function_name,
-                                this,
-                                &currently_used_register_set,
-                                global_register_set.get(),
-                                scheduler);
+    auto s                      = make_unique<Stack>(
+        frm->function_name, this, &currently_used_register_set, scheduler);
     s->emplace_back(std::move(frm));
-    s->bind(&currently_used_register_set, global_register_set.get());
-    stack           = s.get();
-    stacks[s.get()] = std::move(s);
+    s->bind(&currently_used_register_set);
+    stack = adopt(std::move(s));
+}
+
+auto viua::process::Process::adopt(unique_ptr<Stack> s) -> Stack* {
+    s->next = std::move(stacks);
+    stacks  = std::move(s);
+    return stacks.get();
 }
 
-viua::process::Process::~Process() {}
+auto viua::process::Process::collected_profile() const
+    -> viua::kernel::Raw_profile const* {
+    return profile.get();
+}
+
+viua::process::Process::~Process() {
+    /*
+     * Stacks are destroyed one by one as destroying the head of the list
+     * would otherwise destroy all of them recursively.
+     */
+    while (stacks) {
+        stacks = std::move(stacks->next);
+    }
+}
+
+
+namespace viua { namespace process {
+auto priority_class_of(string const& name) -> Priority_class {
+    if (name == "realtime") {
+        return Priority_class::REALTIME;
+    } else if (name == "normal") {
+        return Priority_class::NORMAL;
+    } else if (name == "batch") {
+        return Priority_class::BATCH;
+    }
+    throw make_unique<viua::types::Exception>("invalid priority class: "
+                                              + name);
+}
+auto to_string(Priority_class const c) -> string {
+    switch (c) {
+    case Priority_class::REALTIME:
+        return "realtime";
+    case Priority_class::NORMAL:
+        return "normal";
+    case Priority_class::BATCH:
+        return "batch";
+    default:
+        return "?";
+    }
+}
+}}  // namespace viua::process
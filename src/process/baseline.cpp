@@ -0,0 +1,351 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+#include <viua/bytecode/decoder/operands.h>
+#include <viua/bytecode/opcodes.h>
+#include <viua/bytecode/operand_types.h>
+#include <viua/cg/disassembler/disassembler.h>
+#include <viua/process.h>
+#include <viua/process/baseline.h>
+#include <viua/types/boolean.h>
+#include <viua/types/integer.h>
+using namespace std;
+
+using viua::process::Baseline_function;
+using viua::types::Boolean;
+using viua::types::Integer;
+using address_type = Baseline_function::address_type;
+using Instruction  = Baseline_function::Instruction;
+
+
+static auto register_of(viua::process::Process* process,
+                        Instruction const& instruction,
+                        unsigned const i) -> viua::kernel::Register* {
+    return process->register_at(instruction.operands[i],
+                                instruction.register_sets[i]);
+}
+
+/*
+ * Returns the integer held in the register given by i-th operand, or null if
+ * the register holds anything else (including references and pointers to
+ * integers).
+ */
+static auto integer_of(viua::process::Process* process,
+                       Instruction const& instruction,
+                       unsigned const i) -> Integer* {
+    auto const value = register_of(process, instruction, i)->get();
+    if (value == nullptr or typeid(*value) != typeid(Integer)) {
+        return nullptr;
+    }
+    return static_cast<Integer*>(value);
+}
+
+
+static auto izero(viua::process::Process* process,
+                  Instruction const& instruction) -> address_type {
+    *register_of(process, instruction, 0) = make_unique<Integer>(0);
+    return instruction.next;
+}
+static auto integer(viua::process::Process* process,
+                    Instruction const& instruction) -> address_type {
+    *register_of(process, instruction, 0) =
+        make_unique<Integer>(instruction.immediate);
+    return instruction.next;
+}
+static auto iinc(viua::process::Process* process,
+                 Instruction const& instruction) -> address_type {
+    auto const target = integer_of(process, instruction, 0);
+    if (target == nullptr) {
+        return nullptr;
+    }
+    target->increment();
+    return instruction.next;
+}
+static auto idec(viua::process::Process* process,
+                 Instruction const& instruction) -> address_type {
+    auto const target = integer_of(process, instruction, 0);
+    if (target == nullptr) {
+        return nullptr;
+    }
+    target->decrement();
+    return instruction.next;
+}
+
+template<typename Result, typename Operation>
+static auto integer_alu(viua::process::Process* process,
+                        Instruction const& instruction,
+                        Operation const operation) -> address_type {
+    auto const target = register_of(process, instruction, 0);
+    auto const lhs    = integer_of(process, instruction, 1);
+    auto const rhs    = integer_of(process, instruction, 2);
+    if (lhs == nullptr or rhs == nullptr) {
+        return nullptr;
+    }
+    *target =
+        make_unique<Result>(operation(lhs->as_integer(), rhs->as_integer()));
+    return instruction.next;
+}
+static auto add(viua::process::Process* process,
+                Instruction const& instruction) -> address_type {
+    return integer_alu<Integer>(
+        process, instruction, [](int64_t a, int64_t b) { return a + b; });
+}
+static auto sub(viua::process::Process* process,
+                Instruction const& instruction) -> address_type {
+    return integer_alu<Integer>(
+        process, instruction, [](int64_t a, int64_t b) { return a - b; });
+}
+static auto mul(viua::process::Process* process,
+                Instruction const& instruction) -> address_type {
+    return integer_alu<Integer>(
+        process, instruction, [](int64_t a, int64_t b) { return a * b; });
+}
+static auto lt(viua::process::Process* process,
+               Instruction const& instruction) -> address_type {
+    return integer_alu<Boolean>(
+        process, instruction, [](int64_t a, int64_t b) { return a < b; });
+}
+static auto lte(viua::process::Process* process,
+                Instruction const& instruction) -> address_type {
+    return integer_alu<Boolean>(
+        process, instruction, [](int64_t a, int64_t b) { return a <= b; });
+}
+static auto gt(viua::process::Process* process,
+               Instruction const& instruction) -> address_type {
+    return integer_alu<Boolean>(
+        process, instruction, [](int64_t a, int64_t b) { return a > b; });
+}
+static auto gte(viua::process::Process* process,
+                Instruction const& instruction) -> address_type {
+    return integer_alu<Boolean>(
+        process, instruction, [](int64_t a, int64_t b) { return a >= b; });
+}
+static auto eq(viua::process::Process* process,
+               Instruction const& instruction) -> address_type {
+    return integer_alu<Boolean>(
+        process, instruction, [](int64_t a, int64_t b) { return a == b; });
+}
+
+static auto move(viua::process::Process* process,
+                 Instruction const& instruction) -> address_type {
+    auto const target = register_of(process, instruction, 0);
+    auto const source = register_of(process, instruction, 1);
+    *target           = std::move(*source);
+    return instruction.next;
+}
+static auto jump(viua::process::Process*, Instruction const& instruction)
+    -> address_type {
+    return instruction.target;
+}
+static auto branch(viua::process::Process* process,
+                   Instruction const& instruction) -> address_type {
+    auto const value = register_of(process, instruction, 0)->get();
+    if (value == nullptr
+        or not(typeid(*value) == typeid(Boolean)
+               or typeid(*value) == typeid(Integer))) {
+        return nullptr;
+    }
+    return (value->boolean() ? instruction.target
+                             : instruction.alternative_target);
+}
+
+
+/*
+ * Decodes a plain register operand.
+ * Returns false for operands that must be decoded at runtime (register
+ * references and pointer dereferences).
+ */
+static auto decode_register(address_type& ip,
+                            Instruction& instruction,
+                            unsigned const i) -> bool {
+    if (viua::bytecode::decoder::operands::get_operand_type(ip)
+        != OT_REGISTER_INDEX) {
+        return false;
+    }
+    tie(ip, instruction.register_sets[i], instruction.operands[i]) =
+        viua::bytecode::decoder::operands::fetch_register_type_and_index(
+            ip, nullptr);
+    return true;
+}
+static auto decode_registers(address_type ip,
+                             Instruction& instruction,
+                             unsigned const n) -> bool {
+    for (auto i = 0u; i < n; ++i) {
+        if (not decode_register(ip, instruction, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static auto compile(address_type const ip,
+                    address_type const jump_base,
+                    Instruction& instruction) -> void {
+    auto operands = (ip + 1);
+    switch (*ip) {
+    case IZERO:
+        if (decode_registers(operands, instruction, 1)) {
+            instruction.handler = izero;
+        }
+        break;
+    case INTEGER:
+        if (decode_register(operands, instruction, 0)
+            and viua::bytecode::decoder::operands::get_operand_type(operands)
+                    == OT_INT) {
+            auto immediate = viua::internals::types::plain_int{0};
+            tie(operands, immediate) =
+                viua::bytecode::decoder::operands::fetch_primitive_int(
+                    operands, nullptr);
+            instruction.immediate = immediate;
+            instruction.handler   = integer;
+        }
+        break;
+    case IINC:
+        if (decode_registers(operands, instruction, 1)) {
+            instruction.handler = iinc;
+        }
+        break;
+    case IDEC:
+        if (decode_registers(operands, instruction, 1)) {
+            instruction.handler = idec;
+        }
+        break;
+    case ADD:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = add;
+        }
+        break;
+    case SUB:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = sub;
+        }
+        break;
+    case MUL:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = mul;
+        }
+        break;
+    case LT:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = lt;
+        }
+        break;
+    case LTE:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = lte;
+        }
+        break;
+    case GT:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = gt;
+        }
+        break;
+    case GTE:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = gte;
+        }
+        break;
+    case EQ:
+        if (decode_registers(operands, instruction, 3)) {
+            instruction.handler = eq;
+        }
+        break;
+    case MOVE:
+        if (decode_registers(operands, instruction, 2)) {
+            instruction.handler = move;
+        }
+        break;
+    case JUMP:
+        instruction.target =
+            (jump_base
+             + viua::bytecode::decoder::operands::extract_primitive_uint64(
+                   operands, nullptr));
+        /*
+         * The interpreter throws an exception for jumps to themselves so
+         * these are left to it.
+         */
+        if (instruction.target != operands) {
+            instruction.handler = jump;
+        }
+        break;
+    case IF:
+        if (decode_register(operands, instruction, 0)) {
+            auto target = uint64_t{0};
+            tie(operands, target) =
+                viua::bytecode::decoder::operands::fetch_primitive_uint64(
+                    operands, nullptr);
+            instruction.target = (jump_base + target);
+            tie(operands, target) =
+                viua::bytecode::decoder::operands::fetch_primitive_uint64(
+                    operands, nullptr);
+            instruction.alternative_target = (jump_base + target);
+            instruction.handler            = branch;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+
+namespace viua { namespace process {
+auto Baseline_function::compiled_instructions() const
+    -> vector<Instruction>::size_type {
+    return static_cast<vector<Instruction>::size_type>(
+        count_if(instructions.begin(),
+                 instructions.end(),
+                 [](Instruction const& each) { return each.handler; }));
+}
+
+Baseline_function::Baseline_function(address_type const entry_point,
+                                     address_type const end_of_code,
+                                     address_type const jump_base)
+        : entry(entry_point)
+        , end(end_of_code)
+        , instructions(static_cast<vector<Instruction>::size_type>(
+              end_of_code - entry_point)) {
+    for (auto ip = entry; ip < end;) {
+        auto size = viua::internals::types::bytecode_size{0};
+        try {
+            size = get<1>(disassembler::instruction(ip));
+        } catch (...) {
+            /*
+             * Stop at the first instruction that cannot be decoded.
+             * The rest of the function is left to the interpreter.
+             */
+            break;
+        }
+        if (size == 0 or (ip + size) > end) {
+            break;
+        }
+
+        auto& instruction = instructions[static_cast<vector<Instruction>::size_type>(
+            ip - entry)];
+        instruction.next = (ip + size);
+        compile(ip, jump_base, instruction);
+
+        ip += size;
+    }
+}
+}}  // namespace viua::process
@@ -64,6 +64,7 @@ auto viua::process::Process::get_trace_line(
 
     if (static_cast<OPCODE>(*for_address) == CALL
         or static_cast<OPCODE>(*for_address) == PROCESS
+        or static_cast<OPCODE>(*for_address) == COROUTINE
         or static_cast<OPCODE>(*for_address) == MSG) {
         auto working_address = for_address + 1;
         if (viua::bytecode::decoder::operands::is_void(working_address)) {
@@ -84,15 +85,9 @@ auto viua::process::Process::get_trace_line(
     }
     if (static_cast<OPCODE>(*for_address) == RETURN) {
         trace_line << " from " + stack->back()->function_name;
-        if (stack->state_of() == viua::process::Stack::STATE::RUNNING) {
-            trace_line << (stack->back()->deferred_calls.size()
-                               ? " before deferred"
-                               : " with no deferred");
-        } else if (stack->state_of()
-                   == viua::process::Stack::STATE::
-                          SUSPENDED_BY_DEFERRED_ON_FRAME_POP) {
-            trace_line << " after deferred";
-        }
+        trace_line << (stack->back()->deferred_calls.size()
+                           ? " before deferred"
+                           : " with no deferred");
     }
 
     return trace_line.str();
@@ -117,6 +112,13 @@ viua::internals::types::byte* viua::process::Process::dispatch(
     if (tracing_enabled) {
         emit_trace_line(addr);
     }
+    if (stack->size()) {
+        if (auto const compiled = stack->back()->compiled_code) {
+            if (auto const next = compiled->execute(this, addr)) {
+                return next;
+            }
+        }
+    }
     switch (static_cast<OPCODE>(*addr)) {
     case IZERO:
         addr = opizero(addr + 1);
@@ -202,6 +204,9 @@ viua::internals::types::byte* viua::process::Process::dispatch(
     case VECTOR:
         addr = opvector(addr + 1);
         break;
+    case VECTOROF:
+        addr = opvectorof(addr + 1);
+        break;
     case VINSERT:
         addr = opvinsert(addr + 1);
         break;
@@ -397,9 +402,36 @@ viua::internals::types::byte* viua::process::Process::dispatch(
     case RECEIVE:
         addr = opreceive(addr + 1);
         break;
+    case SENDALL:
+        addr = opsendall(addr + 1);
+        break;
+    case BROADCAST:
+        addr = opbroadcast(addr + 1);
+        break;
+    case RECEIVEMANY:
+        addr = opreceivemany(addr + 1);
+        break;
+    case RECEIVEMATCH:
+        addr = opreceivematch(addr + 1);
+        break;
+    case SLEEP:
+        addr = opsleep(addr + 1);
+        break;
+    case PRIORITY:
+        addr = oppriority(addr + 1);
+        break;
     case WATCHDOG:
         addr = opwatchdog(addr + 1);
         break;
+    case COROUTINE:
+        addr = opcoroutine(addr + 1);
+        break;
+    case RESUME:
+        addr = opresume(addr + 1);
+        break;
+    case YIELD:
+        addr = opyield(addr + 1);
+        break;
     case RETURN:
         addr = opreturn(addr);
         break;
@@ -460,6 +492,27 @@ viua::internals::types::byte* viua::process::Process::dispatch(
     case STRUCTKEYS:
         addr = opstructkeys(addr + 1);
         break;
+    case HASHMAP:
+        addr = ophashmap(addr + 1);
+        break;
+    case HASHMAPINSERT:
+        addr = ophashmapinsert(addr + 1);
+        break;
+    case HASHMAPREMOVE:
+        addr = ophashmapremove(addr + 1);
+        break;
+    case HASHMAPLOOKUP:
+        addr = ophashmaplookup(addr + 1);
+        break;
+    case HASHMAPCONTAINS:
+        addr = ophashmapcontains(addr + 1);
+        break;
+    case HASHMAPKEYS:
+        addr = ophashmapkeys(addr + 1);
+        break;
+    case HASHMAPSIZE:
+        addr = ophashmapsize(addr + 1);
+        break;
     case NEW:
         addr = opnew(addr + 1);
         break;
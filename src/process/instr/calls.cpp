@@ -213,29 +213,16 @@ viua::internals::types::byte* viua::process::Process::opcall(
 
 viua::internals::types::byte* viua::process::Process::optailcall(
     viua::internals::types::byte* addr) {
-    if (stack->state_of() == viua::process::Stack::STATE::RUNNING) {
-        stack->register_deferred_calls();
-        stack->state_of(
-            viua::process::Stack::STATE::SUSPENDED_BY_DEFERRED_ON_FRAME_POP);
-
-        if (not stacks_order.empty()) {
-            stack = stacks_order.top();
-            stacks_order.pop();
-            currently_used_register_set =
-                stack->back()->local_register_set.get();
-            return (addr - 1);
-        }
-    }
-
-    if (stack->state_of()
-        != viua::process::Stack::STATE::SUSPENDED_BY_DEFERRED_ON_FRAME_POP) {
-        throw make_unique<viua::types::Exception>(
-            "stack left in an invalid state");
+    /*
+     * Deferred calls return to this instruction so it is executed once for
+     * every deferred call of the frame, and once more to make the tail call.
+     */
+    if (auto const deferred = stack->run_next_deferred_call(addr - 1)) {
+        return deferred;
     }
 
-    stack->state_of(viua::process::Stack::STATE::RUNNING);
-
     string call_name;
+    viua::types::Closure* closure = nullptr;
     auto ot = viua::bytecode::decoder::operands::get_operand_type(addr);
     if (ot == OT_REGISTER_INDEX or ot == OT_POINTER) {
         viua::types::Function* fn = nullptr;
@@ -245,10 +232,7 @@ viua::internals::types::byte* viua::process::Process::optailcall(
         call_name = fn->name();
 
         if (fn->type() == "Closure") {
-            stack->back()->local_register_set.reset(
-                static_cast<viua::types::Closure*>(fn)->give());
-            currently_used_register_set =
-                stack->back()->local_register_set.get();
+            closure = static_cast<viua::types::Closure*>(fn);
         }
     } else {
         tie(addr, call_name) =
@@ -268,14 +252,43 @@ viua::internals::types::byte* viua::process::Process::optailcall(
         throw make_unique<viua::types::Exception>(
             "tail call to non-native function: " + call_name);
     }
+    if (not stack->frame_new) {
+        throw make_unique<viua::types::Exception>(
+            "tail call without a frame: use `frame 0' in source code if the "
+            "function takes no parameters");
+    }
 
-    // FIXME tailcalled functions should not inherit local register set of the
-    // frame they replace
-    stack->back()->arguments = std::move(stack->frame_new->arguments);
+    /*
+     * The tail called function replaces the function running in the frame
+     * on top of the stack, and gets the arguments and a clean local
+     * register set of the size requested for the new frame.
+     * Storage of both register sets is reused (unless the local register set
+     * belongs to a closure).
+     */
+    auto& frame = *stack->back();
+    if (closure) {
+        frame.local_register_set.reset(closure->give());
+    } else if (frame.local_register_set.owns()) {
+        frame.local_register_set->reset(
+            stack->frame_new->local_register_set->size());
+    } else {
+        frame.local_register_set.reset(make_unique<viua::kernel::RegisterSet>(
+            stack->frame_new->local_register_set->size()));
+    }
+    currently_used_register_set = frame.local_register_set.get();
+    swap(frame.arguments, stack->frame_new->arguments);
+
+    frame.function_name       = call_name;
+    frame.static_register_set = nullptr;
+    frame.backward_jumps      = 0;
+    frame.compiled_code       = compiled_code_of(call_name);
+    if (profile) {
+        profile->call(call_name);
+    }
 
-    // new frame must be deleted to prevent future errors
+    // the new frame is not pushed onto the stack, but kept for reuse
     // it's a simulated "push-and-pop" from the stack
-    stack->frame_new.reset(nullptr);
+    stack->recycle(std::move(stack->frame_new));
 
     return adjust_jump_base_for(call_name);
 }
@@ -323,25 +336,14 @@ viua::internals::types::byte* viua::process::Process::opreturn(
             "no frame on stack: no call to return from");
     }
 
-    if (stack->state_of() == viua::process::Stack::STATE::RUNNING) {
-        stack->set_return_value();
-        stack->register_deferred_calls();
-        stack->state_of(
-            viua::process::Stack::STATE::SUSPENDED_BY_DEFERRED_ON_FRAME_POP);
-
-        if (not stacks_order.empty()) {
-            stack = stacks_order.top();
-            stacks_order.pop();
-            currently_used_register_set =
-                stack->back()->local_register_set.get();
-            return addr;
-        }
-    }
-
-    if (stack->state_of()
-        != viua::process::Stack::STATE::SUSPENDED_BY_DEFERRED_ON_FRAME_POP) {
-        throw make_unique<viua::types::Exception>(
-            "stack left in an invalid state");
+    /*
+     * Deferred calls return to this instruction so it is executed once for
+     * every deferred call of the frame, and once more to actually return.
+     * The returned value is set aside before the first of them runs.
+     */
+    stack->set_return_value();
+    if (auto const deferred = stack->run_next_deferred_call(addr)) {
+        return deferred;
     }
 
     addr = stack->back()->ret_address();
@@ -349,12 +351,14 @@ viua::internals::types::byte* viua::process::Process::opreturn(
     unique_ptr<viua::types::Value> returned;
     viua::kernel::Register* return_register = stack->back()->return_register;
     if (return_register != nullptr) {
-        returned = std::move(stack->return_value);
+        returned = std::move(stack->back()->return_value);
     }
 
-    stack->state_of(viua::process::Stack::STATE::RUNNING);
-
-    stack->pop();
+    auto frame = stack->pop();
+    if (frame->postponed_frame_new) {
+        stack->frame_new = std::move(frame->postponed_frame_new);
+    }
+    stack->recycle(std::move(frame));
 
     // place return value
     if (returned and stack->size() > 0) {
@@ -363,6 +367,20 @@ viua::internals::types::byte* viua::process::Process::opreturn(
 
     if (stack->size() > 0) {
         adjust_jump_base_for(stack->back()->function_name);
+    } else if (stack->resumer) {
+        /*
+         * A coroutine returned, so the returned value is passed to the
+         * resumer just like a yielded one.
+         */
+        leave_coroutine(std::move(stack->return_value));
+    } else if (not stacks_order.empty()) {
+        /*
+         * A stack running a deferred call during stack unwinding is
+         * exhausted so the next suspended stack resumes.
+         */
+        stack = stacks_order.top();
+        stacks_order.pop();
+        currently_used_register_set = stack->back()->local_register_set.get();
     }
 
     return addr;
@@ -23,14 +23,96 @@
 #include <viua/exceptions.h>
 #include <viua/kernel/kernel.h>
 #include <viua/scheduler/vps.h>
+#include <viua/types/atom.h>
 #include <viua/types/boolean.h>
 #include <viua/types/closure.h>
 #include <viua/types/function.h>
+#include <viua/types/integer.h>
 #include <viua/types/process.h>
 #include <viua/types/reference.h>
+#include <viua/types/struct.h>
+#include <viua/types/vector.h>
 using namespace std;
 
 
+/*
+ * Turns a value into a message.
+ *
+ * Messages are moved between processes without copying so sending a large
+ * value costs as much as sending a small one, but once a value is sent its
+ * sender must not be able to reach it:
+ *
+ *  - pointers to the value (and to the values it contains) expire; this is
+ *    detected lazily, when such a pointer is dereferenced (see
+ *    viua::types::Value_owner), so the sender must bump its ownership
+ *    generation after sending
+ *  - references are replaced with the values they refer to; the value is
+ *    moved if the sender held the last reference to it, and copied if it is
+ *    still shared with (for example) a closure
+ *  - closures are isolated (see viua::types::Closure::isolate()) as their
+ *    register sets may be shared with closures that stay with the sender
+ */
+static auto as_message(unique_ptr<viua::types::Value> value)
+    -> unique_ptr<viua::types::Value> {
+    if (auto reference = dynamic_cast<viua::types::Reference*>(value.get())) {
+        value = reference->take();
+    }
+    if (auto closure = dynamic_cast<viua::types::Closure*>(value.get())) {
+        closure->isolate();
+    }
+    return value;
+}
+
+static auto message_from(viua::kernel::Register* source)
+    -> unique_ptr<viua::types::Value> {
+    if (source->empty()) {
+        throw make_unique<viua::types::Exception>("send from empty register");
+    }
+    return as_message(source->give());
+}
+
+/*
+ * Checks if a message matches a filter of selective receive.
+ *
+ *  - an atom matches an equal atom, and any message whose type has the same
+ *    name as the atom (e.g. 'Integer' matches all integers)
+ *  - a struct matches structs having all of its keys, with values matching
+ *    the values in the filter
+ *  - any other value matches messages of the same type and representation
+ */
+static auto matches(viua::types::Value const& filter,
+                    viua::types::Value const& message) -> bool {
+    if (auto const tag = dynamic_cast<viua::types::Atom const*>(&filter)) {
+        if (message.type() == static_cast<string>(*tag)) {
+            return true;
+        }
+        auto const atom = dynamic_cast<viua::types::Atom const*>(&message);
+        return (atom != nullptr and *atom == *tag);
+    }
+    if (auto const pattern = dynamic_cast<viua::types::Struct const*>(&filter)) {
+        auto const fields = dynamic_cast<viua::types::Struct const*>(&message);
+        if (fields == nullptr) {
+            return false;
+        }
+        for (auto const& key : pattern->keys()) {
+            /*
+             * Struct::at() returns null for keys the struct does not have,
+             * and a message missing any key of the filter does not match.
+             */
+            auto const field = fields->at(key);
+            if (field == nullptr) {
+                return false;
+            }
+            if (not matches(*pattern->at(key), *field)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return (filter.type() == message.type() and filter.repr() == message.repr());
+}
+
+
 viua::internals::types::byte* viua::process::Process::opprocess(
     viua::internals::types::byte* addr) {
     viua::kernel::Register* target = nullptr;
@@ -71,10 +153,24 @@ viua::internals::types::byte* viua::process::Process::opprocess(
 
     stack->frame_new->function_name = call_name;
 
+    /*
+     * Parameters are copied into the frame so closures passed to the new
+     * process may still share their register sets with closures of this one.
+     */
+    auto const& parameters = stack->frame_new->arguments;
+    for (auto i = decltype(parameters->size()){0}; i < parameters->size();
+         ++i) {
+        if (auto closure =
+                dynamic_cast<viua::types::Closure*>(parameters->at(i))) {
+            closure->isolate();
+        }
+    }
+
     auto spawned_process =
         scheduler->spawn(std::move(stack->frame_new), this, target_is_void);
+    ++ownership_generation;
     if (not target_is_void) {
-        *target = make_unique<viua::types::Process>(spawned_process);
+        *target = make_unique<viua::types::Process>(spawned_process->pid());
     }
 
     return addr;
@@ -110,16 +206,10 @@ viua::internals::types::byte* viua::process::Process::opjoin(
         throw make_unique<viua::types::Exception>("process cannot be joined");
     }
 
-    if (timeout and not timeout_active) {
-        waiting_until  = (std::chrono::steady_clock::now()
-                         + std::chrono::milliseconds(timeout - 1));
-        timeout_active = true;
-    } else if (not timeout and not timeout_active) {
-        wait_until_infinity = true;
-        timeout_active      = true;
-    }
+    start_waiting(timeout);
 
     if (scheduler->is_stopped(thrd->pid())) {
+        stop_waiting();
         return_addr = addr;
         if (scheduler->is_terminated(thrd->pid())) {
             stack->thrown = scheduler->transfer_exception_of(thrd->pid());
@@ -129,10 +219,8 @@ viua::internals::types::byte* viua::process::Process::opjoin(
                 *target = std::move(result);
             }
         }
-    } else if (timeout_active and (not wait_until_infinity)
-               and (waiting_until < std::chrono::steady_clock::now())) {
-        timeout_active      = false;
-        wait_until_infinity = false;
+    } else if (timed_out()) {
+        stop_waiting();
         stack->thrown =
             make_unique<viua::types::Exception>("process did not join");
         return_addr = addr;
@@ -151,7 +239,8 @@ viua::internals::types::byte* viua::process::Process::opsend(
         viua::bytecode::decoder::operands::fetch_register(addr, this);
 
     if (auto thrd = dynamic_cast<viua::types::Process*>(target->get())) {
-        scheduler->send(thrd->pid(), source->give());
+        scheduler->send(thrd->pid(), message_from(source));
+        ++ownership_generation;
     } else {
         throw make_unique<viua::types::Exception>(
             "invalid type: expected viua::process::Process");
@@ -182,35 +271,31 @@ viua::internals::types::byte* viua::process::Process::opreceive(
     tie(addr, timeout) =
         viua::bytecode::decoder::operands::fetch_timeout(addr, this);
 
-    if (timeout and not timeout_active) {
-        waiting_until  = (std::chrono::steady_clock::now()
-                         + std::chrono::milliseconds(timeout - 1));
-        timeout_active = true;
-    } else if (not timeout and not timeout_active) {
-        wait_until_infinity = true;
-        timeout_active      = true;
-    }
+    start_waiting(timeout);
 
     if (not is_hidden) {
-        scheduler->receive(process_id, message_queue);
+        /*
+         * A waiting process is suspended until a message arrives, or its
+         * timeout expires, instead of checking its mailbox on every tick.
+         */
+        auto const waiter =
+            ((message_queue.empty() and not timed_out()) ? this : nullptr);
+        scheduler->receive(process_id, message_queue, waiter);
     }
 
     if (not message_queue.empty()) {
         if (not target_is_void) {
             *target = std::move(message_queue.front());
         }
-        message_queue.pop();
-        timeout_active      = false;
-        wait_until_infinity = false;
-        return_addr         = addr;
+        message_queue.pop_front();
+        stop_waiting();
+        return_addr = addr;
     } else {
         if (is_hidden) {
             suspend();
         }
-        if (timeout_active and (not wait_until_infinity)
-            and (waiting_until < std::chrono::steady_clock::now())) {
-            timeout_active      = false;
-            wait_until_infinity = false;
+        if (timed_out()) {
+            stop_waiting();
             stack->thrown =
                 make_unique<viua::types::Exception>("no message received");
             return_addr = addr;
@@ -219,6 +304,237 @@ viua::internals::types::byte* viua::process::Process::opreceive(
 
     return return_addr;
 }
+viua::internals::types::byte* viua::process::Process::opsendall(
+    viua::internals::types::byte* addr) {
+    /** Send a batch of messages to a process.
+     */
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::kernel::Register* source = nullptr;
+    tie(addr, source) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    auto thrd = dynamic_cast<viua::types::Process*>(target->get());
+    if (not thrd) {
+        throw make_unique<viua::types::Exception>(
+            "invalid type: expected viua::process::Process");
+    }
+    if (source->empty()) {
+        throw make_unique<viua::types::Exception>("send from empty register");
+    }
+    if (not dynamic_cast<viua::types::Vector*>(source->get())) {
+        throw make_unique<viua::types::Exception>(
+            "invalid type: expected viua::types::Vector");
+    }
+
+    auto batch     = source->give();
+    auto& messages = static_cast<viua::types::Vector*>(batch.get())->value();
+    for (auto& each : messages) {
+        each = as_message(std::move(each));
+    }
+    scheduler->send(thrd->pid(), std::move(messages));
+    ++ownership_generation;
+
+    return addr;
+}
+viua::internals::types::byte* viua::process::Process::opbroadcast(
+    viua::internals::types::byte* addr) {
+    /** Send a message to a group of processes.
+     */
+    viua::types::Vector* targets = nullptr;
+    tie(addr, targets) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Vector>(addr, this);
+
+    viua::kernel::Register* source = nullptr;
+    tie(addr, source) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    /*
+     * Broadcasting to nobody is most probably a bug in the program (e.g. a
+     * group of workers that was never populated) so instead of silently
+     * dropping the message an exception is thrown, and the message is left
+     * in its register.
+     */
+    if (targets->value().empty()) {
+        throw make_unique<viua::types::Exception>(
+            "broadcast to an empty group of processes");
+    }
+
+    /*
+     * All receivers are checked before anything is sent so that the message
+     * is either sent to all of them, or to none.
+     */
+    auto pids = vector<viua::process::PID>{};
+    pids.reserve(targets->value().size());
+    for (auto const& each : targets->value()) {
+        auto thrd = dynamic_cast<viua::types::Process*>(each.get());
+        if (not thrd) {
+            throw make_unique<viua::types::Exception>(
+                "invalid type: expected viua::process::Process");
+        }
+        pids.push_back(thrd->pid());
+    }
+
+    scheduler->broadcast(pids, message_from(source));
+    ++ownership_generation;
+
+    return addr;
+}
+viua::internals::types::byte* viua::process::Process::opreceivemany(
+    viua::internals::types::byte* addr) {
+    /** Receive messages that are already pending.
+     *
+     *  This opcode never blocks.
+     */
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::types::Integer* count = nullptr;
+    tie(addr, count) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Integer>(addr, this);
+
+    if (count->as_integer() < 0) {
+        throw make_unique<viua::types::Exception>(
+            "negative number of messages to receive");
+    }
+
+    if (not is_hidden) {
+        scheduler->receive(process_id, message_queue);
+    }
+
+    auto messages    = make_unique<viua::types::Vector>();
+    auto const limit = count->as_integer();
+    for (auto i = int64_t{0}; i < limit and not message_queue.empty(); ++i) {
+        messages->push(std::move(message_queue.front()));
+        message_queue.pop_front();
+    }
+    *target = std::move(messages);
+
+    return addr;
+}
+viua::internals::types::byte* viua::process::Process::opreceivematch(
+    viua::internals::types::byte* addr) {
+    /** Receive the first message matching a filter.
+     *
+     *  Messages that do not match are left in the queue, in the order in
+     *  which they arrived, so they can be received later.
+     *  This opcode blocks execution of current process until a matching
+     *  message arrives.
+     */
+    viua::internals::types::byte* return_addr = (addr - 1);
+
+    viua::kernel::Register* target = nullptr;
+    bool target_is_void = viua::bytecode::decoder::operands::is_void(addr);
+
+    if (not target_is_void) {
+        tie(addr, target) =
+            viua::bytecode::decoder::operands::fetch_register(addr, this);
+    } else {
+        addr = viua::bytecode::decoder::operands::fetch_void(addr);
+    }
+
+    viua::types::Value* filter = nullptr;
+    tie(addr, filter) =
+        viua::bytecode::decoder::operands::fetch_object(addr, this);
+
+    viua::internals::types::timeout timeout = 0;
+    tie(addr, timeout) =
+        viua::bytecode::decoder::operands::fetch_timeout(addr, this);
+
+    start_waiting(timeout);
+
+    if (not is_hidden) {
+        scheduler->receive(process_id, message_queue);
+    }
+
+    /*
+     * Messages checked during previous ticks did not match the filter so
+     * only the ones that arrived since then are checked.
+     */
+    for (; messages_scanned < message_queue.size(); ++messages_scanned) {
+        auto message = (message_queue.begin()
+                        + static_cast<decltype(message_queue)::difference_type>(
+                              messages_scanned));
+        if (not matches(*filter, **message)) {
+            continue;
+        }
+
+        if (not target_is_void) {
+            *target = std::move(*message);
+        }
+        message_queue.erase(message);
+        messages_scanned = 0;
+        stop_waiting();
+        return addr;
+    }
+
+    if (is_hidden) {
+        suspend();
+    } else if (not timed_out()) {
+        /*
+         * Only a new message may match so the process sleeps until one
+         * arrives, or its timeout expires.
+         * Messages that arrived since the mailbox was emptied above are
+         * taken instead and checked during the next tick.
+         */
+        scheduler->receive(process_id, message_queue, this);
+    }
+    if (timed_out()) {
+        stop_waiting();
+        messages_scanned = 0;
+        stack->thrown =
+            make_unique<viua::types::Exception>("no message received");
+        return_addr = addr;
+    }
+
+    return return_addr;
+}
+viua::internals::types::byte* viua::process::Process::opsleep(
+    viua::internals::types::byte* addr) {
+    /** Suspend the process for given number of milliseconds.
+     *
+     *  The process is woken up by the timer wheel of its scheduler so no
+     *  thread is blocked while it sleeps.
+     */
+    viua::internals::types::byte* return_addr = (addr - 1);
+
+    viua::types::Integer* duration = nullptr;
+    tie(addr, duration) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Integer>(addr, this);
+
+    if (not timeout_active) {
+        if (duration->as_integer() < 0) {
+            throw make_unique<viua::types::Exception>(
+                "negative duration of sleep");
+        }
+        timeout_active = true;
+        scheduler->schedule_timer(
+            timeout_timer, std::chrono::milliseconds(duration->as_integer()));
+    }
+
+    if (timeout_timer.expired()) {
+        stop_waiting();
+        return_addr = addr;
+    } else {
+        suspend();
+    }
+
+    return return_addr;
+}
+viua::internals::types::byte* viua::process::Process::oppriority(
+    viua::internals::types::byte* addr) {
+    viua::types::Atom* priority_class = nullptr;
+    tie(addr, priority_class) =
+        viua::bytecode::decoder::operands::fetch_object_of<viua::types::Atom>(
+            addr, this);
+
+    process_priority_class = priority_class_of(string(*priority_class));
+
+    return addr;
+}
 viua::internals::types::byte* viua::process::Process::opwatchdog(
     viua::internals::types::byte* addr) {
     string call_name;
@@ -254,7 +570,7 @@ viua::internals::types::byte* viua::process::Process::opself(
     tie(addr, target) =
         viua::bytecode::decoder::operands::fetch_register(addr, this);
 
-    *target = make_unique<viua::types::Process>(this);
+    *target = make_unique<viua::types::Process>(pid());
 
     return addr;
 }
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <string>
+#include <viua/bytecode/decoder/operands.h>
+#include <viua/kernel/kernel.h>
+#include <viua/scheduler/vps.h>
+#include <viua/types/coroutine.h>
+#include <viua/types/exception.h>
+using namespace std;
+
+
+viua::internals::types::byte* viua::process::Process::opcoroutine(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    string call_name;
+    tie(addr, call_name) =
+        viua::bytecode::decoder::operands::fetch_atom(addr, this);
+
+    if (not scheduler->is_native_function(call_name)) {
+        if (scheduler->is_foreign_function(call_name)) {
+            throw make_unique<viua::types::Exception>(
+                "coroutine must be a native function, used foreign "
+                + call_name);
+        }
+        throw make_unique<viua::types::Exception>(
+            "coroutine from undefined function: " + call_name);
+    }
+    if (not stack->frame_new) {
+        throw make_unique<viua::types::Exception>(
+            "coroutine without a frame: use `frame 0' in source code if the "
+            "function takes no parameters");
+    }
+
+    stack->frame_new->function_name   = call_name;
+    stack->frame_new->return_address  = nullptr;
+    stack->frame_new->return_register = nullptr;
+
+    /*
+     * The coroutine does not run until it is resumed so the frame is only
+     * put on the stack here, and the stack is not made current.
+     */
+    auto s = make_unique<Stack>(
+        call_name, this, &currently_used_register_set, scheduler);
+    s->emplace_back(std::move(stack->frame_new));
+    s->instruction_pointer   = s->adjust_jump_base_for(call_name);
+    s->back()->compiled_code = compiled_code_of(call_name);
+    if (profile) {
+        profile->call(call_name);
+    }
+
+    *target = make_unique<viua::types::Coroutine>(std::move(s));
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::opresume(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::types::Coroutine* coroutine = nullptr;
+    tie(addr, coroutine) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Coroutine>(addr, this);
+
+    auto const coroutine_stack = coroutine->stack();
+    if (coroutine_stack->parent_process != this) {
+        throw make_unique<viua::types::Exception>(
+            "coroutine can only be resumed by the process that created it");
+    }
+    if (coroutine->finished()) {
+        throw make_unique<viua::types::Exception>(
+            "resume of a finished coroutine: " + coroutine->str());
+    }
+    if (coroutine_stack->resumer) {
+        throw make_unique<viua::types::Exception>(
+            "resume of a running coroutine: " + coroutine->str());
+    }
+    if (target->get() == coroutine) {
+        /*
+         * The value passed back would destroy the coroutine (and the stack
+         * it runs on) before the coroutine is suspended.
+         */
+        throw make_unique<viua::types::Exception>(
+            "resume into the register holding the coroutine");
+    }
+
+    coroutine_stack->resumer         = stack;
+    coroutine_stack->resume_register = target;
+
+    /*
+     * The address of the next instruction is saved on the current stack by
+     * the dispatcher, and the coroutine continues from where it stopped.
+     */
+    stack                       = coroutine_stack;
+    currently_used_register_set = stack->back()->local_register_set.get();
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::opyield(
+    viua::internals::types::byte* addr) {
+    viua::types::Value* value = nullptr;
+    tie(addr, value) =
+        viua::bytecode::decoder::operands::fetch_object(addr, this);
+
+    if (not stack->resumer) {
+        throw make_unique<viua::types::Exception>(
+            "yield outside of a coroutine");
+    }
+
+    leave_coroutine(value->copy());
+
+    return addr;
+}
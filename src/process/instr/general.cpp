@@ -56,11 +56,23 @@ viua::internals::types::byte* viua::process::Process::opjump(
         throw make_unique<viua::types::Exception>(
             "aborting: JUMP instruction pointing to itself");
     }
+    if (target < addr) {
+        count_backward_jump();
+    }
+    if (profile) {
+        // the address points just past the opcode
+        profile->jump(addr - 1);
+        if (target < addr) {
+            profile->loop(target);
+        }
+    }
     return target;
 }
 
 viua::internals::types::byte* viua::process::Process::opif(
     viua::internals::types::byte* addr) {
+    auto const instruction_address = (addr - 1);
+
     viua::types::Value* source = nullptr;
     tie(addr, source) =
         viua::bytecode::decoder::operands::fetch_object(addr, this);
@@ -71,5 +83,17 @@ viua::internals::types::byte* viua::process::Process::opif(
     tie(addr, addr_false) =
         viua::bytecode::decoder::operands::fetch_primitive_uint64(addr, this);
 
-    return (stack->jump_base + (source->boolean() ? addr_true : addr_false));
+    auto const taken = source->boolean();
+    auto const target =
+        (stack->jump_base + (taken ? addr_true : addr_false));
+    if (target <= instruction_address) {
+        count_backward_jump();
+    }
+    if (profile) {
+        profile->branch(instruction_address, taken);
+        if (target <= instruction_address) {
+            profile->loop(target);
+        }
+    }
+    return target;
 }
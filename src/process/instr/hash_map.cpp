@@ -0,0 +1,178 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <utility>
+#include <viua/bytecode/decoder/operands.h>
+#include <viua/process.h>
+#include <viua/types/boolean.h>
+#include <viua/types/exception.h>
+#include <viua/types/hash_map.h>
+#include <viua/types/integer.h>
+#include <viua/types/pointer.h>
+#include <viua/types/vector.h>
+using namespace std;
+
+
+viua::internals::types::byte* viua::process::Process::ophashmap(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    *target = make_unique<viua::types::Hash_map>();
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::ophashmapinsert(
+    viua::internals::types::byte* addr) {
+    viua::types::Hash_map* map_operand = nullptr;
+    tie(addr, map_operand) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Hash_map>(addr, this);
+
+    viua::types::Value* key = nullptr;
+    tie(addr, key) = viua::bytecode::decoder::operands::fetch_object(addr, this);
+
+    if (viua::bytecode::decoder::operands::get_operand_type(addr)
+        == OT_POINTER) {
+        viua::types::Value* source = nullptr;
+        tie(addr, source) =
+            viua::bytecode::decoder::operands::fetch_object(addr, this);
+        map_operand->insert(key->copy(), source->copy());
+    } else {
+        viua::kernel::Register* source = nullptr;
+        tie(addr, source) =
+            viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+        /*
+         * Hash the key before the value is taken out of its register so
+         * that an unhashable key leaves the value where it was.
+         */
+        viua::types::Hash_map::hash_of(*key);
+        map_operand->insert(key->copy(), source->give());
+    }
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::ophashmapremove(
+    viua::internals::types::byte* addr) {
+    bool void_target = viua::bytecode::decoder::operands::is_void(addr);
+    viua::kernel::Register* target = nullptr;
+
+    if (not void_target) {
+        tie(addr, target) =
+            viua::bytecode::decoder::operands::fetch_register(addr, this);
+    } else {
+        addr = viua::bytecode::decoder::operands::fetch_void(addr);
+    }
+
+    viua::types::Hash_map* map_operand = nullptr;
+    tie(addr, map_operand) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Hash_map>(addr, this);
+
+    viua::types::Value* key = nullptr;
+    tie(addr, key) = viua::bytecode::decoder::operands::fetch_object(addr, this);
+
+    auto result = map_operand->remove(*key);
+    if (not void_target) {
+        *target = std::move(result);
+    }
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::ophashmaplookup(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::types::Hash_map* map_operand = nullptr;
+    tie(addr, map_operand) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Hash_map>(addr, this);
+
+    viua::types::Value* key = nullptr;
+    tie(addr, key) = viua::bytecode::decoder::operands::fetch_object(addr, this);
+
+    auto const value = map_operand->at(*key);
+    if (not value) {
+        throw make_unique<viua::types::Exception>("key not found: "
+                                                  + key->repr());
+    }
+    *target = value->pointer(this);
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::ophashmapcontains(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::types::Hash_map* map_operand = nullptr;
+    tie(addr, map_operand) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Hash_map>(addr, this);
+
+    viua::types::Value* key = nullptr;
+    tie(addr, key) = viua::bytecode::decoder::operands::fetch_object(addr, this);
+
+    *target = make_unique<viua::types::Boolean>(map_operand->contains(*key));
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::ophashmapkeys(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::types::Hash_map* map_operand = nullptr;
+    tie(addr, map_operand) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Hash_map>(addr, this);
+
+    auto keys = make_unique<viua::types::Vector>();
+    for (auto& each : map_operand->keys()) {
+        keys->push(std::move(each));
+    }
+
+    *target = std::move(keys);
+
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::ophashmapsize(
+    viua::internals::types::byte* addr) {
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
+
+    viua::types::Hash_map* map_operand = nullptr;
+    tie(addr, map_operand) = viua::bytecode::decoder::operands::fetch_object_of<
+        viua::types::Hash_map>(addr, this);
+
+    *target = make_unique<viua::types::Integer>(
+        static_cast<viua::types::Integer::underlying_type>(
+            map_operand->size()));
+
+    return addr;
+}
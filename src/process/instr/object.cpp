@@ -101,6 +101,10 @@ viua::internals::types::byte* viua::process::Process::opmsg(
             "unregistered type cannot be used for dynamic dispatch: "
             + obj->type());
     }
+    if (profile) {
+        profile->message(method_name, obj->type());
+    }
+
     vector<string> mro = scheduler->inheritance_chain_of(obj->type());
     mro.insert(mro.begin(), obj->type());
 
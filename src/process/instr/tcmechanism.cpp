@@ -106,6 +106,10 @@ viua::internals::types::byte* viua::process::Process::openter(
 
     stack->tryframes.emplace_back(std::move(stack->try_frame_new));
 
+    if (profile) {
+        profile->call(block_name);
+    }
+
     return block_address;
 }
 
@@ -25,11 +25,69 @@
 #include <viua/kernel/registerset.h>
 #include <viua/types/integer.h>
 #include <viua/types/pointer.h>
+#include <viua/types/typed_vector.h>
 #include <viua/types/value.h>
 #include <viua/types/vector.h>
 using namespace std;
 
 
+/*
+ * Vector instructions operate on both boxed and unboxed vectors.
+ * The vector operand is returned as one of them, and the other is null.
+ */
+static auto fetch_vector(viua::internals::types::byte* addr,
+                         viua::process::Process* process)
+    -> tuple<viua::internals::types::byte*,
+             viua::types::Vector*,
+             viua::types::Typed_vector*> {
+    viua::types::Value* fetched = nullptr;
+    tie(addr, fetched) =
+        viua::bytecode::decoder::operands::fetch_object(addr, process);
+
+    if (auto const boxed = dynamic_cast<viua::types::Vector*>(fetched)) {
+        return tuple<viua::internals::types::byte*,
+                     viua::types::Vector*,
+                     viua::types::Typed_vector*>{addr, boxed, nullptr};
+    }
+    if (auto const unboxed =
+            dynamic_cast<viua::types::Typed_vector*>(fetched)) {
+        return tuple<viua::internals::types::byte*,
+                     viua::types::Vector*,
+                     viua::types::Typed_vector*>{addr, nullptr, unboxed};
+    }
+    throw make_unique<viua::types::Exception>(
+        "fetched invalid type: expected '" + viua::types::Vector::type_name
+        + "' but got '" + fetched->type() + "'");
+}
+
+/*
+ * Elements are moved out of their registers (or copied from behind
+ * pointers), and an empty register must not become a null element.
+ */
+static auto fetch_element(viua::internals::types::byte* addr,
+                          viua::process::Process* process,
+                          string const& empty_source_error)
+    -> tuple<viua::internals::types::byte*, unique_ptr<viua::types::Value>> {
+    if (viua::bytecode::decoder::operands::get_operand_type(addr)
+        == OT_POINTER) {
+        viua::types::Value* source = nullptr;
+        tie(addr, source) =
+            viua::bytecode::decoder::operands::fetch_object(addr, process);
+        return tuple<viua::internals::types::byte*,
+                     unique_ptr<viua::types::Value>>{addr, source->copy()};
+    }
+
+    viua::kernel::Register* source = nullptr;
+    tie(addr, source) =
+        viua::bytecode::decoder::operands::fetch_register(addr, process);
+    if (source->empty()) {
+        throw make_unique<viua::types::Exception>(empty_source_error);
+    }
+    return tuple<viua::internals::types::byte*, unique_ptr<viua::types::Value>>{
+        addr, source->give()};
+}
+
+
 viua::internals::types::byte* viua::process::Process::opvector(
     viua::internals::types::byte* addr) {
     viua::internals::RegisterSets target_rs =
@@ -78,27 +136,40 @@ viua::internals::types::byte* viua::process::Process::opvector(
     return addr;
 }
 
-viua::internals::types::byte* viua::process::Process::opvinsert(
+viua::internals::types::byte* viua::process::Process::opvectorof(
     viua::internals::types::byte* addr) {
-    viua::types::Vector* vector_operand = nullptr;
-    tie(addr, vector_operand) =
-        viua::bytecode::decoder::operands::fetch_object_of<viua::types::Vector>(
-            addr, this);
+    viua::kernel::Register* target = nullptr;
+    tie(addr, target) =
+        viua::bytecode::decoder::operands::fetch_register(addr, this);
 
-    unique_ptr<viua::types::Value> object;
-    if (viua::bytecode::decoder::operands::get_operand_type(addr)
-        == OT_POINTER) {
-        viua::types::Value* source = nullptr;
-        tie(addr, source) =
-            viua::bytecode::decoder::operands::fetch_object(addr, this);
-        object = source->copy();
+    string element_type;
+    tie(addr, element_type) =
+        viua::bytecode::decoder::operands::fetch_primitive_string(addr, this);
+
+    if (element_type == "int") {
+        *target = make_unique<viua::types::Int_vector>();
+    } else if (element_type == "float") {
+        *target = make_unique<viua::types::Float_vector>();
+    } else if (element_type == "byte") {
+        *target = make_unique<viua::types::Byte_vector>();
     } else {
-        viua::kernel::Register* source = nullptr;
-        tie(addr, source) =
-            viua::bytecode::decoder::operands::fetch_register(addr, this);
-        object = source->give();
+        throw make_unique<viua::types::Exception>(
+            "invalid type of vector elements: " + element_type);
     }
 
+    return addr;
+}
+
+viua::internals::types::byte* viua::process::Process::opvinsert(
+    viua::internals::types::byte* addr) {
+    viua::types::Vector* vector_operand        = nullptr;
+    viua::types::Typed_vector* unboxed_operand = nullptr;
+    tie(addr, vector_operand, unboxed_operand) = fetch_vector(addr, this);
+
+    unique_ptr<viua::types::Value> object;
+    tie(addr, object) =
+        fetch_element(addr, this, "vinsert: cannot insert null register");
+
     viua::types::Integer* index_operand = nullptr;
     int64_t position_operand_index      = 0;
 
@@ -111,34 +182,31 @@ viua::internals::types::byte* viua::process::Process::opvinsert(
         addr = viua::bytecode::decoder::operands::fetch_void(addr);
     }
 
-    vector_operand->insert(position_operand_index, std::move(object));
+    if (unboxed_operand) {
+        unboxed_operand->insert(position_operand_index, std::move(object));
+    } else {
+        vector_operand->insert(position_operand_index, std::move(object));
+    }
 
     return addr;
 }
 
 viua::internals::types::byte* viua::process::Process::opvpush(
     viua::internals::types::byte* addr) {
-    viua::types::Vector* target = nullptr;
-    tie(addr, target) =
-        viua::bytecode::decoder::operands::fetch_object_of<viua::types::Vector>(
-            addr, this);
+    viua::types::Vector* target               = nullptr;
+    viua::types::Typed_vector* unboxed_target = nullptr;
+    tie(addr, target, unboxed_target)         = fetch_vector(addr, this);
 
     unique_ptr<viua::types::Value> object;
-    if (viua::bytecode::decoder::operands::get_operand_type(addr)
-        == OT_POINTER) {
-        viua::types::Value* source = nullptr;
-        tie(addr, source) =
-            viua::bytecode::decoder::operands::fetch_object(addr, this);
-        object = source->copy();
+    tie(addr, object) =
+        fetch_element(addr, this, "vpush: cannot push null register");
+
+    if (unboxed_target) {
+        unboxed_target->push(std::move(object));
     } else {
-        viua::kernel::Register* source = nullptr;
-        tie(addr, source) =
-            viua::bytecode::decoder::operands::fetch_register(addr, this);
-        object = source->give();
+        target->push(std::move(object));
     }
 
-    target->push(std::move(object));
-
     return addr;
 }
 
@@ -154,10 +222,9 @@ viua::internals::types::byte* viua::process::Process::opvpop(
         addr = viua::bytecode::decoder::operands::fetch_void(addr);
     }
 
-    viua::types::Vector* vector_operand = nullptr;
-    tie(addr, vector_operand) =
-        viua::bytecode::decoder::operands::fetch_object_of<viua::types::Vector>(
-            addr, this);
+    viua::types::Vector* vector_operand        = nullptr;
+    viua::types::Typed_vector* unboxed_operand = nullptr;
+    tie(addr, vector_operand, unboxed_operand) = fetch_vector(addr, this);
 
     viua::types::Integer* index_operand = nullptr;
     int64_t position_operand_index      = -1;
@@ -172,7 +239,8 @@ viua::internals::types::byte* viua::process::Process::opvpop(
     }
 
     unique_ptr<viua::types::Value> ptr =
-        vector_operand->pop(position_operand_index);
+        (unboxed_operand ? unboxed_operand->pop(position_operand_index)
+                         : vector_operand->pop(position_operand_index));
     if (not void_target) {
         *target = std::move(ptr);
     }
@@ -186,33 +254,37 @@ viua::internals::types::byte* viua::process::Process::opvat(
     tie(addr, target) =
         viua::bytecode::decoder::operands::fetch_register(addr, this);
 
-    viua::types::Vector* vector_operand = nullptr;
-    tie(addr, vector_operand) =
-        viua::bytecode::decoder::operands::fetch_object_of<viua::types::Vector>(
-            addr, this);
+    viua::types::Vector* vector_operand        = nullptr;
+    viua::types::Typed_vector* unboxed_operand = nullptr;
+    tie(addr, vector_operand, unboxed_operand) = fetch_vector(addr, this);
 
     viua::types::Integer* index_operand = nullptr;
     tie(addr, index_operand) =
         viua::bytecode::decoder::operands::fetch_object_of<
             viua::types::Integer>(addr, this);
 
-    *target = vector_operand->at(index_operand->as_integer())->pointer(this);
+    if (unboxed_operand) {
+        *target = unboxed_operand->at(index_operand->as_integer());
+    } else {
+        *target =
+            vector_operand->at(index_operand->as_integer())->pointer(this);
+    }
 
     return addr;
 }
 
 viua::internals::types::byte* viua::process::Process::opvlen(
     viua::internals::types::byte* addr) {
-    viua::kernel::Register* target = nullptr;
-    viua::types::Vector* source    = nullptr;
+    viua::kernel::Register* target            = nullptr;
+    viua::types::Vector* source               = nullptr;
+    viua::types::Typed_vector* unboxed_source = nullptr;
 
     tie(addr, target) =
         viua::bytecode::decoder::operands::fetch_register(addr, this);
-    tie(addr, source) =
-        viua::bytecode::decoder::operands::fetch_object_of<viua::types::Vector>(
-            addr, this);
+    tie(addr, source, unboxed_source) = fetch_vector(addr, this);
 
-    *target = make_unique<viua::types::Integer>(source->len());
+    *target = make_unique<viua::types::Integer>(
+        unboxed_source ? unboxed_source->len() : source->len());
 
     return addr;
 }
@@ -25,10 +25,18 @@
 using namespace std;
 
 
+/*
+ * Register set made current when a stack becomes empty, and the process has
+ * no global register set.
+ * It has no registers so it is never modified, and may be shared by all
+ * processes.
+ */
+static viua::kernel::RegisterSet no_registers{0};
+
+
 viua::process::Stack::Stack(string fn,
                             Process* pp,
                             viua::kernel::RegisterSet** curs,
-                            viua::kernel::RegisterSet* gs,
                             viua::scheduler::VirtualProcessScheduler* sch)
         : current_state(STATE::RUNNING)
         , entry_function(fn)
@@ -40,20 +48,20 @@ viua::process::Stack::Stack(string fn,
         , thrown(nullptr)
         , caught(nullptr)
         , currently_used_register_set(curs)
-        , global_register_set(gs)
         , return_value(nullptr)
         , scheduler(sch) {}
 
 auto viua::process::Stack::set_return_value() -> void {
     // FIXME find better name for this function
-    if (back()->return_register != nullptr) {
+    auto const& frame = back();
+    if (frame->return_register != nullptr and not frame->return_value) {
         // we check in 0. register because it's reserved for return values
         if ((*currently_used_register_set)->at(0) == nullptr) {
             throw make_unique<viua::types::Exception>(
                 "return value requested by frame but function did not set "
                 "return register");
         }
-        return_value = (*currently_used_register_set)->pop(0);
+        frame->return_value = (*currently_used_register_set)->pop(0);
     }
 }
 
@@ -67,10 +75,8 @@ auto viua::process::Stack::state_of(const STATE s) -> STATE {
     return previous_state;
 }
 
-auto viua::process::Stack::bind(viua::kernel::RegisterSet** curs,
-                                viua::kernel::RegisterSet* gs) -> void {
+auto viua::process::Stack::bind(viua::kernel::RegisterSet** curs) -> void {
     currently_used_register_set = curs;
-    global_register_set         = gs;
 }
 
 auto viua::process::Stack::begin() const -> decltype(frames.begin()) {
@@ -95,29 +101,50 @@ auto viua::process::Stack::register_deferred_calls_from(Frame* frame) -> void {
         auto s = make_unique<Stack>(each->function_name,
                                     parent_process,
                                     currently_used_register_set,
-                                    global_register_set,
                                     scheduler);
         s->emplace_back(std::move(each));
         s->instruction_pointer = adjust_jump_base_for(s->at(0)->function_name);
-        s->bind(currently_used_register_set, global_register_set);
-        parent_process->stacks_order.push(s.get());
-        parent_process->stacks[s.get()] = std::move(s);
+        s->at(0)->compiled_code =
+            parent_process->compiled_code_of(s->at(0)->function_name);
+        if (parent_process->profile) {
+            parent_process->profile->call(s->at(0)->function_name);
+        }
+        s->bind(currently_used_register_set);
+        parent_process->stacks_order.push(parent_process->adopt(std::move(s)));
     }
 
     // remember to clear deferred calls vector to avoid
     // accidentally deferring a frame twice!
     frame->deferred_calls.clear();
 }
-auto viua::process::Stack::register_deferred_calls(const bool push_this_stack)
-    -> void {
-    // Mark current stack as the one to return to after all
-    // the deferred calls complete, *but* only if the stack is not exhausted as
-    // there is no reason to return to such stacks.
-    if (push_this_stack and size() > 1) {
-        parent_process->stacks_order.push(this);
+auto viua::process::Stack::run_next_deferred_call(
+    viua::internals::types::byte* return_address)
+    -> viua::internals::types::byte* {
+    auto& deferred_calls = back()->deferred_calls;
+    if (deferred_calls.empty()) {
+        return nullptr;
+    }
+
+    while ((not tryframes.empty())
+           and tryframes.back()->associated_frame == back().get()) {
+        tryframes.pop_back();
+    }
+
+    auto postponed = std::move(frame_new);
+    frame_new      = std::move(deferred_calls.back());
+    deferred_calls.pop_back();
+
+    frame_new->return_address      = return_address;
+    frame_new->postponed_frame_new = std::move(postponed);
+    push_prepared_frame();
+
+    auto const& call_name = back()->function_name;
+    back()->compiled_code = parent_process->compiled_code_of(call_name);
+    if (parent_process->profile) {
+        parent_process->profile->call(call_name);
     }
 
-    register_deferred_calls_from(back().get());
+    return adjust_jump_base_for(call_name);
 }
 
 auto viua::process::Stack::pop() -> unique_ptr<Frame> {
@@ -141,7 +168,17 @@ auto viua::process::Stack::pop() -> unique_ptr<Frame> {
     if (size()) {
         *currently_used_register_set = back()->local_register_set.get();
     } else {
-        *currently_used_register_set = global_register_set;
+        /*
+         * Nothing runs on an empty stack, but the current register set must
+         * not be left null.
+         * Allocating the global register set just for this would make every
+         * spawned process pay for it so, unless the process already has one,
+         * a set with no registers is used (any access to it throws).
+         */
+        *currently_used_register_set =
+            (parent_process->global_register_set
+                 ? parent_process->global_register_set.get()
+                 : &no_registers);
     }
 
     return frame;
@@ -155,6 +192,24 @@ auto viua::process::Stack::clear() -> void {
     frames.clear();
 }
 
+auto viua::process::Stack::reaches(viua::types::Value const* value) const
+    -> bool {
+    for (auto const& each : frames) {
+        if (each->reaches(value)) {
+            return true;
+        }
+    }
+    if (frame_new and frame_new->reaches(value)) {
+        return true;
+    }
+    for (auto const each : {thrown.get(), caught.get(), return_value.get()}) {
+        if (each and each->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 auto viua::process::Stack::emplace_back(unique_ptr<Frame> frame)
     -> decltype(frames.emplace_back(frame)) {
     return frames.emplace_back(std::move(frame));
@@ -301,6 +356,33 @@ auto viua::process::Stack::unwind() -> void {
         for (size_type i = 0; i < size(); ++i) {
             register_deferred_calls_from(at(i).get());
         }
+
+        /*
+         * Once deferred calls of a coroutine have finished the exception is
+         * passed to the stack which resumed the coroutine, and is unwound
+         * there as if it was thrown by the resume instruction.
+         */
+        if (resumer and parent_process->stacks_order.top() == this) {
+            parent_process->stacks_order.pop();
+            clear();
+
+            auto const resumed_by = resumer;
+            resumed_by->thrown    = std::move(thrown);
+            resumer               = nullptr;
+            resume_register       = nullptr;
+            parent_process->stack = resumed_by;
+            parent_process->currently_used_register_set =
+                resumed_by->back()->local_register_set.get();
+
+            /*
+             * This stack may be destroyed during unwinding of the resumer
+             * (together with the coroutine owning it) so it must not be
+             * touched afterwards.
+             */
+            resumed_by->unwind();
+            return;
+        }
+
         if (not parent_process->stacks_order.empty()) {
             parent_process->stack = parent_process->stacks_order.top();
             parent_process->stacks_order.pop();
@@ -316,10 +398,46 @@ auto viua::process::Stack::prepare_frame(
     if (frame_new) {
         throw "requested new frame while last one is unused";
     }
-    frame_new = make_unique<Frame>(nullptr, arguments_size, registers_size);
+    if (spare_frame) {
+        frame_new = std::move(spare_frame);
+        frame_new->arguments->reset(arguments_size);
+        frame_new->local_register_set->reset(registers_size);
+    } else {
+        frame_new =
+            make_unique<Frame>(nullptr, arguments_size, registers_size);
+    }
     return frame_new.get();
 }
 
+auto viua::process::Stack::recycle(unique_ptr<Frame> frame) -> void {
+    /*
+     * Local register set of a frame running a closure belongs to the
+     * closure.
+     */
+    if (not frame->local_register_set.owns()) {
+        return;
+    }
+
+    /*
+     * Values are deleted right away (and not when the frame is reused) so
+     * that they do not outlive the call they were created in.
+     */
+    frame->arguments->reset(0);
+    frame->local_register_set->reset(0);
+
+    frame->return_address      = nullptr;
+    frame->return_register     = nullptr;
+    frame->return_value.reset();
+    frame->compiled_code       = nullptr;
+    frame->backward_jumps      = 0;
+    frame->static_register_set = nullptr;
+    frame->deferred_calls.clear();
+    frame->postponed_frame_new.reset();
+    frame->function_name.clear();
+
+    spare_frame = std::move(frame);
+}
+
 auto viua::process::Stack::push_prepared_frame() -> void {
     if (size() > MAX_STACK_SIZE) {
         ostringstream oss;
@@ -207,6 +207,11 @@ Program& Program::opvector(int_op index,
     return (*this);
 }
 
+Program& Program::opvectorof(int_op index, string const& element_type) {
+    addr_ptr = cg::bytecode::opvectorof(addr_ptr, index, element_type);
+    return (*this);
+}
+
 Program& Program::opvinsert(int_op vec, int_op src, int_op dst) {
     addr_ptr = cg::bytecode::opvinsert(addr_ptr, vec, src, dst);
     return (*this);
@@ -715,11 +720,58 @@ Program& Program::opreceive(int_op ref, timeout_op timeout) {
     return (*this);
 }
 
+Program& Program::opsendall(int_op target, int_op source) {
+    addr_ptr = cg::bytecode::opsendall(addr_ptr, target, source);
+    return (*this);
+}
+
+Program& Program::opbroadcast(int_op targets, int_op source) {
+    addr_ptr = cg::bytecode::opbroadcast(addr_ptr, targets, source);
+    return (*this);
+}
+
+Program& Program::opreceivemany(int_op target, int_op count) {
+    addr_ptr = cg::bytecode::opreceivemany(addr_ptr, target, count);
+    return (*this);
+}
+
+Program& Program::opreceivematch(int_op target,
+                                 int_op filter,
+                                 timeout_op timeout) {
+    addr_ptr = cg::bytecode::opreceivematch(addr_ptr, target, filter, timeout);
+    return (*this);
+}
+
+Program& Program::opsleep(int_op duration) {
+    addr_ptr = cg::bytecode::opsleep(addr_ptr, duration);
+    return (*this);
+}
+
+Program& Program::oppriority(int_op priority_class) {
+    addr_ptr = cg::bytecode::oppriority(addr_ptr, priority_class);
+    return (*this);
+}
+
 Program& Program::opwatchdog(const string& fn_name) {
     addr_ptr = cg::bytecode::opwatchdog(addr_ptr, fn_name);
     return (*this);
 }
 
+Program& Program::opcoroutine(int_op reg, const string& fn_name) {
+    addr_ptr = cg::bytecode::opcoroutine(addr_ptr, reg, fn_name);
+    return (*this);
+}
+
+Program& Program::opresume(int_op target, int_op coroutine) {
+    addr_ptr = cg::bytecode::opresume(addr_ptr, target, coroutine);
+    return (*this);
+}
+
+Program& Program::opyield(int_op value) {
+    addr_ptr = cg::bytecode::opyield(addr_ptr, value);
+    return (*this);
+}
+
 Program& Program::opjump(viua::internals::types::bytecode_size addr,
                          enum JUMPTYPE is_absolute) {
     /*  Inserts jump instruction. Parameter is instruction index.
@@ -879,6 +931,41 @@ Program& Program::opstructkeys(int_op a, int_op b) {
     return (*this);
 }
 
+Program& Program::ophashmap(int_op regno) {
+    addr_ptr = cg::bytecode::ophashmap(addr_ptr, regno);
+    return (*this);
+}
+
+Program& Program::ophashmapinsert(int_op target, int_op key, int_op source) {
+    addr_ptr = cg::bytecode::ophashmapinsert(addr_ptr, target, key, source);
+    return (*this);
+}
+
+Program& Program::ophashmapremove(int_op target, int_op source, int_op key) {
+    addr_ptr = cg::bytecode::ophashmapremove(addr_ptr, target, source, key);
+    return (*this);
+}
+
+Program& Program::ophashmaplookup(int_op target, int_op source, int_op key) {
+    addr_ptr = cg::bytecode::ophashmaplookup(addr_ptr, target, source, key);
+    return (*this);
+}
+
+Program& Program::ophashmapcontains(int_op target, int_op source, int_op key) {
+    addr_ptr = cg::bytecode::ophashmapcontains(addr_ptr, target, source, key);
+    return (*this);
+}
+
+Program& Program::ophashmapkeys(int_op a, int_op b) {
+    addr_ptr = cg::bytecode::ophashmapkeys(addr_ptr, a, b);
+    return (*this);
+}
+
+Program& Program::ophashmapsize(int_op a, int_op b) {
+    addr_ptr = cg::bytecode::ophashmapsize(addr_ptr, a, b);
+    return (*this);
+}
+
 Program& Program::opnew(int_op reg, const string& class_name) {
     addr_ptr = cg::bytecode::opnew(addr_ptr, reg, class_name);
     return (*this);
@@ -0,0 +1,173 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <viua/process.h>
+#include <viua/scheduler/timer_wheel.h>
+using namespace std;
+
+
+namespace viua { namespace scheduler {
+auto Timer_wheel::Timer::armed() const -> bool {
+    return (wheel != nullptr);
+}
+auto Timer_wheel::Timer::expired() const -> bool {
+    return fired;
+}
+auto Timer_wheel::Timer::cancel() -> void {
+    fired = false;
+    if (wheel) {
+        wheel->unlink(*this);
+    }
+}
+
+Timer_wheel::Timer::Timer(viua::process::Process* p) : process(p) {}
+Timer_wheel::Timer::~Timer() {
+    cancel();
+}
+
+
+auto Timer_wheel::tick_of(clock_type::time_point const t) const -> tick_type {
+    if (t <= origin) {
+        return 0;
+    }
+    return static_cast<tick_type>(
+        chrono::duration_cast<chrono::milliseconds>(t - origin).count());
+}
+
+auto Timer_wheel::place(Timer& timer) -> void {
+    /*
+     * A timer is put on the lowest level whose slots are wide enough to
+     * reach its deadline.
+     * Deadlines farther away than the whole wheel reaches are put on the
+     * highest level and moved back up every time their slot is cascaded.
+     */
+    auto const delta = (timer.deadline - current);
+    auto level       = 0u;
+    while ((level + 1) < levels
+           and delta >= (tick_type{1} << (slot_bits * (level + 1)))) {
+        ++level;
+    }
+
+    auto const slot = ((level * slots)
+                       + ((timer.deadline >> (slot_bits * level)) & (slots - 1)));
+    auto& head = wheel[slot];
+
+    timer.next = head;
+    if (head) {
+        head->link = &timer.next;
+    }
+    head       = &timer;
+    timer.link = &head;
+}
+auto Timer_wheel::unlink(Timer& timer) -> void {
+    *timer.link = timer.next;
+    if (timer.next) {
+        timer.next->link = timer.link;
+    }
+    timer.link  = nullptr;
+    timer.next  = nullptr;
+    timer.wheel = nullptr;
+    --pending;
+}
+auto Timer_wheel::cascade(unsigned const level) -> void {
+    auto const slot =
+        ((level * slots) + ((current >> (slot_bits * level)) & (slots - 1)));
+
+    auto timer  = wheel[slot];
+    wheel[slot] = nullptr;
+    while (timer) {
+        auto const next = timer->next;
+        place(*timer);
+        timer = next;
+    }
+}
+
+auto Timer_wheel::schedule(Timer& timer, chrono::milliseconds const after)
+    -> void {
+    timer.cancel();
+
+    /*
+     * Slot of the current tick has already been expired so a timer must
+     * expire during the next tick at the earliest.
+     */
+    timer.deadline = max(tick_of(clock_type::now() + after), (current + 1));
+    timer.wheel    = this;
+    ++pending;
+    place(timer);
+}
+
+auto Timer_wheel::advance(clock_type::time_point const t) -> void {
+    auto const target = tick_of(t);
+    if (not pending) {
+        current = max(current, target);
+        return;
+    }
+
+    while (current < target) {
+        ++current;
+
+        /*
+         * Higher levels are cascaded first as their timers may land in the
+         * slots of lower levels that are cascaded next.
+         */
+        auto level = 0u;
+        while ((level + 1) < levels
+               and (current & ((tick_type{1} << (slot_bits * (level + 1))) - 1))
+                       == 0) {
+            ++level;
+        }
+        for (; level > 0; --level) {
+            cascade(level);
+        }
+
+        auto& head = wheel[current & (slots - 1)];
+        while (head) {
+            auto& timer = *head;
+            unlink(timer);
+            timer.fired = true;
+            if (timer.process) {
+                timer.process->wakeup();
+            }
+        }
+
+        if (not pending) {
+            current = target;
+        }
+    }
+}
+
+auto Timer_wheel::empty() const -> bool {
+    return (pending == 0);
+}
+
+Timer_wheel::Timer_wheel() : origin(clock_type::now()) {
+    wheel.fill(nullptr);
+}
+Timer_wheel::~Timer_wheel() {
+    for (auto head : wheel) {
+        while (head) {
+            auto const next = head->next;
+            head->link      = nullptr;
+            head->next      = nullptr;
+            head->wheel     = nullptr;
+            head            = next;
+        }
+    }
+}
+}}  // namespace viua::scheduler
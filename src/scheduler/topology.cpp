@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+#include <viua/scheduler/topology.h>
+using namespace std;
+
+
+static auto read_line(string const& path) -> string {
+    auto in   = ifstream{path};
+    auto line = string{};
+    getline(in, line);
+    return line;
+}
+
+
+namespace viua { namespace scheduler {
+auto Topology::nodes() const -> node_type {
+    return cpus.size();
+}
+auto Topology::cpus_of(node_type const node) const
+    -> vector<cpu_type> const& {
+    return cpus.at(node);
+}
+
+auto Topology::placement_of(uint64_t const n) const
+    -> pair<node_type, cpu_type> {
+    auto const node     = (n % nodes());
+    auto const& of_node = cpus_of(node);
+    return {node, of_node.at((n / nodes()) % of_node.size())};
+}
+
+auto Topology::parse_cpu_list(string const& list) -> vector<cpu_type> {
+    auto parsed = vector<cpu_type>{};
+
+    auto const parse_cpu = [&list](string const& s) -> cpu_type {
+        if (s.empty() or s.find_first_not_of("0123456789") != string::npos) {
+            throw("malformed CPU list: " + list);
+        }
+        return static_cast<cpu_type>(stoul(s));
+    };
+
+    auto begin = string::size_type{0};
+    while (begin < list.size()) {
+        auto end = list.find(',', begin);
+        if (end == string::npos) {
+            end = list.size();
+        }
+        auto const range = list.substr(begin, (end - begin));
+        begin            = (end + 1);
+
+        auto const dash = range.find('-');
+        if (dash == string::npos) {
+            parsed.push_back(parse_cpu(range));
+            continue;
+        }
+
+        auto const first = parse_cpu(range.substr(0, dash));
+        auto const last  = parse_cpu(range.substr(dash + 1));
+        if (last < first) {
+            throw("malformed CPU list: " + list);
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            parsed.push_back(cpu);
+        }
+    }
+
+    return parsed;
+}
+
+auto Topology::discover() -> Topology {
+    auto cpus = vector<vector<cpu_type>>{};
+
+    try {
+        auto const online_nodes =
+            parse_cpu_list(read_line("/sys/devices/system/node/online"));
+        for (auto const node : online_nodes) {
+            auto of_node = parse_cpu_list(
+                read_line("/sys/devices/system/node/node" + to_string(node)
+                          + "/cpulist"));
+            if (not of_node.empty()) {
+                cpus.push_back(std::move(of_node));
+            }
+        }
+    } catch (string const&) {
+        cpus.clear();
+    }
+
+    /*
+     * Kernels built without NUMA support do not expose nodes, and
+     * some sandboxes do not expose /sys at all.
+     */
+    if (cpus.empty()) {
+        try {
+            auto online =
+                parse_cpu_list(read_line("/sys/devices/system/cpu/online"));
+            if (not online.empty()) {
+                cpus.push_back(std::move(online));
+            }
+        } catch (string const&) {
+            // fall through to the last resort below
+        }
+    }
+    if (cpus.empty()) {
+        auto all = vector<cpu_type>{};
+        for (auto cpu = 0u; cpu < max(1u, thread::hardware_concurrency());
+             ++cpu) {
+            all.push_back(cpu);
+        }
+        cpus.push_back(std::move(all));
+    }
+
+    return Topology{std::move(cpus)};
+}
+
+Topology::Topology(vector<vector<cpu_type>> c) : cpus(std::move(c)) {}
+
+
+auto pin(Topology::cpu_type const cpu) -> bool {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+}
+}}  // namespace viua::scheduler
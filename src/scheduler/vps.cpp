@@ -17,6 +17,8 @@
  *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <stdexcept>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -212,6 +214,12 @@ bool viua::scheduler::VirtualProcessScheduler::execute_quant(
         return true;
     }
 
+    if (not th->stopped()) {
+        latency.at(static_cast<size_t>(th->priority_class()))
+            .record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - th->ready_since()));
+    }
+
     for (decltype(priority) j = 0; (priority == 0 or j < priority); ++j) {
         if (th->stopped()) {
             // remember to break if the process stopped
@@ -224,12 +232,20 @@ bool viua::scheduler::VirtualProcessScheduler::execute_quant(
             break;
         }
 #if VIUA_VM_DEBUG_LOG
-        viua_err("[sched:vps:quant] pid = ", th->pid().get(), ", tick = ", j);
+        viua_err("[sched:vps:quant] pid = ", th->pid().str(), ", tick = ", j);
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
 #endif
         th->tick();
     }
 
+    /*
+     * Suspended processes start waiting for their next turn when they are
+     * woken up.
+     */
+    if (not th->suspended()) {
+        th->ready_since(std::chrono::steady_clock::now());
+    }
+
     return true;
 }
 
@@ -339,19 +355,46 @@ void viua::scheduler::VirtualProcessScheduler::load_module(string module) {
 }
 
 auto viua::scheduler::VirtualProcessScheduler::cpi() const
-    -> decltype(processes)::size_type {
+    -> process_list::size_type {
     return current_process_index;
 }
 
 
 auto viua::scheduler::VirtualProcessScheduler::size() const
-    -> decltype(processes)::size_type {
-    return processes.size();
+    -> process_list::size_type {
+    auto total = process_list::size_type{0};
+    for (auto const& each : run_queues) {
+        total += each.size();
+    }
+    return total;
 }
 
 viua::process::Process* viua::scheduler::VirtualProcessScheduler::process(
-    decltype(processes)::size_type index) {
-    return processes.at(index).get();
+    process_list::size_type index) {
+    /*
+     * Processes are indexed as if the run queues were laid out one after
+     * another, from the highest priority class to the lowest.
+     */
+    for (auto& each : run_queues) {
+        if (index < each.size()) {
+            return each.at(index).get();
+        }
+        index -= each.size();
+    }
+    throw std::out_of_range("no process at index " + to_string(index));
+}
+
+auto viua::scheduler::VirtualProcessScheduler::run_queue_of(
+    viua::process::Priority_class const priority_class) -> process_list& {
+    return run_queues.at(static_cast<size_t>(priority_class));
+}
+auto viua::scheduler::VirtualProcessScheduler::enqueue(
+    unique_ptr<viua::process::Process> p) -> void {
+    run_queue_of(p->priority_class()).emplace_back(std::move(p));
+}
+auto viua::scheduler::VirtualProcessScheduler::run_queue_latency() const
+    -> decltype(latency) const& {
+    return latency;
 }
 
 viua::process::Process* viua::scheduler::VirtualProcessScheduler::process() {
@@ -370,11 +413,10 @@ viua::process::Process* viua::scheduler::VirtualProcessScheduler::spawn(
     }
 
     viua::process::Process* process_ptr = p.get();
-    const auto total_processes =
-        attached_kernel->create_mailbox(process_ptr->pid());
     if (not disown) {
         attached_kernel->create_result_slot_for(process_ptr->pid());
     }
+    const auto total_processes    = attached_kernel->pids();
     const auto running_schedulers = attached_kernel->no_of_vp_schedulers();
 
     /*
@@ -393,9 +435,13 @@ viua::process::Process* viua::scheduler::VirtualProcessScheduler::spawn(
      * posting immediately. This was measured using lots of short-lived
      * processes in the "N bottles of beer" bechmark: 16384 bottles, 8
      * schedulers, on a CPU with 4 physical cores.
+     *
+     * A lone scheduler keeps its processes as there is no other scheduler to
+     * post them to, and it would not fetch them back until all of its local
+     * processes finished.
      */
-    if (processes.size()
-        > ((total_processes / running_schedulers) / 100 * 140)) {
+    if (running_schedulers > 1
+        and size() > ((total_processes / running_schedulers) / 100 * 140)) {
 #if VIUA_VM_DEBUG_LOG
         viua_err("[scheduler:vps:",
                  this,
@@ -405,7 +451,7 @@ viua::process::Process* viua::scheduler::VirtualProcessScheduler::spawn(
                  p->starting_function(),
                  " to kernel");
 #endif
-        attached_kernel->post_free_process(std::move(p));
+        attached_kernel->post_free_process(std::move(p), numa_node);
     } else {
 #if VIUA_VM_DEBUG_LOG
         viua_err("[scheduler:vps:",
@@ -415,7 +461,7 @@ viua::process::Process* viua::scheduler::VirtualProcessScheduler::spawn(
                  ":",
                  p->starting_function());
 #endif
-        processes.emplace_back(std::move(p));
+        enqueue(std::move(p));
     }
 
     return process_ptr;
@@ -425,18 +471,41 @@ void viua::scheduler::VirtualProcessScheduler::send(
     const viua::process::PID pid,
     unique_ptr<viua::types::Value> message) {
 #if VIUA_VM_DEBUG_LOG
-    viua_err("[sched:vps:send] pid = ", pid.get());
+    viua_err("[sched:vps:send] pid = ", pid.str());
 #endif
     attached_kernel->send(pid, std::move(message));
 }
+void viua::scheduler::VirtualProcessScheduler::send(
+    const viua::process::PID pid,
+    vector<unique_ptr<viua::types::Value>> messages) {
+#if VIUA_VM_DEBUG_LOG
+    viua_err("[sched:vps:send] pid = ", pid.str(), ", messages = ",
+             messages.size());
+#endif
+    attached_kernel->send(pid, std::move(messages));
+}
+void viua::scheduler::VirtualProcessScheduler::broadcast(
+    vector<viua::process::PID> const& pids,
+    unique_ptr<viua::types::Value> message) {
+#if VIUA_VM_DEBUG_LOG
+    viua_err("[sched:vps:broadcast] receivers = ", pids.size());
+#endif
+    attached_kernel->broadcast(pids, std::move(message));
+}
 
+auto viua::scheduler::VirtualProcessScheduler::schedule_timer(
+    Timer_wheel::Timer& timer,
+    std::chrono::milliseconds const after) -> void {
+    timers.schedule(timer, after);
+}
 void viua::scheduler::VirtualProcessScheduler::receive(
     const viua::process::PID pid,
-    queue<unique_ptr<viua::types::Value>>& message_queue) {
+    deque<unique_ptr<viua::types::Value>>& message_queue,
+    viua::process::Process* waiter) {
 #if VIUA_VM_DEBUG_LOG
-    viua_err("[sched:vps:receive] pid = ", pid.get());
+    viua_err("[sched:vps:receive] pid = ", pid.str());
 #endif
-    attached_kernel->receive(pid, message_queue);
+    attached_kernel->receive(pid, message_queue, waiter);
 }
 
 auto viua::scheduler::VirtualProcessScheduler::is_joinable(
@@ -461,25 +530,33 @@ auto viua::scheduler::VirtualProcessScheduler::transfer_result_of(
 }
 
 bool viua::scheduler::VirtualProcessScheduler::burst() {
-    if (not processes.size()) {
+    if (not size()) {
         // make kernel stop if there are no processes_list to run
         return false;
     }
 
+    timers.advance(Timer_wheel::clock_type::now());
+
     bool ticked     = false;
     bool any_active = false;
 
-    vector<unique_ptr<viua::process::Process>> running_processes_list;
+    process_list running_processes_list;
     decltype(running_processes_list) dead_processes_list;
     current_load = 0;
-    for (decltype(running_processes_list)::size_type i = 0;
-         i < processes.size();
-         ++i) {
-        current_process_index = i;
-        auto th               = processes.at(i).get();
+    auto processes_run = process_list::size_type{0};
+
+    /*
+     * Processes are looked up by index on every step because processes they
+     * spawn are appended to the run queues, possibly to the one that is being
+     * run.
+     */
+    auto const run = [&](process_list& lane,
+                         process_list::size_type const i) {
+        current_process_index = processes_run++;
+        auto th               = lane.at(i).get();
 
 #if VIUA_VM_DEBUG_LOG
-        viua_err("[sched:vps:burst] pid = ", th->pid().get());
+        viua_err("[sched:vps:burst] pid = ", th->pid().str());
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
 #endif
         execute_quant(th, th->priority());
@@ -519,14 +596,14 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
             // REMEMBER: the last thing that is done after servicing an FFI call
             // is waking the process up so as long as the process is suspended
             // it must be considered to be running.
-            running_processes_list.emplace_back(std::move(processes.at(i)));
-            continue;
+            running_processes_list.emplace_back(std::move(lane.at(i)));
+            return;
         }
 
         if (th->terminated() and not th->joinable()
             and th->parent() == nullptr) {
 #if VIUA_VM_DEBUG_LOG
-            viua_err("[sched:vps:died] pid = ", th->pid().get());
+            viua_err("[sched:vps:died] pid = ", th->pid().str());
 #endif
             if (not th->watchdogged()) {
                 if (th == main_process) {
@@ -570,15 +647,14 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
 
                 print_stack_trace(th);
 
-                attached_kernel->delete_mailbox(th->pid());
 // push broken process to dead processes_list list to
 // erase it later
 #if VIUA_VM_DEBUG_LOG
                 viua_err("[scheduler:vps] process ",
-                         processes.at(i).get(),
+                         lane.at(i).get(),
                          ": marked as dead");
 #endif
-                dead_processes_list.emplace_back(std::move(processes.at(i)));
+                dead_processes_list.emplace_back(std::move(lane.at(i)));
             } else {
                 auto death_message = make_unique<viua::types::Object>("Object");
                 unique_ptr<viua::types::Value> exc(
@@ -586,6 +662,7 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
                 auto parameters = make_unique<viua::types::Vector>();
                 viua::kernel::RegisterSet* top_args =
                     th->trace().at(0)->arguments.get();
+                parameters->value().reserve(top_args->size());
                 for (decltype(top_args->size()) j = 0; j < top_args->size();
                      ++j) {
                     if (top_args->at(j)) {
@@ -595,7 +672,7 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
 
 #if VIUA_VM_DEBUG_LOG
                 viua_err("[sched:vps:died:notify-watchdog] pid = ",
-                         th->pid().get(),
+                         th->pid().str(),
                          ", death cause: ",
                          exc->str());
 #endif
@@ -619,11 +696,11 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
                          th->watchdog());
 #endif
                 th->become(th->watchdog(), std::move(death_frame));
-                running_processes_list.emplace_back(std::move(processes.at(i)));
+                running_processes_list.emplace_back(std::move(lane.at(i)));
                 ticked = true;
             }
 
-            continue;
+            return;
         }
 
         // if the process stopped and is not joinable declare it dead and
@@ -631,23 +708,101 @@ bool viua::scheduler::VirtualProcessScheduler::burst() {
         // processes_list and speeding up execution
         if (th->stopped()) {
             attached_kernel->record_process_result(th);
-            dead_processes_list.emplace_back(std::move(processes.at(i)));
+            dead_processes_list.emplace_back(std::move(lane.at(i)));
         } else {
-            running_processes_list.emplace_back(std::move(processes.at(i)));
+            running_processes_list.emplace_back(std::move(lane.at(i)));
+        }
+    };
+
+    auto const run_lane = [&run](process_list& lane) {
+        for (auto i = process_list::size_type{0}; i < lane.size(); ++i) {
+            run(lane, i);
+        }
+    };
+
+    /*
+     * Realtime processes run first in every burst so they wait for the
+     * processor for at most a single burst.
+     */
+    run_lane(run_queue_of(viua::process::Priority_class::REALTIME));
+
+    auto& normal = run_queue_of(viua::process::Priority_class::NORMAL);
+    auto const normal_runnable =
+        any_of(normal.begin(),
+               normal.end(),
+               [](unique_ptr<viua::process::Process> const& each) {
+                   return (not each->suspended());
+               });
+    run_lane(normal);
+    if ((not normal_runnable) or (bursts % batch_burst_period) == 0) {
+        run_lane(run_queue_of(viua::process::Priority_class::BATCH));
+    }
+    ++bursts;
+
+    /*
+     * Processes from lanes that were skipped, and processes spawned after
+     * their lane had been run, must not be lost.
+     */
+    for (auto& lane : run_queues) {
+        for (auto& each : lane) {
+            if (each) {
+                running_processes_list.emplace_back(std::move(each));
+            }
         }
+        lane.clear();
+    }
+
+    for (auto const& each : dead_processes_list) {
+        attached_kernel->record_profile_of(each.get());
+        attached_kernel->delete_process_slot(each->pid());
     }
 
-    processes.erase(processes.begin(), processes.end());
-    processes.swap(running_processes_list);
+    /*
+     * Processes may have changed their priority classes during the burst.
+     */
+    for (auto& each : running_processes_list) {
+        enqueue(std::move(each));
+    }
 
     // FIXME scheduler should sleep only after checking if there are no free
     // processes to run and rebalancing
     if (not any_active) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        /*
+         * Pending timers must be expired on time so the scheduler only
+         * naps for a single tick of the wheel while there are any.
+         */
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(timers.empty() ? 10 : 1));
     }
 
     return ticked;
 }
+auto viua::scheduler::VirtualProcessScheduler::there_are_free_processes() const
+    -> bool {
+    return any_of(
+        free_processes->begin(),
+        free_processes->end(),
+        [](vector<unique_ptr<viua::process::Process>> const& each) {
+            return (not each.empty());
+        });
+}
+auto viua::scheduler::VirtualProcessScheduler::take_free_process()
+    -> unique_ptr<viua::process::Process> {
+    /*
+     * Processes from the scheduler's own node are preferred, then those from
+     * other nodes in turn.
+     */
+    auto const nodes = free_processes->size();
+    for (auto i = Topology::node_type{0}; i < nodes; ++i) {
+        auto& free_on_node = free_processes->at((numa_node + i) % nodes);
+        if (not free_on_node.empty()) {
+            auto p = std::move(free_on_node.front());
+            free_on_node.erase(free_on_node.begin());
+            return p;
+        }
+    }
+    return nullptr;
+}
 void viua::scheduler::VirtualProcessScheduler::operator()() {
     while (true) {
         // FIXME perform a single burst at a time - if scheduler keeps bursting
@@ -669,8 +824,8 @@ void viua::scheduler::VirtualProcessScheduler::operator()() {
             lock, chrono::milliseconds(10), [this] {
                 auto scheduler_should_shut_down =
                     shut_down.load(std::memory_order_acquire);
-                auto there_are_free_processes = (not free_processes->empty());
-                return (there_are_free_processes or scheduler_should_shut_down);
+                return (there_are_free_processes()
+                        or scheduler_should_shut_down);
             }))
             ;
 
@@ -679,13 +834,13 @@ void viua::scheduler::VirtualProcessScheduler::operator()() {
         // FIXME SEGFAULT RACECONDITION what if a process has been suspended
         // because it issued a FFI call, the scheduler exits (deleting the
         // process), and then the FFI call returns - segfault
-        if (free_processes->empty()) {
+        if (not there_are_free_processes()) {
 // this means that shutdown() was received
 #if VIUA_VM_DEBUG_LOG
             viua_err("[scheduler:vps:",
                      this,
                      "] shutting down with ",
-                     processes.size(),
+                     size(),
                      " local processes");
 #endif
             break;
@@ -716,18 +871,18 @@ void viua::scheduler::VirtualProcessScheduler::operator()() {
          * when you least expect it.
          */
         while (current_load <= (total_processes / running_schedulers)
-               and not free_processes->empty()) {
-            processes.emplace_back(std::move(free_processes->front()));
-            free_processes->erase(free_processes->begin());
-            processes.back()->migrate_to(this);
+               and there_are_free_processes()) {
+            auto p = take_free_process();
+            p->migrate_to(this);
 #if VIUA_VM_DEBUG_LOG
             viua_err("[scheduler:vps:",
                      this,
                      ":process-grab] grabbed process ",
-                     processes.back().get(),
+                     p.get(),
                      ':',
-                     processes.back()->starting_function());
+                     p->starting_function());
 #endif
+            enqueue(std::move(p));
             ++current_load;
         }
     }
@@ -735,7 +890,7 @@ void viua::scheduler::VirtualProcessScheduler::operator()() {
     viua_err("[scheduler:vps:",
              this,
              "] shut down with ",
-             processes.size(),
+             size(),
              " local processes");
 #endif
 }
@@ -761,6 +916,18 @@ void viua::scheduler::VirtualProcessScheduler::launch() {
     scheduler_thread = thread([this] { (*this)(); });
 }
 
+void viua::scheduler::VirtualProcessScheduler::launch(
+    Topology::cpu_type const cpu) {
+    scheduler_thread = thread([this, cpu] {
+        /*
+         * A scheduler that could not be pinned still works correctly, it
+         * just runs wherever the operating system puts it.
+         */
+        pin(cpu);
+        (*this)();
+    });
+}
+
 void viua::scheduler::VirtualProcessScheduler::shutdown() {
     shut_down.store(true, std::memory_order_release);
 }
@@ -775,17 +942,20 @@ int viua::scheduler::VirtualProcessScheduler::exit() const {
 
 viua::scheduler::VirtualProcessScheduler::VirtualProcessScheduler(
     viua::kernel::Kernel* akernel,
-    vector<unique_ptr<viua::process::Process>>* fp,
+    vector<vector<unique_ptr<viua::process::Process>>>* fp,
     mutex* fp_mtx,
     condition_variable* fp_cv,
+    Topology::node_type const node,
     const bool enable_tracing)
         : attached_kernel(akernel)
         , tracing_enabled(enable_tracing)
         , free_processes(fp)
         , free_processes_mutex(fp_mtx)
         , free_processes_cv(fp_cv)
+        , numa_node(node)
         , main_process(nullptr)
         , current_process_index(0)
+        , bursts(0)
         , exit_code(0)
         , current_load(0)
         , shut_down(false) {}
@@ -798,12 +968,15 @@ viua::scheduler::VirtualProcessScheduler::VirtualProcessScheduler(
     free_processes       = that.free_processes;
     free_processes_mutex = that.free_processes_mutex;
     free_processes_cv    = that.free_processes_cv;
+    numa_node            = that.numa_node;
 
     main_process               = that.main_process;
     that.main_process          = nullptr;
-    processes                  = std::move(that.processes);
+    run_queues                 = std::move(that.run_queues);
     current_process_index      = that.current_process_index;
     that.current_process_index = 0;
+    bursts                     = that.bursts;
+    latency                    = that.latency;
 
     exit_code = that.exit_code;
     shut_down.store(that.shut_down.load());
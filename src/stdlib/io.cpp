@@ -23,6 +23,7 @@
 #include <sstream>
 #include <string>
 #include <viua/include/module.h>
+#include <viua/process.h>
 #include <viua/types/exception.h>
 #include <viua/types/pointer.h>
 #include <viua/types/string.h>
@@ -0,0 +1,527 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <viua/include/module.h>
+#include <viua/kernel/frame.h>
+#include <viua/kernel/registerset.h>
+#include <viua/types/exception.h>
+#include <viua/types/float.h>
+#include <viua/types/integer.h>
+#include <viua/types/typed_vector.h>
+#include <viua/types/vector.h>
+using namespace std;
+
+
+/*
+ * Bulk numeric operations on vectors of integers and floats.
+ *
+ * Kernels process elements in lanes of simd_width bytes using GCC vector
+ * extensions, and the elements that do not fill a whole lane one by one.
+ * On x86-64 every kernel is compiled for AVX-512, AVX2, and the baseline
+ * (SSE2) instruction set, and the version best suited to the CPU is selected
+ * when the module is loaded.
+ * On other platforms kernels are compiled only for the baseline instruction
+ * set, which may mean scalar code.
+ */
+#if defined(__x86_64__) and defined(__GNUC__)
+#define VIUA_NUMERIC_KERNEL \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define VIUA_NUMERIC_KERNEL
+#endif
+
+static constexpr auto simd_width = size_t{64};
+
+template<typename T> struct Lane {
+    typedef T type __attribute__((vector_size(simd_width)));
+    static constexpr auto width = (simd_width / sizeof(T));
+};
+
+enum class Operation {
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    LT,
+    LTE,
+    GT,
+    GTE,
+    EQ,
+};
+
+/*
+ * Helpers are always inlined so that they are compiled for the same
+ * instruction set as the kernel using them.
+ * They take lanes by reference as passing vector types by value between
+ * functions compiled for different instruction sets is not ABI-compatible.
+ */
+#define VIUA_NUMERIC_HELPER __attribute__((always_inline)) static inline
+
+template<Operation op, typename Result, typename T>
+VIUA_NUMERIC_HELPER auto apply(Result& result, T const& lhs, T const& rhs)
+    -> void {
+    if constexpr (op == Operation::ADD) {
+        result = (lhs + rhs);
+    } else if constexpr (op == Operation::SUB) {
+        result = (lhs - rhs);
+    } else if constexpr (op == Operation::MUL) {
+        result = (lhs * rhs);
+    } else if constexpr (op == Operation::DIV) {
+        result = (lhs / rhs);
+    } else if constexpr (op == Operation::LT) {
+        result = (lhs < rhs);
+    } else if constexpr (op == Operation::LTE) {
+        result = (lhs <= rhs);
+    } else if constexpr (op == Operation::GT) {
+        result = (lhs > rhs);
+    } else if constexpr (op == Operation::GTE) {
+        result = (lhs >= rhs);
+    } else {
+        result = (lhs == rhs);
+    }
+}
+
+template<typename Lane_type, typename T>
+VIUA_NUMERIC_HELPER auto load(Lane_type& lane, T const* source) -> void {
+    memcpy(&lane, source, sizeof(lane));
+}
+
+/*
+ * Signed integer overflow is undefined so integers are added, subtracted,
+ * and multiplied as unsigned values, which wrap around on overflow in the
+ * same way as two's complement values do.
+ * Floats are used as they are.
+ */
+template<typename T> struct Wrapping { typedef T type; };
+template<> struct Wrapping<int64_t> { typedef uint64_t type; };
+
+/*
+ * Reinterprets bits of a value as a value of another type of the same size
+ * (e.g. an unsigned integer as a signed one).
+ */
+template<typename T, typename U>
+VIUA_NUMERIC_HELPER auto as(U const& value) -> T {
+    static_assert(sizeof(T) == sizeof(U), "reinterpreted types differ in size");
+    T result;
+    memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+
+template<Operation op, typename T>
+VIUA_NUMERIC_KERNEL static auto elementwise(T const* lhs,
+                                            T const* rhs,
+                                            T* out,
+                                            size_t const n) -> void {
+    /*
+     * Division cannot overflow as its operands are checked beforehand, and
+     * must be signed.
+     */
+    using U = conditional_t<op == Operation::DIV,
+                            T,
+                            typename Wrapping<T>::type>;
+
+    auto i = size_t{0};
+    for (; (i + Lane<U>::width) <= n; i += Lane<U>::width) {
+        typename Lane<U>::type a, b, result;
+        load(a, lhs + i);
+        load(b, rhs + i);
+        apply<op>(result, a, b);
+        memcpy(out + i, &result, sizeof(result));
+    }
+    for (; i < n; ++i) {
+        auto result = U{};
+        apply<op>(result, as<U>(lhs[i]), as<U>(rhs[i]));
+        out[i] = as<T>(result);
+    }
+}
+
+/*
+ * Comparisons produce masks: vectors of bytes which are 1 where the
+ * comparison is true, and 0 where it is false.
+ */
+template<Operation op, typename T>
+VIUA_NUMERIC_KERNEL static auto compare(T const* lhs,
+                                        T const* rhs,
+                                        uint8_t* out,
+                                        size_t const n) -> void {
+    auto i = size_t{0};
+    for (; (i + Lane<T>::width) <= n; i += Lane<T>::width) {
+        typename Lane<T>::type a, b;
+        load(a, lhs + i);
+        load(b, rhs + i);
+        decltype(a < b) result;
+        apply<op>(result, a, b);
+        for (auto j = size_t{0}; j < Lane<T>::width; ++j) {
+            out[i + j] = (result[j] ? 1 : 0);
+        }
+    }
+    for (; i < n; ++i) {
+        auto result = false;
+        apply<op>(result, lhs[i], rhs[i]);
+        out[i] = (result ? 1 : 0);
+    }
+}
+
+/*
+ * Floating point reductions add elements in a different order than a
+ * sequential loop would so their results may differ in the last bits.
+ */
+template<typename T>
+VIUA_NUMERIC_KERNEL static auto dot(T const* lhs, T const* rhs, size_t const n)
+    -> T {
+    using U = typename Wrapping<T>::type;
+
+    auto accumulator = typename Lane<U>::type{};
+    auto i           = size_t{0};
+    for (; (i + Lane<U>::width) <= n; i += Lane<U>::width) {
+        typename Lane<U>::type a, b;
+        load(a, lhs + i);
+        load(b, rhs + i);
+        accumulator += (a * b);
+    }
+
+    auto result = U{0};
+    for (auto j = size_t{0}; j < Lane<U>::width; ++j) {
+        result += accumulator[j];
+    }
+    for (; i < n; ++i) {
+        result += (as<U>(lhs[i]) * as<U>(rhs[i]));
+    }
+    return as<T>(result);
+}
+
+template<typename T>
+VIUA_NUMERIC_KERNEL static auto sum(T const* source, size_t const n) -> T {
+    using U = typename Wrapping<T>::type;
+
+    auto accumulator = typename Lane<U>::type{};
+    auto i           = size_t{0};
+    for (; (i + Lane<U>::width) <= n; i += Lane<U>::width) {
+        typename Lane<U>::type each;
+        load(each, source + i);
+        accumulator += each;
+    }
+
+    auto result = U{0};
+    for (auto j = size_t{0}; j < Lane<U>::width; ++j) {
+        result += accumulator[j];
+    }
+    for (; i < n; ++i) {
+        result += as<U>(source[i]);
+    }
+    return as<T>(result);
+}
+
+/*
+ * Selects the minimum (for LT) or maximum (for GT) of a non-empty sequence.
+ */
+template<Operation op, typename T>
+VIUA_NUMERIC_KERNEL static auto select(T const* source, size_t const n) -> T {
+    auto result = source[0];
+    auto better = false;
+    auto i      = size_t{0};
+    if (n >= Lane<T>::width) {
+        typename Lane<T>::type selected, each;
+        load(selected, source);
+        for (i = Lane<T>::width; (i + Lane<T>::width) <= n;
+             i += Lane<T>::width) {
+            load(each, source + i);
+            decltype(each < selected) mask;
+            apply<op>(mask, each, selected);
+            selected = (mask ? each : selected);
+        }
+        for (auto j = size_t{0}; j < Lane<T>::width; ++j) {
+            apply<op>(better, selected[j], result);
+            result = (better ? selected[j] : result);
+        }
+    }
+    for (; i < n; ++i) {
+        apply<op>(better, source[i], result);
+        result = (better ? source[i] : result);
+    }
+    return result;
+}
+
+/*
+ * Inclusive prefix sum.
+ * Each lane is scanned in log2(width) shift-and-add steps, and the sum of
+ * all preceding lanes is then added to all its elements.
+ */
+template<typename T>
+VIUA_NUMERIC_KERNEL static auto prefix_sum(T const* source,
+                                           T* out,
+                                           size_t const n) -> void {
+    using U = typename Wrapping<T>::type;
+    static_assert(Lane<U>::width == 8,
+                  "prefix sum expects 8 elements per lane");
+    using shuffle_type = typename Lane<int64_t>::type;
+
+    auto const zero = typename Lane<U>::type{};
+    auto carry      = U{0};
+    auto i          = size_t{0};
+    for (; (i + Lane<U>::width) <= n; i += Lane<U>::width) {
+        typename Lane<U>::type lane;
+        load(lane, source + i);
+        lane += __builtin_shuffle(
+            zero, lane, shuffle_type{0, 8, 9, 10, 11, 12, 13, 14});
+        lane += __builtin_shuffle(
+            zero, lane, shuffle_type{0, 0, 8, 9, 10, 11, 12, 13});
+        lane += __builtin_shuffle(
+            zero, lane, shuffle_type{0, 0, 0, 0, 8, 9, 10, 11});
+        lane += carry;
+        memcpy(out + i, &lane, sizeof(lane));
+        carry = lane[Lane<U>::width - 1];
+    }
+    for (; i < n; ++i) {
+        carry += as<U>(source[i]);
+        out[i] = as<T>(carry);
+    }
+}
+
+
+/*
+ * Operands are typed vectors of integers or floats, or boxed vectors which
+ * are unboxed into a temporary before the operation: to an integer vector
+ * if they contain only Integers, and to a float vector if they contain
+ * Floats too.
+ */
+static auto unbox(viua::types::Value* value,
+                  unique_ptr<viua::types::Value>& holder)
+    -> viua::types::Value* {
+    if (dynamic_cast<viua::types::Int_vector*>(value)
+        or dynamic_cast<viua::types::Float_vector*>(value)) {
+        return value;
+    }
+
+    auto const boxed = dynamic_cast<viua::types::Vector*>(value);
+    if (not boxed) {
+        throw make_unique<viua::types::Exception>(
+            "expected numeric vector, got: " + value->type());
+    }
+
+    auto ints       = vector<int64_t>{};
+    auto floats     = vector<double>{};
+    auto has_floats = false;
+    for (auto const& each : boxed->value()) {
+        if (auto const i = dynamic_cast<viua::types::Integer*>(each.get())) {
+            ints.push_back(i->as_integer());
+            floats.push_back(i->as_float());
+        } else if (auto const f =
+                       dynamic_cast<viua::types::Float*>(each.get())) {
+            has_floats = true;
+            floats.push_back(f->as_float());
+        } else {
+            throw make_unique<viua::types::Exception>(
+                "expected numeric vector element, got: " + each->type());
+        }
+    }
+
+    if (has_floats) {
+        holder = make_unique<viua::types::Float_vector>(std::move(floats));
+    } else {
+        holder = make_unique<viua::types::Int_vector>(std::move(ints));
+    }
+    return holder.get();
+}
+
+static auto box(int64_t const value) -> unique_ptr<viua::types::Value> {
+    return make_unique<viua::types::Integer>(value);
+}
+static auto box(double const value) -> unique_ptr<viua::types::Value> {
+    return make_unique<viua::types::Float>(value);
+}
+
+/*
+ * Calls fn with elements of the numeric vector given as i-th argument.
+ */
+template<typename Fn>
+static auto with_elements(Frame* frame,
+                          viua::internals::types::register_index const i,
+                          Fn fn) -> void {
+    auto holder = unique_ptr<viua::types::Value>{};
+    auto value  = unbox(frame->arguments->at(i), holder);
+    if (auto const ints = dynamic_cast<viua::types::Int_vector*>(value)) {
+        fn(ints->value());
+    } else {
+        fn(static_cast<viua::types::Float_vector*>(value)->value());
+    }
+}
+
+/*
+ * Calls fn with elements of the numeric vectors given as first and second
+ * argument.
+ * Both vectors must have the same type and length.
+ */
+template<typename Fn>
+static auto with_elements_of_both(Frame* frame, Fn fn) -> void {
+    auto rhs_holder = unique_ptr<viua::types::Value>{};
+    auto rhs        = unbox(frame->arguments->at(1), rhs_holder);
+
+    with_elements(frame, 0, [rhs, &fn](auto& lhs) -> void {
+        using element_type =
+            typename remove_reference_t<decltype(lhs)>::value_type;
+        using vector_type = viua::types::Unboxed_vector<element_type>;
+
+        auto const typed_rhs = dynamic_cast<vector_type*>(rhs);
+        if (not typed_rhs) {
+            throw make_unique<viua::types::Exception>(
+                "mismatched vector types: " + vector_type::type_name
+                + " and " + rhs->type());
+        }
+        if (lhs.size() != typed_rhs->value().size()) {
+            throw make_unique<viua::types::Exception>(
+                "mismatched vector lengths: " + to_string(lhs.size())
+                + " and " + to_string(typed_rhs->value().size()));
+        }
+        fn(lhs, typed_rhs->value());
+    });
+}
+
+
+template<Operation op>
+static auto numeric_arithmetic(Frame* frame,
+                               viua::kernel::RegisterSet*,
+                               viua::kernel::RegisterSet*,
+                               viua::process::Process*,
+                               viua::kernel::Kernel*) -> void {
+    with_elements_of_both(frame, [frame](auto const& lhs, auto const& rhs) {
+        using element_type =
+            typename remove_reference_t<decltype(lhs)>::value_type;
+
+        if constexpr (op == Operation::DIV
+                      and is_integral<element_type>::value) {
+            for (auto i = size_t{0}; i < rhs.size(); ++i) {
+                if (rhs[i] == 0) {
+                    throw make_unique<viua::types::Exception>(
+                        "division by zero");
+                }
+                if (rhs[i] == -1 and lhs[i] == INT64_MIN) {
+                    throw make_unique<viua::types::Exception>(
+                        "integer overflow in division");
+                }
+            }
+        }
+
+        auto result = vector<element_type>(lhs.size());
+        elementwise<op>(lhs.data(), rhs.data(), result.data(), lhs.size());
+        frame->local_register_set->set(
+            0,
+            make_unique<viua::types::Unboxed_vector<element_type>>(
+                std::move(result)));
+    });
+}
+
+template<Operation op>
+static auto numeric_compare(Frame* frame,
+                            viua::kernel::RegisterSet*,
+                            viua::kernel::RegisterSet*,
+                            viua::process::Process*,
+                            viua::kernel::Kernel*) -> void {
+    with_elements_of_both(frame, [frame](auto const& lhs, auto const& rhs) {
+        auto mask = vector<uint8_t>(lhs.size());
+        compare<op>(lhs.data(), rhs.data(), mask.data(), lhs.size());
+        frame->local_register_set->set(
+            0, make_unique<viua::types::Byte_vector>(std::move(mask)));
+    });
+}
+
+static auto numeric_dot(Frame* frame,
+                        viua::kernel::RegisterSet*,
+                        viua::kernel::RegisterSet*,
+                        viua::process::Process*,
+                        viua::kernel::Kernel*) -> void {
+    with_elements_of_both(frame, [frame](auto const& lhs, auto const& rhs) {
+        frame->local_register_set->set(
+            0, box(dot(lhs.data(), rhs.data(), lhs.size())));
+    });
+}
+
+static auto numeric_sum(Frame* frame,
+                        viua::kernel::RegisterSet*,
+                        viua::kernel::RegisterSet*,
+                        viua::process::Process*,
+                        viua::kernel::Kernel*) -> void {
+    with_elements(frame, 0, [frame](auto const& source) {
+        frame->local_register_set->set(
+            0, box(sum(source.data(), source.size())));
+    });
+}
+
+template<Operation op>
+static auto numeric_select(Frame* frame,
+                           viua::kernel::RegisterSet*,
+                           viua::kernel::RegisterSet*,
+                           viua::process::Process*,
+                           viua::kernel::Kernel*) -> void {
+    with_elements(frame, 0, [frame](auto const& source) {
+        if (source.empty()) {
+            throw make_unique<viua::types::Exception>(
+                "empty vector has no minimum or maximum");
+        }
+        frame->local_register_set->set(
+            0, box(select<op>(source.data(), source.size())));
+    });
+}
+
+static auto numeric_prefix_sum(Frame* frame,
+                               viua::kernel::RegisterSet*,
+                               viua::kernel::RegisterSet*,
+                               viua::process::Process*,
+                               viua::kernel::Kernel*) -> void {
+    with_elements(frame, 0, [frame](auto const& source) {
+        using element_type =
+            typename remove_reference_t<decltype(source)>::value_type;
+
+        auto result = vector<element_type>(source.size());
+        prefix_sum(source.data(), result.data(), source.size());
+        frame->local_register_set->set(
+            0,
+            make_unique<viua::types::Unboxed_vector<element_type>>(
+                std::move(result)));
+    });
+}
+
+const ForeignFunctionSpec functions[] = {
+    {"std::numeric::add/2", &numeric_arithmetic<Operation::ADD>},
+    {"std::numeric::sub/2", &numeric_arithmetic<Operation::SUB>},
+    {"std::numeric::mul/2", &numeric_arithmetic<Operation::MUL>},
+    {"std::numeric::div/2", &numeric_arithmetic<Operation::DIV>},
+    {"std::numeric::lt/2", &numeric_compare<Operation::LT>},
+    {"std::numeric::lte/2", &numeric_compare<Operation::LTE>},
+    {"std::numeric::gt/2", &numeric_compare<Operation::GT>},
+    {"std::numeric::gte/2", &numeric_compare<Operation::GTE>},
+    {"std::numeric::eq/2", &numeric_compare<Operation::EQ>},
+    {"std::numeric::dot/2", &numeric_dot},
+    {"std::numeric::sum/1", &numeric_sum},
+    {"std::numeric::min/1", &numeric_select<Operation::LT>},
+    {"std::numeric::max/1", &numeric_select<Operation::GT>},
+    {"std::numeric::prefix_sum/1", &numeric_prefix_sum},
+    {nullptr, nullptr},
+};
+
+extern "C" const ForeignFunctionSpec* exports() {
+    return functions;
+}
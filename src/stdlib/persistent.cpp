@@ -0,0 +1,218 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <string>
+#include <viua/include/module.h>
+#include <viua/kernel/frame.h>
+#include <viua/kernel/registerset.h>
+#include <viua/types/boolean.h>
+#include <viua/types/exception.h>
+#include <viua/types/integer.h>
+#include <viua/types/persistent.h>
+#include <viua/types/vector.h>
+using namespace std;
+
+
+/*
+ * Persistent vectors and maps.
+ *
+ * Every update returns a new version of the container, and leaves the one
+ * that was passed to the function unchanged.
+ */
+template<typename T>
+static auto expect(Frame* frame,
+                   viua::internals::types::register_index const i) -> T* {
+    auto const value = frame->arguments->at(i);
+    auto const typed = dynamic_cast<T*>(value);
+    if (not typed) {
+        throw make_unique<viua::types::Exception>(
+            "expected " + T::type_name + ", got: " + value->type());
+    }
+    return typed;
+}
+
+static auto expect_index(Frame* frame,
+                         viua::internals::types::register_index const i)
+    -> viua::types::Persistent_vector::size_type {
+    auto const index = expect<viua::types::Integer>(frame, i)->as_integer();
+    if (index < 0) {
+        throw make_unique<viua::types::Exception>(
+            "negative persistent vector index: " + to_string(index));
+    }
+    return static_cast<viua::types::Persistent_vector::size_type>(index);
+}
+
+static auto persistent_vector(Frame* frame,
+                              viua::kernel::RegisterSet*,
+                              viua::kernel::RegisterSet*,
+                              viua::process::Process*,
+                              viua::kernel::Kernel*) -> void {
+    frame->local_register_set->set(
+        0, make_unique<viua::types::Persistent_vector>());
+}
+
+static auto persistent_push(Frame* frame,
+                            viua::kernel::RegisterSet*,
+                            viua::kernel::RegisterSet*,
+                            viua::process::Process*,
+                            viua::kernel::Kernel*) -> void {
+    auto const pv = expect<viua::types::Persistent_vector>(frame, 0);
+    frame->local_register_set->set(0, pv->push(frame->arguments->pop(1)));
+}
+
+static auto persistent_pop(Frame* frame,
+                           viua::kernel::RegisterSet*,
+                           viua::kernel::RegisterSet*,
+                           viua::process::Process*,
+                           viua::kernel::Kernel*) -> void {
+    auto const pv = expect<viua::types::Persistent_vector>(frame, 0);
+    frame->local_register_set->set(0, pv->pop());
+}
+
+static auto persistent_at(Frame* frame,
+                          viua::kernel::RegisterSet*,
+                          viua::kernel::RegisterSet*,
+                          viua::process::Process*,
+                          viua::kernel::Kernel*) -> void {
+    auto const pv = expect<viua::types::Persistent_vector>(frame, 0);
+    frame->local_register_set->set(0, pv->at(expect_index(frame, 1)));
+}
+
+static auto persistent_set(Frame* frame,
+                           viua::kernel::RegisterSet*,
+                           viua::kernel::RegisterSet*,
+                           viua::process::Process*,
+                           viua::kernel::Kernel*) -> void {
+    auto const pv = expect<viua::types::Persistent_vector>(frame, 0);
+    frame->local_register_set->set(
+        0, pv->set(expect_index(frame, 1), frame->arguments->pop(2)));
+}
+
+static auto persistent_map(Frame* frame,
+                           viua::kernel::RegisterSet*,
+                           viua::kernel::RegisterSet*,
+                           viua::process::Process*,
+                           viua::kernel::Kernel*) -> void {
+    frame->local_register_set->set(
+        0, make_unique<viua::types::Persistent_map>());
+}
+
+static auto persistent_insert(Frame* frame,
+                              viua::kernel::RegisterSet*,
+                              viua::kernel::RegisterSet*,
+                              viua::process::Process*,
+                              viua::kernel::Kernel*) -> void {
+    auto const pm = expect<viua::types::Persistent_map>(frame, 0);
+    frame->local_register_set->set(
+        0, pm->insert(frame->arguments->pop(1), frame->arguments->pop(2)));
+}
+
+static auto persistent_remove(Frame* frame,
+                              viua::kernel::RegisterSet*,
+                              viua::kernel::RegisterSet*,
+                              viua::process::Process*,
+                              viua::kernel::Kernel*) -> void {
+    auto const pm = expect<viua::types::Persistent_map>(frame, 0);
+    frame->local_register_set->set(
+        0, pm->remove(*frame->arguments->at(1)));
+}
+
+static auto persistent_lookup(Frame* frame,
+                              viua::kernel::RegisterSet*,
+                              viua::kernel::RegisterSet*,
+                              viua::process::Process*,
+                              viua::kernel::Kernel*) -> void {
+    auto const pm  = expect<viua::types::Persistent_map>(frame, 0);
+    auto const key = frame->arguments->at(1);
+    auto value     = pm->at(*key);
+    if (not value) {
+        throw make_unique<viua::types::Exception>("key not found: "
+                                                  + key->repr());
+    }
+    frame->local_register_set->set(0, std::move(value));
+}
+
+static auto persistent_contains(Frame* frame,
+                                viua::kernel::RegisterSet*,
+                                viua::kernel::RegisterSet*,
+                                viua::process::Process*,
+                                viua::kernel::Kernel*) -> void {
+    auto const pm = expect<viua::types::Persistent_map>(frame, 0);
+    frame->local_register_set->set(
+        0,
+        make_unique<viua::types::Boolean>(
+            pm->contains(*frame->arguments->at(1))));
+}
+
+static auto persistent_keys(Frame* frame,
+                            viua::kernel::RegisterSet*,
+                            viua::kernel::RegisterSet*,
+                            viua::process::Process*,
+                            viua::kernel::Kernel*) -> void {
+    auto const pm = expect<viua::types::Persistent_map>(frame, 0);
+    auto keys     = make_unique<viua::types::Vector>();
+    for (auto& each : pm->keys()) {
+        keys->push(std::move(each));
+    }
+    frame->local_register_set->set(0, std::move(keys));
+}
+
+static auto persistent_size(Frame* frame,
+                            viua::kernel::RegisterSet*,
+                            viua::kernel::RegisterSet*,
+                            viua::process::Process*,
+                            viua::kernel::Kernel*) -> void {
+    auto const value = frame->arguments->at(0);
+    auto size        = uint64_t{0};
+    if (auto const pv = dynamic_cast<viua::types::Persistent_vector*>(value)) {
+        size = pv->size();
+    } else if (auto const pm =
+                   dynamic_cast<viua::types::Persistent_map*>(value)) {
+        size = pm->size();
+    } else {
+        throw make_unique<viua::types::Exception>(
+            "expected PersistentVector or PersistentMap, got: "
+            + value->type());
+    }
+    frame->local_register_set->set(
+        0,
+        make_unique<viua::types::Integer>(
+            static_cast<viua::types::Integer::underlying_type>(size)));
+}
+
+const ForeignFunctionSpec functions[] = {
+    {"std::persistent::vector/0", &persistent_vector},
+    {"std::persistent::push/2", &persistent_push},
+    {"std::persistent::pop/1", &persistent_pop},
+    {"std::persistent::at/2", &persistent_at},
+    {"std::persistent::set/3", &persistent_set},
+    {"std::persistent::map/0", &persistent_map},
+    {"std::persistent::insert/3", &persistent_insert},
+    {"std::persistent::remove/2", &persistent_remove},
+    {"std::persistent::lookup/2", &persistent_lookup},
+    {"std::persistent::contains/2", &persistent_contains},
+    {"std::persistent::keys/1", &persistent_keys},
+    {"std::persistent::size/1", &persistent_size},
+    {nullptr, nullptr},
+};
+
+extern "C" const ForeignFunctionSpec* exports() {
+    return functions;
+}
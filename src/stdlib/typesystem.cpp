@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 #include <viua/include/module.h>
+#include <viua/process.h>
 #include <viua/kernel/frame.h>
 #include <viua/kernel/registerset.h>
 #include <viua/types/exception.h>
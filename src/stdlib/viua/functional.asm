@@ -157,6 +157,297 @@
     return
 .end
 
+; Parallel variants of filter(), map(), and reduce().
+;
+; Given vector is split into (at most) 8 chunks and every chunk is moved to a worker process;
+; the kernel hands worker processes over to schedulers that are not busy so the chunks are processed
+; in parallel.
+; Results are reassembled in the order of elements of the original vector.
+;
+; Elements are moved (not copied) between the vector, chunks, and worker processes.
+; Vectors are only ever popped from the back so every chunk is reversed once when it is cut off
+; the vector, and once by the worker.
+.function: std::functional::__pchunks/1
+    ; splits a vector into (at most) 8 chunks
+    ; returns a vector of chunks with the first chunk at the end, and elements of every chunk in
+    ; reverse order
+    arg (.name: %iota list) %0
+
+    vector (.name: %iota chunks)
+    izero (.name: %iota zero)
+
+    ; chunk_size = ceil(length / 8)
+    vlen (.name: %iota remaining) %list
+    integer (.name: %iota chunk_size) 7
+    add %chunk_size %chunk_size %remaining
+    integer (.name: %iota max_chunks) 8
+    div %chunk_size %chunk_size %max_chunks
+
+    .mark: next_chunk
+    vlen %remaining %list
+    lte (.name: %iota done) %remaining %zero
+    if %done chunks_ready +1
+
+    vector (.name: %iota chunk)
+    izero (.name: %iota taken)
+
+    .mark: next_element
+    vlen %remaining %list
+    lte %done %remaining %zero
+    if %done chunk_ready +1
+    gte %done %taken %chunk_size
+    if %done chunk_ready +1
+
+    vpop (.name: %iota element) %list
+    vpush %chunk %element
+    iinc %taken
+    jump next_element
+
+    .mark: chunk_ready
+    vpush %chunks %chunk
+    jump next_chunk
+
+    .mark: chunks_ready
+    move %0 %chunks
+    return
+.end
+
+.function: std::functional::__preverse/1
+    ; reverses a vector by moving its elements
+    arg (.name: %iota list) %0
+
+    vector (.name: %iota reversed)
+    izero (.name: %iota zero)
+
+    .mark: loop_begin
+    vlen (.name: %iota remaining) %list
+    lte (.name: %iota done) %remaining %zero
+    if %done loop_end +1
+
+    vpop (.name: %iota element) %list
+    vpush %reversed %element
+    jump loop_begin
+
+    .mark: loop_end
+    move %0 %reversed
+    return
+.end
+
+.function: std::functional::__pcollect/1
+    ; joins worker processes and concatenates the (reversed) vectors they returned
+    arg (.name: %iota workers) %0
+
+    vector (.name: %iota collected)
+    izero (.name: %iota zero)
+
+    .mark: next_worker
+    vlen (.name: %iota remaining) %workers
+    lte (.name: %iota done) %remaining %zero
+    if %done workers_joined +1
+
+    vpop (.name: %iota pid) %workers
+    join (.name: %iota results) %pid
+
+    .mark: next_result
+    vlen %remaining %results
+    lte %done %remaining %zero
+    if %done next_worker +1
+
+    vpop (.name: %iota element) %results
+    vpush %collected %element
+    jump next_result
+
+    .mark: workers_joined
+    move %0 %collected
+    return
+.end
+
+.function: std::functional::__pfilter_worker/2
+    arg (.name: %iota callback) %0
+    arg (.name: %iota chunk) %1
+
+    vector (.name: %iota filtered)
+    izero (.name: %iota zero)
+
+    .mark: loop_begin
+    vlen (.name: %iota remaining) %chunk
+    lte (.name: %iota done) %remaining %zero
+    if %done loop_end +1
+
+    vpop (.name: %iota element) %chunk
+    frame ^[(param %0 %element)]
+    call (.name: %iota keep) %callback
+    if %keep +1 loop_begin
+    vpush %filtered %element
+    jump loop_begin
+
+    .mark: loop_end
+    frame ^[(pamv %0 %filtered)]
+    call %0 std::functional::__preverse/1
+    return
+.end
+
+.function: std::functional::pfilter/2
+    ; parallel filter(), see std::functional::filter/2
+    arg (.name: %iota callback) %0
+    arg (.name: %iota list) %1
+
+    frame ^[(pamv %0 %list)]
+    call (.name: %iota chunks) std::functional::__pchunks/1
+
+    ; spawn a worker for every chunk, starting with the first one
+    vector (.name: %iota workers)
+    izero (.name: %iota zero)
+
+    .mark: next_chunk
+    vlen (.name: %iota remaining) %chunks
+    lte (.name: %iota done) %remaining %zero
+    if %done workers_spawned +1
+
+    vpop (.name: %iota chunk) %chunks
+    frame ^[(param %0 %callback) (pamv %1 %chunk)]
+    process (.name: %iota pid) std::functional::__pfilter_worker/2
+    vpush %workers %pid
+    jump next_chunk
+
+    .mark: workers_spawned
+    frame ^[(pamv %0 %workers)]
+    call %workers std::functional::__preverse/1
+
+    frame ^[(pamv %0 %workers)]
+    call %0 std::functional::__pcollect/1
+    return
+.end
+
+.function: std::functional::__pmap_worker/2
+    arg (.name: %iota callback) %0
+    arg (.name: %iota chunk) %1
+
+    vector (.name: %iota mapped)
+    izero (.name: %iota zero)
+
+    .mark: loop_begin
+    vlen (.name: %iota remaining) %chunk
+    lte (.name: %iota done) %remaining %zero
+    if %done loop_end +1
+
+    vpop (.name: %iota element) %chunk
+    frame ^[(pamv %0 %element)]
+    call (.name: %iota result) %callback
+    vpush %mapped %result
+    jump loop_begin
+
+    .mark: loop_end
+    frame ^[(pamv %0 %mapped)]
+    call %0 std::functional::__preverse/1
+    return
+.end
+
+.function: std::functional::pmap/2
+    ; parallel map(), see std::functional::map/2
+    arg (.name: %iota callback) %0
+    arg (.name: %iota list) %1
+
+    frame ^[(pamv %0 %list)]
+    call (.name: %iota chunks) std::functional::__pchunks/1
+
+    ; spawn a worker for every chunk, starting with the first one
+    vector (.name: %iota workers)
+    izero (.name: %iota zero)
+
+    .mark: next_chunk
+    vlen (.name: %iota remaining) %chunks
+    lte (.name: %iota done) %remaining %zero
+    if %done workers_spawned +1
+
+    vpop (.name: %iota chunk) %chunks
+    frame ^[(param %0 %callback) (pamv %1 %chunk)]
+    process (.name: %iota pid) std::functional::__pmap_worker/2
+    vpush %workers %pid
+    jump next_chunk
+
+    .mark: workers_spawned
+    frame ^[(pamv %0 %workers)]
+    call %workers std::functional::__preverse/1
+
+    frame ^[(pamv %0 %workers)]
+    call %0 std::functional::__pcollect/1
+    return
+.end
+
+.function: std::functional::__preduce_worker/2
+    arg (.name: %iota callback) %0
+    arg (.name: %iota chunk) %1
+
+    ; chunks are never empty so the first element is the initial value of the accumulator
+    vpop (.name: %iota accumulator) %chunk
+    izero (.name: %iota zero)
+
+    .mark: loop_begin
+    vlen (.name: %iota remaining) %chunk
+    lte (.name: %iota done) %remaining %zero
+    if %done loop_end +1
+
+    vpop (.name: %iota element) %chunk
+    frame ^[(pamv %0 %accumulator) (pamv %1 %element)]
+    call %accumulator %callback
+    jump loop_begin
+
+    .mark: loop_end
+    move %0 %accumulator
+    return
+.end
+
+.function: std::functional::preduce/3
+    ; parallel reduce()
+    ; this function takes three arguments:
+    ;   * a function taking an accumulator and an element, and returning the new accumulator,
+    ;   * an initial value of the accumulator,
+    ;   * a vector,
+    ; every chunk is reduced separately and partial results are then reduced in order, starting
+    ; with the initial value, so the function must be associative
+    arg (.name: %iota callback) %0
+    arg (.name: %iota accumulator) %1
+    arg (.name: %iota list) %2
+
+    frame ^[(pamv %0 %list)]
+    call (.name: %iota chunks) std::functional::__pchunks/1
+
+    ; spawn a worker for every chunk, starting with the first one
+    vector (.name: %iota workers)
+    izero (.name: %iota zero)
+
+    .mark: next_chunk
+    vlen (.name: %iota remaining) %chunks
+    lte (.name: %iota done) %remaining %zero
+    if %done workers_spawned +1
+
+    vpop (.name: %iota chunk) %chunks
+    frame ^[(param %0 %callback) (pamv %1 %chunk)]
+    process (.name: %iota pid) std::functional::__preduce_worker/2
+    vpush %workers %pid
+    jump next_chunk
+
+    .mark: workers_spawned
+    frame ^[(pamv %0 %workers)]
+    call %workers std::functional::__preverse/1
+
+    .mark: next_worker
+    vlen %remaining %workers
+    lte %done %remaining %zero
+    if %done workers_joined +1
+
+    vpop %pid %workers
+    join (.name: %iota partial) %pid
+    frame ^[(pamv %0 %accumulator) (pamv %1 %partial)]
+    call %accumulator %callback
+    jump next_worker
+
+    .mark: workers_joined
+    move %0 %accumulator
+    return
+.end
+
 .block: std::functional::apply::__try_calling
     ; FIXME refactor this to use ^[] syntax
     frame %1
@@ -41,6 +41,32 @@
     return
 .end
 
+.function: std::vector::of_unboxed_ints/1
+    ; Returns a typed vector of integers from 0 to N-1.
+    ;
+    ; N is received as first and only parameter.
+    ; Elements of the vector are stored unboxed so "vat" produces copies of
+    ; them instead of pointers.
+    ;
+    .name: 1 limit
+    arg %limit %0
+
+    .name: 0 vec
+    vectorof %vec 'int'
+
+    .name: 3 counter
+    .name: 4 to_push
+    izero %counter
+
+    .mark: begin_loop
+    vpush %vec (copy %to_push %counter)
+    iinc %counter
+    ; reuse 'to_push' register since it's empty
+    if (gte %to_push %counter %limit) +1 begin_loop
+
+    return
+.end
+
 .function: std::vector::of/2
     ; Returns a vector of N objects created by supplied function.
     ;
@@ -20,6 +20,7 @@
 #include <sstream>
 #include <string>
 #include <viua/types/closure.h>
+#include <viua/types/reference.h>
 #include <viua/types/value.h>
 using namespace std;
 
@@ -30,6 +31,10 @@ viua::types::Closure::Closure(const string& name,
                               unique_ptr<viua::kernel::RegisterSet> rs)
         : local_register_set(std::move(rs)), function_name(name) {}
 
+viua::types::Closure::Closure(string const& name,
+                              shared_ptr<viua::kernel::RegisterSet> rs)
+        : local_register_set(std::move(rs)), function_name(name) {}
+
 viua::types::Closure::~Closure() {}
 
 
@@ -52,7 +57,12 @@ bool viua::types::Closure::boolean() const {
 }
 
 unique_ptr<viua::types::Value> viua::types::Closure::copy() const {
-    return make_unique<Closure>(function_name, local_register_set->copy());
+    return unique_ptr<Closure>{new Closure{function_name, local_register_set}};
+}
+
+auto viua::types::Closure::reaches(Value const* value) const -> bool {
+    return (Value::reaches(value)
+            or (local_register_set and local_register_set->reaches(value)));
 }
 
 
@@ -60,23 +70,61 @@ string viua::types::Closure::name() const {
     return function_name;
 }
 
-viua::kernel::RegisterSet* viua::types::Closure::rs() const {
-    return local_register_set.get();
+auto viua::types::Closure::unshare() -> void {
+    if (local_register_set.use_count() > 1) {
+        local_register_set = local_register_set->copy();
+    }
 }
 
-auto viua::types::Closure::release() -> viua::kernel::RegisterSet* {
-    return local_register_set.release();
+viua::kernel::RegisterSet* viua::types::Closure::rs() {
+    unshare();
+    return local_register_set.get();
 }
 
 auto viua::types::Closure::give() -> unique_ptr<viua::kernel::RegisterSet> {
-    return std::move(local_register_set);
+    if (local_register_set.use_count() > 1) {
+        auto rs = local_register_set->copy();
+        local_register_set.reset();
+        return rs;
+    }
+
+    auto rs = make_unique<viua::kernel::RegisterSet>(local_register_set->size());
+    for (auto i = decltype(rs->size()){0}; i < rs->size(); ++i) {
+        rs->register_at(i)->swap(*local_register_set->register_at(i));
+    }
+    local_register_set.reset();
+    return rs;
 }
 
 auto viua::types::Closure::empty() const -> bool {
     return (local_register_set == nullptr);
 }
 
+auto viua::types::Closure::isolate() -> void {
+    if (empty()) {
+        return;
+    }
+
+    unshare();
+    for (auto i = decltype(local_register_set->size()){0};
+         i < local_register_set->size();
+         ++i) {
+        auto const each = local_register_set->register_at(i);
+        if (each->empty()) {
+            continue;
+        }
+        if (each->is_flagged(REFERENCE)) {
+            auto value = static_cast<Reference*>(each->get())->take();
+            each->unflag(REFERENCE);
+            each->reset(std::move(value));
+        }
+        if (auto const closure = dynamic_cast<Closure*>(each->get())) {
+            closure->isolate();
+        }
+    }
+}
+
 void viua::types::Closure::set(viua::internals::types::register_index index,
                                unique_ptr<viua::types::Value> object) {
-    local_register_set->set(index, std::move(object));
+    rs()->set(index, std::move(object));
 }
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <string>
+#include <viua/types/coroutine.h>
+#include <viua/types/exception.h>
+using namespace std;
+
+const string viua::types::Coroutine::type_name = "Coroutine";
+
+string viua::types::Coroutine::type() const {
+    return "Coroutine";
+}
+
+string viua::types::Coroutine::str() const {
+    return ("Coroutine: " + coroutine_stack->entry_function);
+}
+
+string viua::types::Coroutine::repr() const {
+    return str();
+}
+
+bool viua::types::Coroutine::boolean() const {
+    return (not finished());
+}
+
+unique_ptr<viua::types::Value> viua::types::Coroutine::copy() const {
+    throw make_unique<viua::types::Exception>("coroutines cannot be copied");
+}
+
+auto viua::types::Coroutine::reaches(Value const* value) const -> bool {
+    return (Value::reaches(value) or coroutine_stack->reaches(value));
+}
+
+auto viua::types::Coroutine::finished() const -> bool {
+    return (coroutine_stack->size() == 0);
+}
+
+auto viua::types::Coroutine::stack() const -> viua::process::Stack* {
+    return coroutine_stack.get();
+}
+
+viua::types::Coroutine::Coroutine(unique_ptr<viua::process::Stack> s)
+        : coroutine_stack(std::move(s)) {}
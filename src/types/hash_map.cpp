@@ -0,0 +1,453 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <typeinfo>
+#include <viua/types/atom.h>
+#include <viua/types/bits.h>
+#include <viua/types/exception.h>
+#include <viua/types/float.h>
+#include <viua/types/hash_map.h>
+#include <viua/types/integer.h>
+#include <viua/types/string.h>
+#include <viua/types/text.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+using namespace std;
+using viua::types::Hash_map;
+
+
+/*
+ * Control bytes of slots which do not hold a key have their highest bit set.
+ * Control bytes of full slots hold the lowest 7 bits of the hash of the key,
+ * while the remaining bits choose the group at which probing starts.
+ */
+static Hash_map::control_type const EMPTY   = -128;
+static Hash_map::control_type const DELETED = -2;
+
+static Hash_map::size_type const GROUP_WIDTH = 16;
+
+static auto control_of(uint64_t const hash) -> Hash_map::control_type {
+    return static_cast<Hash_map::control_type>(hash & 0x7f);
+}
+
+namespace {
+/*
+ * Bit N of a mask is set when N-th slot of a group matches.
+ */
+using mask_of_slots = uint32_t;
+
+#if defined(__SSE2__)
+class Group {
+    __m128i control;
+
+  public:
+    auto match(Hash_map::control_type const c) const -> mask_of_slots {
+        return static_cast<mask_of_slots>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(c)), control)));
+    }
+    auto match_empty() const -> mask_of_slots {
+        return match(EMPTY);
+    }
+    auto match_empty_or_deleted() const -> mask_of_slots {
+        return static_cast<mask_of_slots>(_mm_movemask_epi8(control));
+    }
+
+    Group(Hash_map::control_type const* c)
+            : control(_mm_loadu_si128(reinterpret_cast<__m128i const*>(c))) {}
+};
+#else
+class Group {
+    Hash_map::control_type const* control;
+
+  public:
+    auto match(Hash_map::control_type const c) const -> mask_of_slots {
+        auto mask = mask_of_slots{0};
+        for (auto i = Hash_map::size_type{0}; i < GROUP_WIDTH; ++i) {
+            mask |= (mask_of_slots{control[i] == c} << i);
+        }
+        return mask;
+    }
+    auto match_empty() const -> mask_of_slots {
+        return match(EMPTY);
+    }
+    auto match_empty_or_deleted() const -> mask_of_slots {
+        auto mask = mask_of_slots{0};
+        for (auto i = Hash_map::size_type{0}; i < GROUP_WIDTH; ++i) {
+            mask |= (mask_of_slots{control[i] < 0} << i);
+        }
+        return mask;
+    }
+
+    Group(Hash_map::control_type const* c) : control(c) {}
+};
+#endif
+
+auto lowest_slot(mask_of_slots const mask) -> Hash_map::size_type {
+    return static_cast<Hash_map::size_type>(__builtin_ctz(mask));
+}
+
+/*
+ * Triangular probing over groups visits every group exactly once when the
+ * number of groups is a power of two.
+ */
+class Probe {
+    Hash_map::size_type const groups;
+    Hash_map::size_type group;
+    Hash_map::size_type step = 0;
+
+  public:
+    auto offset() const -> Hash_map::size_type {
+        return (group * GROUP_WIDTH);
+    }
+    auto next() -> bool {
+        if (++step == groups) {
+            return false;
+        }
+        group = ((group + step) & (groups - 1));
+        return true;
+    }
+
+    Probe(uint64_t const hash, Hash_map::size_type const capacity)
+            : groups(capacity / GROUP_WIDTH)
+            , group((hash >> 7) & (groups - 1)) {}
+};
+
+auto mix(uint64_t h) -> uint64_t {
+    h ^= (h >> 30);
+    h *= 0xbf58476d1ce4e5b9;
+    h ^= (h >> 27);
+    h *= 0x94d049bb133111eb;
+    h ^= (h >> 31);
+    return h;
+}
+}  // namespace
+
+
+const string Hash_map::type_name = "HashMap";
+
+string Hash_map::type() const {
+    return "HashMap";
+}
+
+string Hash_map::str() const {
+    ostringstream oss;
+
+    oss << '{';
+
+    auto i = used;
+    for (auto slot = size_type{0}; slot < capacity(); ++slot) {
+        if (control[slot] < 0) {
+            continue;
+        }
+        oss << slot_keys[slot]->repr() << ": " << slot_values[slot]->repr();
+        if (--i) {
+            oss << ", ";
+        }
+    }
+
+    oss << '}';
+
+    return oss.str();
+}
+
+string Hash_map::repr() const {
+    return str();
+}
+
+bool Hash_map::boolean() const {
+    return (used != 0);
+}
+
+vector<string> Hash_map::bases() const {
+    return vector<string>{"Value"};
+}
+vector<string> Hash_map::inheritancechain() const {
+    return vector<string>{"Value"};
+}
+
+auto Hash_map::hash_of(Value const& key) -> uint64_t {
+    auto const& type = typeid(key);
+    if (type == typeid(Integer)) {
+        return mix(static_cast<uint64_t>(
+            static_cast<Integer const&>(key).as_integer()));
+    }
+    if (type == typeid(Float)) {
+        auto value = static_cast<Float const&>(key).as_float();
+        if (isnan(value)) {
+            throw make_unique<Exception>("NaN cannot be used as a key");
+        }
+        if (value == 0.0) {
+            /*
+             * Make positive and negative zero (which are equal) hash to the
+             * same value.
+             */
+            value = 0.0;
+        }
+        auto bits = uint64_t{0};
+        memcpy(&bits, &value, sizeof(bits));
+        return mix(bits ^ 0x1);
+    }
+    if (type == typeid(Atom)) {
+        return mix(hash<string>{}(static_cast<Atom const&>(key)) ^ 0x2);
+    }
+    if (type == typeid(String)) {
+        return mix(hash<string>{}(static_cast<String const&>(key).value())
+                   ^ 0x3);
+    }
+    if (type == typeid(Text)) {
+        return mix(hash<string>{}(key.str()) ^ 0x4);
+    }
+    if (type == typeid(Bits)) {
+        auto const& bits = static_cast<Bits const&>(key);
+        auto h           = mix(bits.size() ^ 0x5);
+        auto chunk       = uint64_t{0};
+        for (auto i = Bits::size_type{0}; i < bits.size(); ++i) {
+            chunk = ((chunk << 1) | uint64_t{bits.at(i)});
+            if ((i % 64) == 63) {
+                h     = mix(h ^ chunk);
+                chunk = 0;
+            }
+        }
+        return mix(h ^ chunk);
+    }
+    throw make_unique<Exception>("unhashable type: " + key.type());
+}
+
+auto Hash_map::equal(Value const& lhs, Value const& rhs) -> bool {
+    auto const& type = typeid(lhs);
+    if (type != typeid(rhs)) {
+        return false;
+    }
+    if (type == typeid(Integer)) {
+        return (static_cast<Integer const&>(lhs).as_integer()
+                == static_cast<Integer const&>(rhs).as_integer());
+    }
+    if (type == typeid(Float)) {
+        return (static_cast<Float const&>(lhs).as_float()
+                == static_cast<Float const&>(rhs).as_float());
+    }
+    if (type == typeid(Atom)) {
+        return (static_cast<Atom const&>(lhs) == static_cast<Atom const&>(rhs));
+    }
+    if (type == typeid(String)) {
+        return (static_cast<String const&>(lhs).value()
+                == static_cast<String const&>(rhs).value());
+    }
+    if (type == typeid(Text)) {
+        return (static_cast<Text const&>(lhs) == static_cast<Text const&>(rhs));
+    }
+    if (type == typeid(Bits)) {
+        return (static_cast<Bits const&>(lhs) == static_cast<Bits const&>(rhs));
+    }
+    return false;
+}
+
+auto Hash_map::capacity() const -> size_type {
+    return control.size();
+}
+
+/*
+ * Returns index of the slot holding the key, or capacity of the map if the
+ * key is not present.
+ */
+auto Hash_map::find(Value const& key, uint64_t const hash) const -> size_type {
+    if (used == 0) {
+        return capacity();
+    }
+
+    auto probe = Probe{hash, capacity()};
+    do {
+        auto const group = Group{control.data() + probe.offset()};
+        for (auto candidates = group.match(control_of(hash)); candidates;
+             candidates &= (candidates - 1)) {
+            auto const slot = (probe.offset() + lowest_slot(candidates));
+            if (equal(*slot_keys[slot], key)) {
+                return slot;
+            }
+        }
+
+        /*
+         * Insertion would have put the key into this group if it had any
+         * empty slots so there is no need to look further.
+         */
+        if (group.match_empty()) {
+            break;
+        }
+    } while (probe.next());
+
+    return capacity();
+}
+
+auto Hash_map::free_slot(uint64_t const hash) const -> size_type {
+    auto probe = Probe{hash, capacity()};
+    do {
+        auto const group =
+            Group{control.data() + probe.offset()}.match_empty_or_deleted();
+        if (group) {
+            return (probe.offset() + lowest_slot(group));
+        }
+    } while (probe.next());
+
+    /*
+     * The map is rehashed before it fills up so this is never reached.
+     */
+    return capacity();
+}
+
+auto Hash_map::rehash(size_type const new_capacity) -> void {
+    auto old_control = std::move(control);
+    auto old_keys    = std::move(slot_keys);
+    auto old_values  = std::move(slot_values);
+
+    control     = vector<control_type>(new_capacity, EMPTY);
+    slot_keys   = vector<unique_ptr<Value>>(new_capacity);
+    slot_values = vector<unique_ptr<Value>>(new_capacity);
+    tombstones  = 0;
+
+    for (auto i = size_type{0}; i < old_control.size(); ++i) {
+        if (old_control[i] < 0) {
+            continue;
+        }
+        auto const slot = free_slot(hash_of(*old_keys[i]));
+        control[slot]     = old_control[i];
+        slot_keys[slot]   = std::move(old_keys[i]);
+        slot_values[slot] = std::move(old_values[i]);
+    }
+}
+
+auto Hash_map::insert(unique_ptr<Value> key, unique_ptr<Value> value)
+    -> void {
+    auto const hash = hash_of(*key);
+
+    auto slot = find(*key, hash);
+    if (slot != capacity()) {
+        slot_values[slot] = std::move(value);
+        return;
+    }
+
+    /*
+     * Keep at least one eighth of slots empty so that probing for keys that
+     * are not present stops early.
+     * Rehashing without growing is enough when most of the slots that are
+     * not empty are tombstones.
+     */
+    if ((used + tombstones + 1) > (capacity() - (capacity() / 8))) {
+        auto new_capacity = max(capacity(), GROUP_WIDTH);
+        while ((used + 1) > (new_capacity / 2)) {
+            new_capacity *= 2;
+        }
+        rehash(new_capacity);
+    }
+
+    slot = free_slot(hash);
+    if (control[slot] == DELETED) {
+        --tombstones;
+    }
+    control[slot]     = control_of(hash);
+    slot_keys[slot]   = std::move(key);
+    slot_values[slot] = std::move(value);
+    ++used;
+}
+
+auto Hash_map::remove(Value const& key) -> unique_ptr<Value> {
+    auto const slot = find(key, hash_of(key));
+    if (slot == capacity()) {
+        throw make_unique<Exception>("key not found: " + key.repr());
+    }
+
+    auto value = std::move(slot_values[slot]);
+    slot_keys[slot].reset();
+    --used;
+
+    /*
+     * If the group of the slot has an empty slot no probe ever went past
+     * it, so the slot may become empty again instead of becoming a
+     * tombstone.
+     */
+    auto const group_offset = ((slot / GROUP_WIDTH) * GROUP_WIDTH);
+    if (Group{control.data() + group_offset}.match_empty()) {
+        control[slot] = EMPTY;
+    } else {
+        control[slot] = DELETED;
+        ++tombstones;
+    }
+
+    return value;
+}
+
+auto Hash_map::at(Value const& key) const -> Value* {
+    auto const slot = find(key, hash_of(key));
+    return (slot == capacity() ? nullptr : slot_values[slot].get());
+}
+
+auto Hash_map::contains(Value const& key) const -> bool {
+    return (find(key, hash_of(key)) != capacity());
+}
+
+auto Hash_map::keys() const -> vector<unique_ptr<Value>> {
+    auto ks = vector<unique_ptr<Value>>{};
+    ks.reserve(used);
+    for (auto slot = size_type{0}; slot < capacity(); ++slot) {
+        if (control[slot] >= 0) {
+            ks.push_back(slot_keys[slot]->copy());
+        }
+    }
+    return ks;
+}
+
+auto Hash_map::size() const -> size_type {
+    return used;
+}
+
+unique_ptr<viua::types::Value> Hash_map::copy() const {
+    /*
+     * Copies have the same layout as the original so there is no need to
+     * hash the keys again.
+     */
+    auto copied         = make_unique<Hash_map>();
+    copied->control     = control;
+    copied->slot_keys   = vector<unique_ptr<Value>>(capacity());
+    copied->slot_values = vector<unique_ptr<Value>>(capacity());
+    for (auto slot = size_type{0}; slot < capacity(); ++slot) {
+        if (control[slot] >= 0) {
+            copied->slot_keys[slot]   = slot_keys[slot]->copy();
+            copied->slot_values[slot] = slot_values[slot]->copy();
+        }
+    }
+    copied->used       = used;
+    copied->tombstones = tombstones;
+    return copied;
+}
+
+auto Hash_map::reaches(Value const* value) const -> bool {
+    if (Value::reaches(value)) {
+        return true;
+    }
+    for (auto const& each : slot_values) {
+        if (each and each->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
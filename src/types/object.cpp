@@ -61,6 +61,18 @@ unique_ptr<viua::types::Value> viua::types::Object::copy() const {
     return std::move(cp);
 }
 
+auto viua::types::Object::reaches(Value const* value) const -> bool {
+    if (Value::reaches(value)) {
+        return true;
+    }
+    for (auto const& each : attributes) {
+        if (each.second->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void viua::types::Object::set(const string& name,
                               unique_ptr<viua::types::Value> object) {
     attributes[name] = std::move(object);
@@ -0,0 +1,618 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <viua/exceptions.h>
+#include <viua/types/atom.h>
+#include <viua/types/bits.h>
+#include <viua/types/boolean.h>
+#include <viua/types/exception.h>
+#include <viua/types/float.h>
+#include <viua/types/hash_map.h>
+#include <viua/types/integer.h>
+#include <viua/types/persistent.h>
+#include <viua/types/string.h>
+#include <viua/types/text.h>
+#include <viua/util/exceptions.h>
+using namespace std;
+using viua::types::Persistent_map;
+using viua::types::Persistent_vector;
+using viua::types::Value;
+using viua::util::exceptions::make_unique_exception;
+
+
+auto viua::types::persistent::share(unique_ptr<Value> value)
+    -> shared_ptr<Value const> {
+    auto const& type = typeid(*value);
+    if (type == typeid(String)) {
+        /*
+         * Strings build their contiguous buffer lazily (which modifies them)
+         * so it must be built before the string is shared.
+         */
+        static_cast<String const&>(*value).value();
+    } else if (not(type == typeid(Integer) or type == typeid(Float)
+                   or type == typeid(Boolean) or type == typeid(Atom)
+                   or type == typeid(Text) or type == typeid(Bits)
+                   or type == typeid(Persistent_vector)
+                   or type == typeid(Persistent_map))) {
+        throw make_unique<Exception>(
+            "value of type " + value->type()
+            + " cannot be stored in a persistent container");
+    }
+    return shared_ptr<Value const>{std::move(value)};
+}
+
+
+/*
+ * Internal nodes have only children, and leaves have only elements.
+ */
+struct Persistent_vector::Node {
+    vector<shared_ptr<Node const>> children;
+    vector<shared_ptr<Value const>> elements;
+};
+
+static auto const VECTOR_BITS = 5u;
+static auto const VECTOR_WIDTH =
+    (Persistent_vector::size_type{1} << VECTOR_BITS);
+static auto const VECTOR_MASK = (VECTOR_WIDTH - 1);
+
+using Vector_node = Persistent_vector::Node;
+
+/*
+ * Returns a chain of nodes leading to the given node from the given level.
+ */
+static auto new_path(unsigned const level, shared_ptr<Vector_node const> node)
+    -> shared_ptr<Vector_node const> {
+    if (level == 0) {
+        return node;
+    }
+    auto parent = make_shared<Vector_node>();
+    parent->children.push_back(new_path((level - VECTOR_BITS), std::move(node)));
+    return parent;
+}
+
+static auto push_tail(Persistent_vector::size_type const count,
+                      unsigned const level,
+                      Vector_node const& parent,
+                      shared_ptr<Vector_node const> tail)
+    -> shared_ptr<Vector_node const> {
+    auto node        = make_shared<Vector_node>(parent);
+    auto const index = (((count - 1) >> level) & VECTOR_MASK);
+    if (level == VECTOR_BITS) {
+        node->children.push_back(std::move(tail));
+    } else if (index < parent.children.size()) {
+        node->children[index] = push_tail(
+            count, (level - VECTOR_BITS), *parent.children[index], std::move(tail));
+    } else {
+        node->children.push_back(new_path((level - VECTOR_BITS), std::move(tail)));
+    }
+    return node;
+}
+
+/*
+ * Returns null if the node would become empty.
+ */
+static auto pop_tail(Persistent_vector::size_type const count,
+                     unsigned const level,
+                     Vector_node const& node) -> shared_ptr<Vector_node const> {
+    auto const index = (((count - 2) >> level) & VECTOR_MASK);
+    if (level > VECTOR_BITS) {
+        auto child = pop_tail(count, (level - VECTOR_BITS), *node.children[index]);
+        if ((not child) and index == 0) {
+            return nullptr;
+        }
+        auto copied = make_shared<Vector_node>(node);
+        if (child) {
+            copied->children[index] = std::move(child);
+        } else {
+            copied->children.pop_back();
+        }
+        return copied;
+    }
+    if (index == 0) {
+        return nullptr;
+    }
+    auto copied = make_shared<Vector_node>(node);
+    copied->children.pop_back();
+    return copied;
+}
+
+static auto assoc(unsigned const level,
+                  Vector_node const& node,
+                  Persistent_vector::size_type const i,
+                  shared_ptr<Value const> element)
+    -> shared_ptr<Vector_node const> {
+    auto copied = make_shared<Vector_node>(node);
+    if (level == 0) {
+        copied->elements[i & VECTOR_MASK] = std::move(element);
+    } else {
+        auto const index         = ((i >> level) & VECTOR_MASK);
+        copied->children[index] = assoc(
+            (level - VECTOR_BITS), *node.children[index], i, std::move(element));
+    }
+    return copied;
+}
+
+const string Persistent_vector::type_name = "PersistentVector";
+
+string Persistent_vector::type() const {
+    return "PersistentVector";
+}
+
+string Persistent_vector::str() const {
+    ostringstream oss;
+    oss << '[';
+    for (auto i = size_type{0}; i < count; ++i) {
+        if (i) {
+            oss << ", ";
+        }
+        oss << leaf_for(i)->elements[i & VECTOR_MASK]->repr();
+    }
+    oss << ']';
+    return oss.str();
+}
+
+string Persistent_vector::repr() const {
+    return str();
+}
+
+bool Persistent_vector::boolean() const {
+    return (count != 0);
+}
+
+vector<string> Persistent_vector::bases() const {
+    return vector<string>{"Value"};
+}
+vector<string> Persistent_vector::inheritancechain() const {
+    return vector<string>{"Value"};
+}
+
+auto Persistent_vector::tail_offset() const -> size_type {
+    return (count < VECTOR_WIDTH ? 0
+                                 : (((count - 1) >> VECTOR_BITS) << VECTOR_BITS));
+}
+
+auto Persistent_vector::leaf_for(size_type const i) const
+    -> shared_ptr<Node const> const& {
+    if (i >= tail_offset()) {
+        return tail;
+    }
+    auto node = &root;
+    for (auto level = shift; level > 0; level -= VECTOR_BITS) {
+        node = &(*node)->children[((i >> level) & VECTOR_MASK)];
+    }
+    return *node;
+}
+
+auto Persistent_vector::size() const -> size_type {
+    return count;
+}
+
+auto Persistent_vector::at(size_type const i) const -> unique_ptr<Value> {
+    if (i >= count) {
+        throw make_unique_exception<OutOfRangeException>(
+            "persistent vector index out of range: index = " + to_string(i)
+            + ", size = " + to_string(count));
+    }
+    return leaf_for(i)->elements[i & VECTOR_MASK]->copy();
+}
+
+auto Persistent_vector::set(size_type const i, unique_ptr<Value> value) const
+    -> unique_ptr<Persistent_vector> {
+    if (i >= count) {
+        throw make_unique_exception<OutOfRangeException>(
+            "persistent vector index out of range: index = " + to_string(i)
+            + ", size = " + to_string(count));
+    }
+
+    auto element = persistent::share(std::move(value));
+
+    auto updated   = make_unique<Persistent_vector>();
+    updated->count = count;
+    updated->shift = shift;
+    if (i >= tail_offset()) {
+        auto new_tail                         = make_shared<Node>(*tail);
+        new_tail->elements[i & VECTOR_MASK] = std::move(element);
+        updated->root                         = root;
+        updated->tail                         = std::move(new_tail);
+    } else {
+        updated->root = assoc(shift, *root, i, std::move(element));
+        updated->tail = tail;
+    }
+    return updated;
+}
+
+auto Persistent_vector::push(unique_ptr<Value> value) const
+    -> unique_ptr<Persistent_vector> {
+    auto element = persistent::share(std::move(value));
+
+    auto updated   = make_unique<Persistent_vector>();
+    updated->count = (count + 1);
+    updated->shift = shift;
+
+    if ((count - tail_offset()) < VECTOR_WIDTH) {
+        auto new_tail = make_shared<Node>(*tail);
+        new_tail->elements.push_back(std::move(element));
+        updated->root = root;
+        updated->tail = std::move(new_tail);
+        return updated;
+    }
+
+    /*
+     * The tail is full so it is moved into the tree, which grows a level if
+     * its root is full too.
+     */
+    if ((count >> VECTOR_BITS) > (size_type{1} << shift)) {
+        auto new_root = make_shared<Node>();
+        new_root->children.push_back(root);
+        new_root->children.push_back(new_path(shift, tail));
+        updated->root  = std::move(new_root);
+        updated->shift = (shift + VECTOR_BITS);
+    } else {
+        updated->root = push_tail(count, shift, *root, tail);
+    }
+
+    auto new_tail = make_shared<Node>();
+    new_tail->elements.push_back(std::move(element));
+    updated->tail = std::move(new_tail);
+
+    return updated;
+}
+
+auto Persistent_vector::pop() const -> unique_ptr<Persistent_vector> {
+    if (count == 0) {
+        throw make_unique_exception<OutOfRangeException>(
+            "pop from empty persistent vector");
+    }
+
+    auto updated = make_unique<Persistent_vector>();
+    if (count == 1) {
+        return updated;
+    }
+
+    updated->count = (count - 1);
+    updated->shift = shift;
+
+    if ((count - tail_offset()) > 1) {
+        auto new_tail = make_shared<Node>(*tail);
+        new_tail->elements.pop_back();
+        updated->root = root;
+        updated->tail = std::move(new_tail);
+        return updated;
+    }
+
+    /*
+     * The tail would become empty so the last leaf of the tree becomes the
+     * new tail, and the tree loses a level if its root is left with a single
+     * child.
+     */
+    updated->tail = leaf_for(count - 2);
+    auto new_root = pop_tail(count, shift, *root);
+    if (not new_root) {
+        new_root = make_shared<Node>();
+    }
+    if (shift > VECTOR_BITS and new_root->children.size() == 1) {
+        new_root = new_root->children.front();
+        updated->shift -= VECTOR_BITS;
+    }
+    updated->root = std::move(new_root);
+
+    return updated;
+}
+
+unique_ptr<viua::types::Value> Persistent_vector::copy() const {
+    auto copied   = make_unique<Persistent_vector>();
+    copied->count = count;
+    copied->shift = shift;
+    copied->root  = root;
+    copied->tail  = tail;
+    return copied;
+}
+
+Persistent_vector::Persistent_vector()
+        : root(make_shared<Node const>()), tail(make_shared<Node const>()) {}
+
+
+/*
+ * Slots hold either a key-value pair, or a child node.
+ * Nodes below the level at which all bits of the hash are used up hold keys
+ * whose hashes collide, and have no bitmap.
+ */
+struct Persistent_map::Node {
+    struct Slot {
+        uint64_t hash = 0;
+        shared_ptr<Value const> key;
+        shared_ptr<Value const> value;
+        shared_ptr<Node const> child;
+    };
+
+    uint32_t bitmap = 0;
+    vector<Slot> slots;
+};
+
+using Map_node = Persistent_map::Node;
+using Map_slot = Persistent_map::Node::Slot;
+
+static auto const MAP_BITS = 5u;
+static auto const MAP_MASK = ((uint64_t{1} << MAP_BITS) - 1);
+static auto const MAP_HASH_BITS = 64u;
+
+static auto bit_of(uint64_t const hash, unsigned const shift) -> uint32_t {
+    return (uint32_t{1} << ((hash >> shift) & MAP_MASK));
+}
+static auto index_of(Map_node const& node, uint32_t const bit)
+    -> vector<Map_slot>::size_type {
+    return static_cast<vector<Map_slot>::size_type>(
+        __builtin_popcount(node.bitmap & (bit - 1)));
+}
+
+static auto same_key(Map_slot const& slot,
+                     uint64_t const hash,
+                     Value const& key) -> bool {
+    return (slot.hash == hash and viua::types::Hash_map::equal(*slot.key, key));
+}
+
+static auto find(Map_node const* node,
+                 uint64_t const hash,
+                 Value const& key) -> Map_slot const* {
+    for (auto shift = 0u; node; shift += MAP_BITS) {
+        if (shift >= MAP_HASH_BITS) {
+            for (auto const& each : node->slots) {
+                if (same_key(each, hash, key)) {
+                    return &each;
+                }
+            }
+            return nullptr;
+        }
+
+        auto const bit = bit_of(hash, shift);
+        if (not(node->bitmap & bit)) {
+            return nullptr;
+        }
+        auto const& slot = node->slots[index_of(*node, bit)];
+        if (not slot.child) {
+            return (same_key(slot, hash, key) ? &slot : nullptr);
+        }
+        node = slot.child.get();
+    }
+    return nullptr;
+}
+
+static auto insert(Map_node const* node,
+                   unsigned const shift,
+                   Map_slot entry,
+                   bool& added) -> shared_ptr<Map_node const> {
+    auto copied = (node ? make_shared<Map_node>(*node) : make_shared<Map_node>());
+
+    if (shift >= MAP_HASH_BITS) {
+        for (auto& each : copied->slots) {
+            if (same_key(each, entry.hash, *entry.key)) {
+                each.value = std::move(entry.value);
+                return copied;
+            }
+        }
+        copied->slots.push_back(std::move(entry));
+        added = true;
+        return copied;
+    }
+
+    auto const bit   = bit_of(entry.hash, shift);
+    auto const index = index_of(*copied, bit);
+    if (not(copied->bitmap & bit)) {
+        copied->bitmap |= bit;
+        copied->slots.insert(
+            (copied->slots.begin()
+             + static_cast<vector<Map_slot>::difference_type>(index)),
+            std::move(entry));
+        added = true;
+        return copied;
+    }
+
+    auto& slot = copied->slots[index];
+    if (slot.child) {
+        slot.child =
+            insert(slot.child.get(), (shift + MAP_BITS), std::move(entry), added);
+    } else if (same_key(slot, entry.hash, *entry.key)) {
+        slot.value = std::move(entry.value);
+    } else {
+        /*
+         * Two different keys share the slot so they are pushed one level
+         * down.
+         */
+        auto ignored = false;
+        auto child   = insert(nullptr, (shift + MAP_BITS), std::move(slot), ignored);
+        slot         = Map_slot{};
+        slot.child   = insert(
+            child.get(), (shift + MAP_BITS), std::move(entry), added);
+    }
+    return copied;
+}
+
+/*
+ * Returns the node itself if the key is not present in it, and null if the
+ * node would become empty.
+ */
+static auto remove(shared_ptr<Map_node const> const& node,
+                   unsigned const shift,
+                   uint64_t const hash,
+                   Value const& key,
+                   bool& removed) -> shared_ptr<Map_node const> {
+    if (shift >= MAP_HASH_BITS) {
+        for (auto i = vector<Map_slot>::size_type{0}; i < node->slots.size();
+             ++i) {
+            if (same_key(node->slots[i], hash, key)) {
+                removed = true;
+                if (node->slots.size() == 1) {
+                    return nullptr;
+                }
+                auto copied = make_shared<Map_node>(*node);
+                copied->slots.erase(
+                    copied->slots.begin()
+                    + static_cast<vector<Map_slot>::difference_type>(i));
+                return copied;
+            }
+        }
+        return node;
+    }
+
+    auto const bit = bit_of(hash, shift);
+    if (not(node->bitmap & bit)) {
+        return node;
+    }
+
+    auto const index = index_of(*node, bit);
+    auto const& slot = node->slots[index];
+
+    auto child = shared_ptr<Map_node const>{};
+    if (slot.child) {
+        child = remove(slot.child, (shift + MAP_BITS), hash, key, removed);
+        if (not removed) {
+            return node;
+        }
+    } else if (not same_key(slot, hash, key)) {
+        return node;
+    } else {
+        removed = true;
+    }
+
+    auto copied = make_shared<Map_node>(*node);
+    if (child and child->slots.size() == 1 and not child->slots.front().child) {
+        /*
+         * A single key left in a child node moves back up so that the trie
+         * does not keep chains of nodes holding just one key.
+         */
+        copied->slots[index] = child->slots.front();
+    } else if (child) {
+        copied->slots[index].child = std::move(child);
+    } else {
+        copied->bitmap &= ~bit;
+        copied->slots.erase(copied->slots.begin()
+                            + static_cast<vector<Map_slot>::difference_type>(index));
+    }
+    return (copied->slots.empty() ? nullptr : copied);
+}
+
+template<typename Fn>
+static auto for_each_slot(Map_node const* node, Fn const& fn) -> void {
+    if (not node) {
+        return;
+    }
+    for (auto const& each : node->slots) {
+        if (each.child) {
+            for_each_slot(each.child.get(), fn);
+        } else {
+            fn(each);
+        }
+    }
+}
+
+const string Persistent_map::type_name = "PersistentMap";
+
+string Persistent_map::type() const {
+    return "PersistentMap";
+}
+
+string Persistent_map::str() const {
+    ostringstream oss;
+    oss << '{';
+    auto i = count;
+    for_each_slot(root.get(), [&oss, &i](Map_slot const& each) {
+        oss << each.key->repr() << ": " << each.value->repr();
+        if (--i) {
+            oss << ", ";
+        }
+    });
+    oss << '}';
+    return oss.str();
+}
+
+string Persistent_map::repr() const {
+    return str();
+}
+
+bool Persistent_map::boolean() const {
+    return (count != 0);
+}
+
+vector<string> Persistent_map::bases() const {
+    return vector<string>{"Value"};
+}
+vector<string> Persistent_map::inheritancechain() const {
+    return vector<string>{"Value"};
+}
+
+auto Persistent_map::size() const -> size_type {
+    return count;
+}
+
+auto Persistent_map::at(Value const& key) const -> unique_ptr<Value> {
+    auto const slot = find(root.get(), Hash_map::hash_of(key), key);
+    return (slot ? slot->value->copy() : nullptr);
+}
+
+auto Persistent_map::contains(Value const& key) const -> bool {
+    return (find(root.get(), Hash_map::hash_of(key), key) != nullptr);
+}
+
+auto Persistent_map::keys() const -> vector<unique_ptr<Value>> {
+    auto ks = vector<unique_ptr<Value>>{};
+    ks.reserve(count);
+    for_each_slot(root.get(),
+                  [&ks](Map_slot const& each) { ks.push_back(each.key->copy()); });
+    return ks;
+}
+
+auto Persistent_map::insert(unique_ptr<Value> key, unique_ptr<Value> value) const
+    -> unique_ptr<Persistent_map> {
+    auto entry  = Map_slot{};
+    entry.hash  = Hash_map::hash_of(*key);
+    entry.key   = persistent::share(std::move(key));
+    entry.value = persistent::share(std::move(value));
+
+    auto added     = false;
+    auto updated   = make_unique<Persistent_map>();
+    updated->root  = ::insert(root.get(), 0, std::move(entry), added);
+    updated->count = (count + (added ? 1 : 0));
+    return updated;
+}
+
+auto Persistent_map::remove(Value const& key) const
+    -> unique_ptr<Persistent_map> {
+    auto removed = false;
+    auto updated = make_unique<Persistent_map>();
+    if (root) {
+        updated->root = ::remove(root, 0, Hash_map::hash_of(key), key, removed);
+    }
+    if (not removed) {
+        throw make_unique<Exception>("key not found: " + key.repr());
+    }
+    updated->count = (count - 1);
+    return updated;
+}
+
+unique_ptr<viua::types::Value> Persistent_map::copy() const {
+    auto copied   = make_unique<Persistent_map>();
+    copied->count = count;
+    copied->root  = root;
+    return copied;
+}
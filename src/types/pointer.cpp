@@ -30,27 +30,31 @@ using namespace std;
 
 const string viua::types::Pointer::type_name = "Pointer";
 
-void viua::types::Pointer::attach() {
-    points_to->pointers.push_back(this);
-    valid = true;
-}
-void viua::types::Pointer::detach() {
-    if (valid) {
-        points_to->pointers.erase(std::find(
-            points_to->pointers.begin(), points_to->pointers.end(), this));
+auto viua::types::Pointer::verify() const -> bool {
+    if (not(valid and target_alive->load())) {
+        return (valid = false);
     }
-    valid = false;
-}
-
-void viua::types::Pointer::invalidate(viua::types::Value* t) {
-    if (t == points_to) {
-        valid = false;
+    if (verified_in == process_of_origin->ownership_generation) {
+        return true;
     }
+
+    /*
+     * The process gave some of its values away since the pointer was last
+     * verified so it must check if it still owns the value.
+     * Only the address of the value is compared so this is safe even if the
+     * value has been destroyed in the meantime by another process, but then
+     * the address could have been reused for one of the values of this
+     * process so the value must still be alive after the check.
+     */
+    valid       = (process_of_origin->owns(points_to) and target_alive->load());
+    verified_in = process_of_origin->ownership_generation;
+    return valid;
 }
+
 bool viua::types::Pointer::expired() {
-    return !valid;
+    return (not verify());
 }
-auto viua::types::Pointer::authenticate(const viua::process::Process* process)
+auto viua::types::Pointer::authenticate(const viua::types::Value_owner* process)
     -> void {
     /*
      *  Pointers should automatically expire upon crossing process boundaries.
@@ -60,29 +64,31 @@ auto viua::types::Pointer::authenticate(const viua::process::Process* process)
      */
     valid = (valid and (process_of_origin == process));
 }
-void viua::types::Pointer::reset(viua::types::Value* t) {
-    detach();
-    points_to = t;
-    attach();
-}
-viua::types::Value* viua::types::Pointer::to(const viua::process::Process* p) {
+viua::types::Value* viua::types::Pointer::to(
+    const viua::types::Value_owner* p) {
     if (process_of_origin != p) {
         // Dereferencing pointers outside of their original process is illegal.
         throw make_unique<viua::types::Exception>(
             "InvalidDereference: outside of original process");
     }
-    if (not valid) {
+    if (not verify()) {
         throw make_unique<viua::types::Exception>("expired pointer exception");
     }
     return points_to;
 }
 
 string viua::types::Pointer::type() const {
-    return ((valid ? points_to->type() : "Expired") + "Pointer");
+    /*
+     * The type may be requested by a process other than the process of origin
+     * (e.g. when the pointer was sent as a part of a message) so the pointer
+     * is not verified here.
+     */
+    return (((valid and target_alive->load()) ? target_type : "Expired")
+            + "Pointer");
 }
 
 bool viua::types::Pointer::boolean() const {
-    return valid;
+    return (valid and target_alive->load());
 }
 
 vector<string> viua::types::Pointer::bases() const {
@@ -97,10 +103,7 @@ string viua::types::Pointer::str() const {
 }
 
 unique_ptr<viua::types::Value> viua::types::Pointer::copy() const {
-    if (not valid) {
-        return make_unique<Pointer>(process_of_origin);
-    }
-    return make_unique<Pointer>(points_to, process_of_origin);
+    return make_unique<Pointer>(*this);
 }
 
 
@@ -114,13 +117,21 @@ void viua::types::Pointer::expired(Frame* frm,
 }
 
 
-viua::types::Pointer::Pointer(const viua::process::Process* poi)
-        : points_to(nullptr), valid(false), process_of_origin(poi) {}
+viua::types::Pointer::Pointer(const viua::types::Value_owner* poi)
+        : points_to(nullptr)
+        , target_alive(make_shared<atomic_bool>(false))
+        , valid(false)
+        , verified_in(0)
+        , process_of_origin(poi) {}
 viua::types::Pointer::Pointer(viua::types::Value* t,
-                              const viua::process::Process* poi)
-        : points_to(t), valid(true), process_of_origin(poi) {
-    attach();
-}
-viua::types::Pointer::~Pointer() {
-    detach();
+                              const viua::types::Value_owner* poi)
+        : points_to(t)
+        , target_type(t->type())
+        , valid(true)
+        , verified_in(poi->ownership_generation)
+        , process_of_origin(poi) {
+    if (not t->alive) {
+        t->alive = make_shared<atomic_bool>(true);
+    }
+    target_alive = t->alive;
 }
@@ -50,12 +50,12 @@ bool viua::types::Process::boolean() const {
 }
 
 unique_ptr<viua::types::Value> viua::types::Process::copy() const {
-    return make_unique<Process>(thrd);
+    return make_unique<Process>(saved_pid);
 }
 
 viua::process::PID viua::types::Process::pid() const {
     return saved_pid;
 }
 
-viua::types::Process::Process(viua::process::Process* t)
-        : thrd(t), saved_pid(thrd->pid()) {}
+viua::types::Process::Process(viua::process::PID const pid)
+        : saved_pid(pid) {}
@@ -27,6 +27,15 @@ viua::types::Value* viua::types::Reference::points_to() const {
     return *pointer;
 }
 
+auto viua::types::Reference::take() -> unique_ptr<viua::types::Value> {
+    if (*counter > 1) {
+        return (*pointer)->copy();
+    }
+    auto referred = unique_ptr<viua::types::Value>{*pointer};
+    (*pointer)    = nullptr;
+    return referred;
+}
+
 void viua::types::Reference::rebind(viua::types::Value* ptr) {
     if (*pointer) {
         delete (*pointer);
@@ -67,6 +76,10 @@ unique_ptr<viua::types::Value> viua::types::Reference::copy() const {
     ++(*counter);
     return make_unique<viua::types::Reference>(pointer, counter);
 }
+auto viua::types::Reference::reaches(Value const* value) const -> bool {
+    return (Value::reaches(value)
+            or ((*pointer) and (*pointer)->reaches(value)));
+}
 
 viua::types::Reference::Reference(viua::types::Value* ptr)
         : pointer(new viua::types::Value*(ptr)), counter(new uint64_t{1}) {}
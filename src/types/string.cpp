@@ -26,6 +26,7 @@
 #include <vector>
 #include <viua/assert.h>
 #include <viua/exceptions.h>
+#include <viua/process.h>
 #include <viua/support/string.h>
 #include <viua/types/boolean.h>
 #include <viua/types/object.h>
@@ -39,31 +40,144 @@ using namespace viua::types;
 
 const string viua::types::String::type_name = "String";
 
+
+struct String::Rope {
+    /*
+     * Leaves are views into a buffer (possibly shared with other leaves).
+     * Concatenation nodes have no buffer and refer to their operands instead.
+     */
+    shared_ptr<string const> buffer;
+    string::size_type offset = 0;
+    string::size_type length = 0;
+
+    /*
+     * Children are only ever modified by the destructor (which steals them
+     * from nodes it owns exclusively) so the rope is immutable for everybody
+     * else.
+     */
+    mutable shared_ptr<Rope const> left;
+    mutable shared_ptr<Rope const> right;
+
+    Rope(shared_ptr<string const> b,
+         string::size_type const o,
+         string::size_type const l)
+            : buffer(std::move(b)), offset(o), length(l) {}
+    Rope(shared_ptr<Rope const> l, shared_ptr<Rope const> r)
+            : length(l->length + r->length)
+            , left(std::move(l))
+            , right(std::move(r)) {}
+
+    /*
+     * Repeated concatenation produces very deep ropes so they must not be
+     * destroyed recursively or the destructor would overflow the stack.
+     */
+    ~Rope() {
+        auto pending = vector<shared_ptr<Rope const>>{};
+        pending.push_back(std::move(left));
+        pending.push_back(std::move(right));
+        while (not pending.empty()) {
+            auto node = std::move(pending.back());
+            pending.pop_back();
+            if (node and node.use_count() == 1) {
+                pending.push_back(std::move(node->left));
+                pending.push_back(std::move(node->right));
+            }
+        }
+    }
+};
+
+auto String::leaf(string s) -> shared_ptr<Rope const> {
+    auto const length = s.size();
+    return make_shared<Rope>(
+        make_shared<string const>(std::move(s)), 0, length);
+}
+
+auto String::append_to(string& out, Rope const& rope) -> void {
+    auto pending = vector<Rope const*>{&rope};
+    while (not pending.empty()) {
+        auto const node = pending.back();
+        pending.pop_back();
+        if (node->buffer) {
+            out.append(*node->buffer, node->offset, node->length);
+        } else {
+            pending.push_back(node->right.get());
+            pending.push_back(node->left.get());
+        }
+    }
+}
+
+/*
+ * Concatenation of short strings is cheaper to do by copying them than by
+ * allocating a node, and keeps ropes shallow.
+ */
+static auto const ROPE_FLAT_CONCATENATION_LIMIT = string::size_type{64};
+
+auto String::concat(shared_ptr<Rope const> lhs, shared_ptr<Rope const> rhs)
+    -> shared_ptr<Rope const> {
+    if (rhs->length == 0) {
+        return lhs;
+    }
+    if (lhs->length == 0) {
+        return rhs;
+    }
+    if ((lhs->length + rhs->length) <= ROPE_FLAT_CONCATENATION_LIMIT) {
+        auto s = string{};
+        s.reserve(lhs->length + rhs->length);
+        append_to(s, *lhs);
+        append_to(s, *rhs);
+        return leaf(std::move(s));
+    }
+    return make_shared<Rope>(std::move(lhs), std::move(rhs));
+}
+
+auto String::flatten() const -> Rope const& {
+    if (not rope->buffer) {
+        auto s = string{};
+        s.reserve(rope->length);
+        append_to(s, *rope);
+        rope = leaf(std::move(s));
+    }
+    return *rope;
+}
+
+
 string String::type() const {
     return "String";
 }
 string String::str() const {
-    return svalue;
+    return value();
 }
 string String::repr() const {
-    return str::enquote(svalue);
+    return str::enquote(value());
 }
 bool String::boolean() const {
-    return svalue.size() != 0;
+    return rope->length != 0;
 }
 
 unique_ptr<Value> String::copy() const {
-    return make_unique<String>(svalue);
+    return unique_ptr<Value>{new String(rope)};
+}
+
+string const& String::value() const {
+    auto const& flat = flatten();
+    if (flat.offset != 0 or flat.length != flat.buffer->size()) {
+        /*
+         * Views into a part of a buffer must get their own buffer to be
+         * presented as a contiguous string.
+         */
+        rope = leaf(flat.buffer->substr(flat.offset, flat.length));
+    }
+    return *rope->buffer;
 }
 
-string& String::value() {
-    return svalue;
+auto String::length() const -> string::size_type {
+    return rope->length;
 }
 
 Integer* String::size() {
     /** Return size of the string.
      */
-    return new Integer(static_cast<Integer::underlying_type>(svalue.size()));
+    return new Integer(static_cast<Integer::underlying_type>(length()));
 }
 
 String* String::sub(int64_t b, int64_t e) {
@@ -73,22 +187,35 @@ String* String::sub(int64_t b, int64_t e) {
     // these casts are ugly as hell, but without them Clang warns about implicit
     // sign-changing
     if (b < 0) {
-        cut_from = (svalue.size() - static_cast<unsigned>(-b));
+        cut_from = (length() - static_cast<unsigned>(-b));
     } else {
         cut_from = static_cast<decltype(cut_from)>(b);
     }
     if (e < 0) {
-        cut_to = (svalue.size() - static_cast<unsigned>(-e) + 1);
+        cut_to = (length() - static_cast<unsigned>(-e) + 1);
     } else {
         cut_to = static_cast<decltype(cut_to)>(e);
     }
-    return new String(svalue.substr(cut_from, cut_to));
+    if (cut_from > length()) {
+        throw make_unique<viua::types::Exception>("substring out of range");
+    }
+
+    /*
+     * Substrings do not copy any bytes, they are views into the buffer of
+     * this string.
+     * Only the second index is a length.
+     */
+    auto const& flat = flatten();
+    return new String(
+        make_shared<Rope>(flat.buffer,
+                                (flat.offset + cut_from),
+                                min(cut_to, (flat.length - cut_from))));
 }
 
 String* String::add(String* s) {
     /** Append string to this string.
      */
-    svalue += s->value();
+    rope = concat(rope, s->rope);
     return this;
 }
 
@@ -100,7 +227,7 @@ String* String::join(Vector* v) {
     for (int i = 0; i < vector_len; ++i) {
         s += v->at(i)->str();
         if (i < (vector_len - 1)) {
-            s += svalue;
+            s += value();
         }
     }
     return new String(s);
@@ -115,7 +242,8 @@ void String::stringify(Frame* frame,
     if (frame->arguments->size() < 2) {
         throw make_unique<viua::types::Exception>("expected 2 parameters");
     }
-    svalue = static_cast<Pointer*>(frame->arguments->at(1))->to(process)->str();
+    rope =
+        leaf(static_cast<Pointer*>(frame->arguments->at(1))->to(process)->str());
 }
 
 void String::represent(Frame* frame,
@@ -126,8 +254,8 @@ void String::represent(Frame* frame,
     if (frame->arguments->size() < 2) {
         throw make_unique<viua::types::Exception>("expected 2 parameters");
     }
-    svalue =
-        static_cast<Pointer*>(frame->arguments->at(1))->to(process)->repr();
+    rope = leaf(
+        static_cast<Pointer*>(frame->arguments->at(1))->to(process)->repr());
 }
 
 void String::startswith(Frame* frame,
@@ -136,6 +264,7 @@ void String::startswith(Frame* frame,
                         viua::process::Process*,
                         viua::kernel::Kernel*) {
     string s         = static_cast<String*>(frame->arguments->at(1))->value();
+    auto const& svalue = value();
     bool starts_with = false;
 
     if (s.size() <= svalue.size()) {
@@ -158,6 +287,7 @@ void String::endswith(Frame* frame,
                       viua::process::Process*,
                       viua::kernel::Kernel*) {
     string s       = static_cast<String*>(frame->arguments->at(1))->value();
+    auto const& svalue = value();
     bool ends_with = false;
 
     if (s.size() <= svalue.size()) {
@@ -183,7 +313,7 @@ void String::format(Frame* frame,
                     viua::kernel::Kernel*) {
     regex key_regex("#\\{(?:(?:0|[1-9][0-9]*)|[a-zA-Z_][a-zA-Z0-9_]*)\\}");
 
-    string result = svalue;
+    string result = value();
 
     if (regex_search(result, key_regex)) {
         vector<string> matches;
@@ -254,9 +384,9 @@ void String::concatenate(Frame* frame,
                          viua::kernel::Kernel*) {
     frame->local_register_set->set(
         0,
-        make_unique<String>(
-            static_cast<String*>(frame->arguments->at(0))->value()
-            + static_cast<String*>(frame->arguments->at(1))->value()));
+        unique_ptr<Value>{
+            new String(concat(static_cast<String*>(frame->arguments->at(0))->rope,
+                              static_cast<String*>(frame->arguments->at(1))->rope))});
 }
 
 void String::join(Frame*,
@@ -273,7 +403,8 @@ void String::size(Frame* frame,
                   viua::process::Process*,
                   viua::kernel::Kernel*) {
     frame->local_register_set->set(
-        0, make_unique<Integer>(static_cast<int>(svalue.size())));
+        0, make_unique<Integer>(static_cast<int>(length())));
 }
 
-String::String(string s) : svalue(s) {}
+String::String(shared_ptr<Rope const> r) : rope(std::move(r)) {}
+String::String(string s) : rope(leaf(std::move(s))) {}
@@ -72,6 +72,11 @@ unique_ptr<viua::types::Value> viua::types::Struct::remove(const string& key) {
     return value;
 }
 
+auto viua::types::Struct::at(const string& key) const -> Value* {
+    auto const attribute = attributes.find(key);
+    return (attribute == attributes.end() ? nullptr : attribute->second.get());
+}
+
 vector<string> viua::types::Struct::keys() const {
     vector<string> ks;
     for (const auto& each : attributes) {
@@ -87,3 +92,15 @@ unique_ptr<viua::types::Value> viua::types::Struct::copy() const {
     }
     return copied;
 }
+
+auto viua::types::Struct::reaches(Value const* value) const -> bool {
+    if (Value::reaches(value)) {
+        return true;
+    }
+    for (auto const& each : attributes) {
+        if (each.second->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include <viua/exceptions.h>
+#include <viua/types/float.h>
+#include <viua/types/integer.h>
+#include <viua/types/typed_vector.h>
+#include <viua/util/exceptions.h>
+using namespace std;
+
+using viua::util::exceptions::make_unique_exception;
+
+
+namespace viua { namespace types {
+/*
+ * Translates a (possibly negative) index into an offset from the beginning
+ * of a vector of given size.
+ * Inserting is also allowed one past the last element.
+ */
+static auto offset_of(int64_t const index,
+                      size_t const size,
+                      bool const inserting) -> size_t {
+    if (size == 0 and not inserting) {
+        throw make_unique_exception<OutOfRangeException>(
+            "empty vector index out of range");
+    }
+    if (index >= 0) {
+        auto const offset = static_cast<size_t>(index);
+        if (offset > size or (offset == size and not inserting)) {
+            throw make_unique_exception<OutOfRangeException>(
+                "positive vector index out of range");
+        }
+        return offset;
+    }
+    /*
+     * The index is checked before it is negated, as negating the lowest
+     * possible index would overflow.
+     */
+    if (index < -static_cast<int64_t>(size)) {
+        throw make_unique_exception<OutOfRangeException>(
+            "negative vector index out of range");
+    }
+    return (size - static_cast<size_t>(-index));
+}
+
+static auto invalid_element(string const& vector_type, Value const& element)
+    -> unique_ptr<Exception> {
+    return make_unique<Exception>("invalid element for " + vector_type + ": "
+                                  + element.type());
+}
+
+
+template<> const string Int_vector::type_name   = "IntVector";
+template<> const string Float_vector::type_name = "FloatVector";
+template<> const string Byte_vector::type_name  = "ByteVector";
+
+/*
+ * Boxing and unboxing of elements of vectors of each type.
+ */
+template<typename T> struct Element;
+template<> struct Element<int64_t> {
+    static auto box(int64_t const element) -> unique_ptr<Value> {
+        return make_unique<Integer>(element);
+    }
+    static auto unbox(Value const& element) -> int64_t {
+        if (auto const i = dynamic_cast<Integer const*>(&element)) {
+            return i->as_integer();
+        }
+        throw invalid_element(Int_vector::type_name, element);
+    }
+};
+template<> struct Element<double> {
+    static auto box(double const element) -> unique_ptr<Value> {
+        return make_unique<Float>(element);
+    }
+    static auto unbox(Value const& element) -> double {
+        if (auto const f = dynamic_cast<Float const*>(&element)) {
+            return f->as_float();
+        }
+        throw invalid_element(Float_vector::type_name, element);
+    }
+};
+template<> struct Element<uint8_t> {
+    static auto box(uint8_t const element) -> unique_ptr<Value> {
+        return make_unique<Integer>(element);
+    }
+    static auto unbox(Value const& element) -> uint8_t {
+        if (auto const i = dynamic_cast<Integer const*>(&element)) {
+            auto const n = i->as_integer();
+            if (n < 0 or n > 255) {
+                throw make_unique_exception<OutOfRangeException>(
+                    "byte out of range: " + to_string(n));
+            }
+            return static_cast<uint8_t>(n);
+        }
+        throw invalid_element(Byte_vector::type_name, element);
+    }
+};
+
+
+template<typename T> auto Unboxed_vector<T>::type() const -> string {
+    return type_name;
+}
+template<typename T> auto Unboxed_vector<T>::str() const -> string {
+    ostringstream oss;
+    oss << "[";
+    for (auto i = size_t{0}; i < elements.size(); ++i) {
+        oss << Element<T>::box(elements[i])->repr()
+            << (i < elements.size() - 1 ? ", " : "");
+    }
+    oss << "]";
+    return oss.str();
+}
+template<typename T> auto Unboxed_vector<T>::boolean() const -> bool {
+    return (not elements.empty());
+}
+template<typename T>
+auto Unboxed_vector<T>::copy() const -> unique_ptr<Value> {
+    return make_unique<Unboxed_vector<T>>(elements);
+}
+
+template<typename T> auto Unboxed_vector<T>::value() -> vector<T>& {
+    return elements;
+}
+
+template<typename T>
+auto Unboxed_vector<T>::insert(int64_t const index,
+                               unique_ptr<Value> element) -> void {
+    auto const unboxed = Element<T>::unbox(*element);
+    elements.insert(elements.begin()
+                        + static_cast<typename vector<T>::difference_type>(
+                            offset_of(index, elements.size(), true)),
+                    unboxed);
+}
+template<typename T>
+auto Unboxed_vector<T>::push(unique_ptr<Value> element) -> void {
+    elements.push_back(Element<T>::unbox(*element));
+}
+template<typename T>
+auto Unboxed_vector<T>::pop(int64_t const index) -> unique_ptr<Value> {
+    auto const offset = offset_of(index, elements.size(), false);
+    auto popped       = Element<T>::box(elements[offset]);
+    elements.erase(elements.begin()
+                   + static_cast<typename vector<T>::difference_type>(offset));
+    return popped;
+}
+template<typename T>
+auto Unboxed_vector<T>::at(int64_t const index) const -> unique_ptr<Value> {
+    return Element<T>::box(
+        elements[offset_of(index, elements.size(), false)]);
+}
+template<typename T> auto Unboxed_vector<T>::len() const -> int64_t {
+    return static_cast<int64_t>(elements.size());
+}
+
+template<typename T>
+Unboxed_vector<T>::Unboxed_vector(vector<T> initial)
+        : elements(std::move(initial)) {}
+
+
+template class Unboxed_vector<int64_t>;
+template class Unboxed_vector<double>;
+template class Unboxed_vector<uint8_t>;
+}}  // namespace viua::types
@@ -49,7 +49,7 @@ bool viua::types::Value::boolean() const {
 
 
 unique_ptr<viua::types::Pointer> viua::types::Value::pointer(
-    const viua::process::Process* process_of_origin) {
+    const viua::types::Value_owner* process_of_origin) {
     return make_unique<viua::types::Pointer>(this, process_of_origin);
 }
 
@@ -62,8 +62,18 @@ vector<string> viua::types::Value::inheritancechain() const {
 }
 
 
+auto viua::types::Value::reaches(Value const* value) const -> bool {
+    return (value == this);
+}
+
+
+viua::types::Value::Value(Value const&) {}
+auto viua::types::Value::operator=(Value const&) -> Value& {
+    return *this;
+}
+
 viua::types::Value::~Value() {
-    for (auto p : pointers) {
-        p->invalidate(this);
+    if (alive) {
+        alive->store(false);
     }
 }
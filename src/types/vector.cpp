@@ -158,6 +158,18 @@ unique_ptr<viua::types::Value> viua::types::Vector::copy() const {
     return std::move(v);
 }
 
+auto viua::types::Vector::reaches(Value const* value) const -> bool {
+    if (Value::reaches(value)) {
+        return true;
+    }
+    for (auto const& each : internal_object) {
+        if (each->reaches(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 vector<unique_ptr<viua::types::Value>>& viua::types::Vector::value() {
     return internal_object;
 }
@@ -0,0 +1,8 @@
+call __entry 1
+call main/0 1
+call square/1 10
+call sum_of_squares/1 1
+branch main/0 51 1 0
+branch sum_of_squares/1 46 1 10
+jump sum_of_squares/1 137 10
+loop sum_of_squares/1 27 10
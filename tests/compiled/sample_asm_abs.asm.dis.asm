@@ -0,0 +1,12 @@
+.function: main/1
+    integer %1 current -17
+    integer %2 current 0
+    lt %3 current %1 current %2 current
+    not %3 current %3 current
+    if %3 current 0x6e 0x4f
+    integer %4 current -1
+    mul %1 current %1 current %4 current
+    print %1 current
+    izero %0 local
+    return
+.end
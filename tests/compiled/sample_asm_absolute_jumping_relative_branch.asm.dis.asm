@@ -0,0 +1,9 @@
+.function: main/1
+    string %1 current "Hello World"
+    integer %2 current 42
+    if %2 current 0x60 0x37
+    string %1 current "Goodby World, you fail this test"
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/1
+    string %1 current "Hello World"
+    jump 0x2d
+    print %1 current
+    jump 0x36
+    jump 0x1d
+    delete %1 current
+    izero %0 local
+    return
+.end
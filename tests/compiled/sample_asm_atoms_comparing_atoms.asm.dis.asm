@@ -0,0 +1,11 @@
+.function: main/0
+    atom %1 local 'an_atom'
+    atom %2 local 'an_atom'
+    atom %3 local 'another_atom'
+    atomeq %4 local %1 local %2 local
+    print %4 local
+    atomeq %5 local %1 local %3 local
+    print %5 local
+    izero %0 local
+    return
+.end
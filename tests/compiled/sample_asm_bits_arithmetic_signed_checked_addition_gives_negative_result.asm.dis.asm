@@ -0,0 +1,12 @@
+.function: main/0
+    bits %1 local 0x09
+    bits %2 local 0x11
+    bitnot %2 local %2 local
+    checkedsincrement %2 local
+    checkedsadd %3 local %1 local %2 local
+    print %1 local
+    print %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/0
+    bits %1 local 0xff
+    checkedsincrement %1 local
+    print %1 local
+    izero %0 local
+    return
+.end
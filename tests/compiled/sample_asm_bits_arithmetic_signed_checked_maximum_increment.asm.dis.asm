@@ -0,0 +1,7 @@
+.function: main/0
+    bits %1 local 0x7f
+    checkedsincrement %1 local
+    print %1 local
+    izero %0 local
+    return
+.end
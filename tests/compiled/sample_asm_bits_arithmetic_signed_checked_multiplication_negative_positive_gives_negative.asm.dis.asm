@@ -0,0 +1,12 @@
+.function: main/0
+    bits %1 local 0x02
+    bits %2 local 0x02
+    bitnot %1 local %1 local
+    checkedsincrement %1 local
+    checkedsmul %3 local %1 local %2 local
+    print %1 local
+    print %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    bits %1 local 0x7f
+    bits %2 local 0x02
+    checkedsadd %3 local %1 local %2 local
+    print %1 local
+    print %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
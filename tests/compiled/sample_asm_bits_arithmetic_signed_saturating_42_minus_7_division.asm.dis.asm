@@ -0,0 +1,12 @@
+.function: main/0
+    bits %1 local 0x2a
+    bits %2 local 0x07
+    bitnot %2 local %2 local
+    saturatingsincrement %2 local
+    saturatingsdiv %3 local %1 local %2 local
+    print %1 local
+    print %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
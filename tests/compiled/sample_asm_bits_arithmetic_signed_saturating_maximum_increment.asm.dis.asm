@@ -0,0 +1,8 @@
+.function: main/0
+    bits %1 local 0x7f
+    print %1 local
+    saturatingsincrement %1 local
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    bits %1 local 0x80
+    print %1 local
+    saturatingsdecrement %1 local
+    print %1 local
+    izero %0 local
+    return
+.end
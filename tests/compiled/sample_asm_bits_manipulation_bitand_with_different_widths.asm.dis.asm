@@ -0,0 +1,12 @@
+.function: main/0
+    bits %1 local 0xd127
+    bits %2 local 0x0d
+    print %1 local
+    print %2 local
+    bitand %3 local %1 local %2 local
+    print %3 local
+    bitand %4 local %2 local %1 local
+    print %4 local
+    izero %0 local
+    return
+.end
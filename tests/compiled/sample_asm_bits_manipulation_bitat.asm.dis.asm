@@ -0,0 +1,12 @@
+.function: main/0
+    bits %1 local 0x9d
+    print %1 local
+    integer %2 local 2
+    bitat %3 local %1 local %2 local
+    print %3 local
+    integer %2 local 1
+    bitat %3 local %1 local %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: main/0
+    bits %1 local 0x00
+    if %1 local 0x28 0x3f
+    text %2 local "OH NOES"
+    print %2 local
+    bits %1 current 0x01
+    if %1 current 0x67 0x7e
+    text %3 local "OH YEAH"
+    print %3 local
+    izero %0 local
+    return
+.end
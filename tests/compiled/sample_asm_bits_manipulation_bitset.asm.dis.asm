@@ -0,0 +1,11 @@
+.function: main/0
+    bits %1 local 0x80
+    print %1 local
+    integer %2 local 0
+    bitset %1 local %2 local true
+    integer %2 local 7
+    bitset %1 local %2 local false
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/0
+    integer %1 local 8
+    bits %2 local %1 local
+    print %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    bits %1 local 0xdeadbeef
+    print %1 local
+    bits %1 local 0xdeadbeef
+    print %1 local
+    bits %1 local 0xdeadbeef
+    print %1 local
+    izero %0 local
+    return
+.end
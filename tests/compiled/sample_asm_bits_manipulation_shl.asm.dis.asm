@@ -0,0 +1,10 @@
+.function: main/0
+    bits %1 local 0xa0
+    integer %2 local 2
+    print %1 local
+    shl %0 local %1 local %2 local
+    print %1 local
+    print %0 local
+    izero %0 local
+    return
+.end
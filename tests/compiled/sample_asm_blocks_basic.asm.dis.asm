@@ -0,0 +1,12 @@
+.block: main_block
+    integer %1 current 42
+    leave
+.end
+
+.function: main/1
+    try
+    enter main_block
+    print %1 current
+    izero %0 local
+    return
+.end
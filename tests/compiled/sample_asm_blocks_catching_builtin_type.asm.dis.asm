@@ -0,0 +1,19 @@
+.block: handle_integer
+    draw %2 current
+    print %2 current
+    leave
+.end
+
+.block: main_block
+    integer %1 current 42
+    throw %1 current
+    leave
+.end
+
+.function: main/1
+    try
+    catch "Integer" handle_integer
+    enter main_block
+    izero %0 local
+    return
+.end
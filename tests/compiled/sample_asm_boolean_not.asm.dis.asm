@@ -0,0 +1,19 @@
+.function: boolean/1
+    arg %1 current %0
+    not %1 current %1 current
+    not %1 current %1 current
+    move %0 current %1 current
+    return
+.end
+
+.function: main/1
+    izero %1 current
+    frame %1 %16
+    param %0 %1 current
+    call %1 current boolean/1
+    print %1 current
+    not %1 current %1 current
+    print %1 current
+    izero %0 local
+    return
+.end
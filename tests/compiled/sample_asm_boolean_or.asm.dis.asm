@@ -0,0 +1,24 @@
+.function: boolean/1
+    arg %1 current %0
+    not %1 current %1 current
+    not %1 current %1 current
+    move %0 current %1 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    izero %1 current
+    pamv %0 %1 current
+    call %1 current boolean/1
+    frame %1 %16
+    integer %2 current 1
+    pamv %0 %2 current
+    call %2 current boolean/1
+    or %3 current %1 current %2 current
+    print %1 current
+    print %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/1
+    float %1 current 3.14159
+    ftoi %2 current %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,36 @@
+.function: listener/1
+    receive %1 local infinity
+    echo %1 local
+    arg %2 local %0
+    print %2 local
+    return
+.end
+
+.function: main/0
+    vector %4 local %0 local %0
+    frame %1 %16
+    integer %5 local 1
+    param %0 %5 local
+    process %1 local listener/1
+    copy %5 local %1 local
+    vpush %4 local %5 local
+    frame %1 %16
+    integer %5 local 2
+    param %0 %5 local
+    process %2 local listener/1
+    copy %5 local %2 local
+    vpush %4 local %5 local
+    frame %1 %16
+    integer %5 local 3
+    param %0 %5 local
+    process %3 local listener/1
+    copy %5 local %3 local
+    vpush %4 local %5 local
+    string %5 local "Hello broadcast World! "
+    broadcast %4 local %5 local
+    join void %1 local infinity
+    join void %2 local infinity
+    join void %3 local infinity
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/0
+    vector %1 local %0 local %0
+    string %2 local "Hello nobody!"
+    broadcast %1 local %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,42 @@
+.function: running_detached/0
+    izero %1 current
+    integer %2 current 4
+    string %3 current "Hello World! (from long-running detached process) #{0}"
+    gte %6 current %1 current %2 current
+    if %6 current 0xe9 0x7c
+    frame %2 %16
+    param %0 %3 current
+    copy %5 current %1 current
+    vector %4 current %5 current %1
+    param %1 %4 current
+    msg %7 current format/
+    print %7 current
+    iinc %1 current
+    jump 0x52
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    process void running_detached/0
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    string %3 current "main/1 exited"
+    print %3 current
+    izero %0 local
+    return
+.end
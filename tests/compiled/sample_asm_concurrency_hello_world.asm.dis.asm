@@ -0,0 +1,31 @@
+.function: print_lazy/1
+    nop
+    nop
+    nop
+    nop
+    nop
+    arg %1 current %0
+    print %1 current
+    return
+.end
+
+.function: print_eager/1
+    arg %1 current %0
+    print %1 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    string %1 current "Hello concurrent World! (1)"
+    param %0 %1 current
+    process %3 current print_lazy/1
+    frame %1 %16
+    string %2 current "Hello concurrent World! (2)"
+    param %0 %2 current
+    process %4 current print_eager/1
+    join void %3 current infinity
+    join void %4 current infinity
+    izero %0 local
+    return
+.end
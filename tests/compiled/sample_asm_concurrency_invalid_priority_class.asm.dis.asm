@@ -0,0 +1,6 @@
+.function: main/0
+    atom %1 local 'urgent'
+    priority %1 local
+    izero %0 local
+    return
+.end
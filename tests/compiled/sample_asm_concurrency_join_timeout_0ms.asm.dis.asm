@@ -0,0 +1,27 @@
+.function: child_process/1
+    arg %1 current %0
+    idec %1 current
+    if %1 current 0x2b 0x56
+    frame %1 %16
+    pamv %0 %1 current
+    tailcall child_process/1
+    string %0 current "child process done"
+    return
+.end
+
+.function: child_process/0
+    frame %1 %16
+    integer %1 current 65536
+    pamv %0 %1 current
+    tailcall child_process/1
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 current child_process/0
+    join %2 current %1 current 0ms
+    print %2 current
+    izero %0 local
+    return
+.end
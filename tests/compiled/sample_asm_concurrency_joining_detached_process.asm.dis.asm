@@ -0,0 +1,44 @@
+.function: running_detached/1
+    izero %1 current
+    integer %2 current 4
+    arg %3 current %0
+    self %4 current
+    send %3 current %4 current
+    string %5 current "Hello World! (from long-running detached process) "
+    gte %6 current %1 current %2 current
+    if %6 current 0xb7 0x99
+    echo %5 current
+    print %1 current
+    iinc %1 current
+    jump 0x6f
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    self %1 current
+    pamv %0 %1 current
+    process void running_detached/1
+    receive %1 current infinity
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    join %0 current %1 current infinity
+    string %3 current "main/1 exited"
+    print %3 current
+    izero %0 local
+    return
+.end
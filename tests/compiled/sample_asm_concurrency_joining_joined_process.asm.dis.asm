@@ -0,0 +1,31 @@
+.function: print_lazy/1
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    arg %1 current %0
+    print %1 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    string %1 local "Hello concurrent World! (1)"
+    param %0 %1 local
+    process %3 local print_lazy/1
+    join void %3 local infinity
+    join void %3 local infinity
+    izero %0 local
+    return
+.end
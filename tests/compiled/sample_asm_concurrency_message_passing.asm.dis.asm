@@ -0,0 +1,20 @@
+.function: run_in_a_process/1
+    arg %1 current %0
+    self %2 current
+    send %1 current %2 current
+    receive %3 current 10000ms
+    print %3 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    self %1 current
+    pamv %0 %1 current
+    process void run_in_a_process/1
+    receive %1 current 10000ms
+    string %2 current "Hello message passing World!"
+    send %1 current %2 current
+    izero %0 local
+    return
+.end
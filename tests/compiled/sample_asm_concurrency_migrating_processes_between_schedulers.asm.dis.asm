@@ -0,0 +1,49 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: print_hello/1
+    frame %1 %16
+    integer %1 current 64
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    arg %1 current %0
+    vector %2 current %1 current %1
+    string %1 current "Hello #{0}!\n"
+    frame %2 %16
+    param %0 %1 current
+    param %1 %2 current
+    msg %3 current format/
+    echo %3 current
+    return
+.end
+
+.function: process_spawner/1
+    frame %1 %16
+    arg %1 current %0
+    pamv %0 %1 current
+    process void print_hello/1
+    return
+.end
+
+.function: spawn_processes/1
+    arg %1 current %0
+    if %1 current 0x10b 0x16d
+    frame %1 %16
+    param %0 %1 current
+    call void process_spawner/1
+    idec %1 current
+    frame %1 %16
+    pamv %0 %1 current
+    tailcall spawn_processes/1
+    return
+.end
+
+.function: main/0
+    import "std::misc"
+    integer %1 current 64
+    frame %1 %16
+    pamv %0 %1 current
+    call void spawn_processes/1
+    izero %0 local
+    return
+.end
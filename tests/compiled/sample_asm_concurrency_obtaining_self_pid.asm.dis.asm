@@ -0,0 +1,9 @@
+.function: main/0
+    self %1 current
+    string %2 current "Hello World (from self)!"
+    send %1 current %2 current
+    receive %2 current infinity
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,16 @@
+.function: receiver/0
+    receive void infinity
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local receiver/0
+    string %2 local "Hello World!"
+    ptr %3 local %2 local
+    send %1 local %2 local
+    print *3 local
+    join void %1 local infinity
+    izero %0 local
+    return
+.end
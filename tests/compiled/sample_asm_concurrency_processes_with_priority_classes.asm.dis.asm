@@ -0,0 +1,30 @@
+.function: sum_of/1
+    atom %1 local 'batch'
+    priority %1 local
+    arg %1 local %0
+    izero %2 local
+    izero %3 local
+    jump 0x52
+    iinc %3 local
+    add %2 local %2 local %3 local
+    lt %4 local %3 local %1 local
+    if %4 local 0x38 0x7c
+    print %2 local
+    return
+.end
+
+.function: main/0
+    atom %1 local 'realtime'
+    priority %1 local
+    integer %2 local 1000
+    frame %1 %16
+    param %0 %2 local
+    process %2 local sum_of/1
+    join void %2 local infinity
+    atom %1 local 'normal'
+    priority %1 local
+    string %3 local "done"
+    print %3 local
+    izero %0 local
+    return
+.end
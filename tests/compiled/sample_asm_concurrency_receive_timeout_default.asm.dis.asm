@@ -0,0 +1,40 @@
+.block: pull_and_do_nothing
+    draw %3 current
+    leave
+.end
+
+.block: await_message
+    idec %1 current
+    receive %3 current 100ms
+    leave
+.end
+
+.function: message_sender/2
+    arg %1 current %0
+    arg %2 current %1
+    try
+    catch "Exception" pull_and_do_nothing
+    enter await_message
+    if %1 current 0x9f 0x7c
+    string %3 current "Hello World!"
+    send %2 current %3 current
+    return
+    frame %2 %16
+    pamv %0 %1 current
+    pamv %1 %2 current
+    tailcall message_sender/2
+    return
+.end
+
+.function: main/0
+    frame %2 %16
+    integer %1 current 5
+    pamv %0 %1 current
+    self %1 current
+    pamv %1 %1 current
+    process void message_sender/2
+    receive %1 current infinity
+    print %1 current
+    izero %0 local
+    return
+.end
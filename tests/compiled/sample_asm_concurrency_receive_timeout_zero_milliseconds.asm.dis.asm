@@ -0,0 +1,5 @@
+.function: main/0
+    receive void 0ms
+    izero %0 local
+    return
+.end
@@ -0,0 +1,38 @@
+.function: listener/0
+    struct %1 local
+    atom %2 local 'tag'
+    atom %3 local 'reply'
+    structinsert %1 local %2 local %3 local
+    receivematch %4 local %1 local infinity
+    print %4 local
+    atom %1 local 'Integer'
+    receivematch %4 local %1 local infinity
+    print %4 local
+    receive %4 local infinity
+    print %4 local
+    receive %4 local infinity
+    print %4 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local listener/0
+    atom %2 local 'noise'
+    send %1 local %2 local
+    integer %2 local 42
+    send %1 local %2 local
+    atom %2 local 'more_noise'
+    send %1 local %2 local
+    struct %2 local
+    atom %3 local 'tag'
+    atom %4 local 'reply'
+    structinsert %2 local %3 local %4 local
+    atom %3 local 'value'
+    string %4 local "Hello World!"
+    structinsert %2 local %3 local %4 local
+    send %1 local %2 local
+    join void %1 local infinity
+    izero %0 local
+    return
+.end
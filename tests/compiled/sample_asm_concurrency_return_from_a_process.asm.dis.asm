@@ -0,0 +1,13 @@
+.function: run_in_a_process/0
+    integer %0 current 42
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    process %1 current run_in_a_process/0
+    join %2 current %1 current infinity
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    self %1 local
+    atom %2 local 'noise'
+    send %1 local %2 local
+    atom %2 local 'reply'
+    receivematch %3 local %2 local 10ms
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,30 @@
+.function: receiver/0
+    receive %1 local infinity
+    frame %0 %16
+    call void  %1 local
+    frame %0 %16
+    call void  %1 local
+    return
+.end
+
+.function: main/0
+    integer %1 local 41
+    closure %2 local increment/0
+    capture %2 local %1 %1 local
+    copy %3 local %2 local
+    frame %0 %16
+    process %4 local receiver/0
+    send %4 local %2 local
+    join void %4 local infinity
+    frame %0 %16
+    call void  %3 local
+    print %1 local
+    izero %0 local
+    return
+.end
+
+.function: increment/0
+    iinc %1 local
+    print %1 local
+    return
+.end
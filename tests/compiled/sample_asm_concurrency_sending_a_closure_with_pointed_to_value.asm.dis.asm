@@ -0,0 +1,26 @@
+.function: receiver/0
+    receive %1 local infinity
+    frame %0 %16
+    call void  %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local receiver/0
+    string %2 local "Hello World!"
+    ptr %3 local %2 local
+    closure %4 local greet/0
+    capturemove %4 local %1 %2 local
+    print *3 local
+    send %1 local %4 local
+    join void %1 local infinity
+    print *3 local
+    izero %0 local
+    return
+.end
+
+.function: greet/0
+    print %1 local
+    return
+.end
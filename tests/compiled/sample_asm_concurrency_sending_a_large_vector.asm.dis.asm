@@ -0,0 +1,41 @@
+.block: main/0__nested__handler
+    draw %9 local
+    print %9 local
+    leave
+.end
+
+.block: main/0__nested__dereference
+    print *7 local
+    leave
+.end
+
+.function: receiver/0
+    receive %1 local infinity
+    vlen %2 local %1 local
+    print %2 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local receiver/0
+    vector %2 local %0 local %0
+    izero %3 local
+    integer %4 local 100000
+    lt %5 local %3 local %4 local
+    if %5 local 0xa7 0xd1
+    copy %6 local %3 local
+    vpush %2 local %6 local
+    iinc %3 local
+    jump 0x7d
+    integer %8 local -1
+    vat %7 local %2 local %8
+    print *7 local
+    send %1 local %2 local
+    join void %1 local infinity
+    try
+    catch "Exception" main/0__nested__handler
+    enter main/0__nested__dereference
+    izero %0 local
+    return
+.end
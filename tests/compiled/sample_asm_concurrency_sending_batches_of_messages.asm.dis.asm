@@ -0,0 +1,31 @@
+.function: listener/0
+    receive %1 local infinity
+    print %1 local
+    integer %2 local 2
+    receivemany %3 local %2 local
+    print %3 local
+    integer %2 local 8
+    receivemany %3 local %2 local
+    print %3 local
+    receivemany %3 local %2 local
+    print %3 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local listener/0
+    vector %2 local %0 local %0
+    string %3 local "Hello"
+    vpush %2 local %3 local
+    string %3 local "batched"
+    vpush %2 local %3 local
+    string %3 local "messages"
+    vpush %2 local %3 local
+    string %3 local "World!"
+    vpush %2 local %3 local
+    sendall %1 local %2 local
+    join void %1 local infinity
+    izero %0 local
+    return
+.end
@@ -0,0 +1,28 @@
+.function: modifier/0
+    integer %1 current 42
+    print %1 current
+    return
+.end
+
+.function: receiver/0
+    receive %1 local infinity
+    receive %2 local infinity
+    print %1 local
+    return
+.end
+
+.function: main/1
+    closure %2 current modifier/0
+    string %1 current "Hello World!"
+    capture %2 current %1 %1 current
+    frame %0 %16
+    process %3 local receiver/0
+    send %3 local %1 local
+    frame %0 %16
+    call void  %2 current
+    izero %4 local
+    send %3 local %4 local
+    join void %3 local infinity
+    izero %0 local
+    return
+.end
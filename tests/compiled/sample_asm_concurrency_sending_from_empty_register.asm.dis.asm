@@ -0,0 +1,8 @@
+.function: main/0
+    self %1 local
+    string %2 local "Hello World!"
+    move %3 local %2 local
+    send %1 local %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,23 @@
+.function: worker/0
+    izero %0 local
+    return
+.end
+
+.function: listener/0
+    receive %1 local 500ms
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local worker/0
+    join void %1 local infinity
+    frame %0 %16
+    process %2 local listener/0
+    string %3 local "Hello stale World!"
+    send %1 local %3 local
+    join void %2 local infinity
+    izero %0 local
+    return
+.end
@@ -0,0 +1,17 @@
+.function: sleeper/0
+    integer %1 local 50
+    sleep %1 local
+    string %1 local "World!"
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 local sleeper/0
+    string %2 local "Hello"
+    print %2 local
+    join void %1 local infinity
+    izero %0 local
+    return
+.end
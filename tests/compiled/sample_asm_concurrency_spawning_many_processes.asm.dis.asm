@@ -0,0 +1,29 @@
+.function: double/1
+    arg %1 global %0
+    add %0 local %1 global %1 global
+    return
+.end
+
+.function: main/0
+    integer %1 current 1000
+    izero %2 current
+    vector %3 current %0 current %0
+    gte %5 current %2 current %1 current
+    if %5 current 0xb8 0x71
+    frame %1 %16
+    param %0 %2 current
+    process %6 current double/1
+    vpush %3 current %6 current
+    iinc %2 current
+    jump 0x47
+    izero %4 current
+    vlen %5 current %3 current
+    if %5 current 0xe3 0x11f
+    vpop %6 current %3 current void
+    join %7 current %6 current infinity
+    add %4 current %4 current %7 current
+    jump 0xbf
+    print %4 current
+    izero %0 local
+    return
+.end
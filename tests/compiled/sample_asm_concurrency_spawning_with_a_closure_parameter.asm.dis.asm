@@ -0,0 +1,29 @@
+.function: worker/1
+    arg %1 local %0
+    frame %0 %16
+    call void  %1 local
+    frame %0 %16
+    call void  %1 local
+    return
+.end
+
+.function: main/0
+    integer %1 local 41
+    closure %2 local increment/0
+    capture %2 local %1 %1 local
+    frame %1 %16
+    param %0 %2 local
+    process %3 local worker/1
+    join void %3 local infinity
+    frame %0 %16
+    call void  %2 local
+    print %1 local
+    izero %0 local
+    return
+.end
+
+.function: increment/0
+    iinc %1 local
+    print %1 local
+    return
+.end
@@ -0,0 +1,33 @@
+.block: try_process_exception
+    join %0 current %1 current infinity
+    leave
+.end
+
+.block: handle_process_exception
+    string %3 current "exception transferred from process "
+    echo %3 current
+    echo %1 current
+    string %3 current ": "
+    echo %3 current
+    draw %3 current
+    print %3 current
+    leave
+.end
+
+.function: run_in_a_process/0
+    receive %1 current infinity
+    throw %1 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    process %1 current run_in_a_process/0
+    string %2 current "Hello exception transferring World!"
+    send %1 current %2 current
+    try
+    catch "String" handle_process_exception
+    enter try_process_exception
+    izero %0 local
+    return
+.end
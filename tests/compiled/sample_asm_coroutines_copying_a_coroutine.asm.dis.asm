@@ -0,0 +1,14 @@
+.function: answer/0
+    integer %0 local 42
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    coroutine %1 local answer/0
+    copy %2 local %1 local
+    resume %3 local %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
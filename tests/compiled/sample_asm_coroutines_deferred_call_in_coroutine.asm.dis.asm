@@ -0,0 +1,25 @@
+.function: say_bye/0
+    text %1 local "bye"
+    print %1 local
+    return
+.end
+
+.function: with_cleanup/0
+    frame %0 %16
+    defer say_bye/0
+    integer %1 local 1
+    yield %1 local
+    integer %0 local 2
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    coroutine %1 local with_cleanup/0
+    resume %2 local %1 local
+    print %2 local
+    resume %2 local %1 local
+    print %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,33 @@
+.block: handler
+    draw %3 local
+    print %3 local
+    leave
+.end
+
+.block: resume_failing
+    resume %2 local %1 local
+    print %2 local
+    leave
+.end
+
+.function: failing/0
+    integer %1 local 1
+    yield %1 local
+    text %2 local "failed in coroutine"
+    throw %2 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    coroutine %1 local failing/0
+    try
+    catch "Text" handler
+    enter resume_failing
+    try
+    catch "Text" handler
+    enter resume_failing
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,23 @@
+.function: count_to/1
+    arg %1 local %0
+    izero %2 local
+    lt %3 local %2 local %1 local
+    if %3 local 0x3e 0x55
+    yield %2 local
+    iinc %2 local
+    jump 0x14
+    return
+.end
+
+.function: main/0
+    frame %1 %16
+    integer %1 local 5
+    param %0 %1 local
+    coroutine %1 local count_to/1
+    resume %2 local %1 local
+    if %1 local 0xb2 0xc2
+    print %2 local
+    jump 0x8e
+    izero %0 local
+    return
+.end
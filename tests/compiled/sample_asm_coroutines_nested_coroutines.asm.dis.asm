@@ -0,0 +1,37 @@
+.function: count_to/1
+    arg %1 local %0
+    izero %2 local
+    lt %3 local %2 local %1 local
+    if %3 local 0x3e 0x55
+    yield %2 local
+    iinc %2 local
+    jump 0x14
+    return
+.end
+
+.function: doubled/1
+    arg %1 local %0
+    integer %2 local 2
+    resume %3 local %1 local
+    if %1 local 0x93 0xb6
+    mul %4 local %3 local %2 local
+    yield %4 local
+    jump 0x6f
+    return
+.end
+
+.function: main/0
+    frame %1 %16
+    integer %1 local 5
+    param %0 %1 local
+    coroutine %1 local count_to/1
+    frame %1 %16
+    pamv %0 %1 local
+    coroutine %2 local doubled/1
+    resume %3 local %2 local
+    if %2 local 0x13e 0x14e
+    print %3 local
+    jump 0x11a
+    izero %0 local
+    return
+.end
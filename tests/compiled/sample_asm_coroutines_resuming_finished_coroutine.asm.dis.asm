@@ -0,0 +1,15 @@
+.function: answer/0
+    integer %0 local 42
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    coroutine %1 local answer/0
+    resume %2 local %1 local
+    print %2 local
+    resume %2 local %1 local
+    print %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,23 @@
+.function: failing/0
+    frame %0 %16
+    coroutine %1 local answer/0
+    resume %2 local %1 local
+    print %2 local
+    resume %3 local %1 local
+    move %0 local %3 local
+    return
+.end
+
+.function: answer/0
+    integer %0 local 42
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    coroutine %1 local failing/0
+    resume %2 local %1 local
+    print %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,19 @@
+.function: answer/0
+    integer %1 local 41
+    yield %1 local
+    iinc %1 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    coroutine %1 local answer/0
+    resume %2 local %1 local
+    print %2 local
+    resume %2 local %1 local
+    print %2 local
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/0
+    integer %1 local 42
+    yield %1 local
+    izero %0 local
+    return
+.end
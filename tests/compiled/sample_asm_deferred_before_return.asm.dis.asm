@@ -0,0 +1,15 @@
+.function: print_me/1
+    arg %1 local %0
+    print *1 local
+    return
+.end
+
+.function: main/0
+    text %1 local "Hello World!"
+    ptr %2 local %1 local
+    frame %1 %16
+    pamv %0 %2 local
+    defer print_me/1
+    izero %0 local
+    return
+.end
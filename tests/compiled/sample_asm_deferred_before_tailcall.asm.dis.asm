@@ -0,0 +1,26 @@
+.function: bar/0
+    return
+.end
+
+.function: print_this_pointer/1
+    arg %1 local %0
+    print *1 local
+    return
+.end
+
+.function: foo/0
+    text %1 local "Hello World!"
+    ptr %2 local %1 local
+    frame %1 %16
+    pamv %0 %2 local
+    defer print_this_pointer/1
+    frame %0 %16
+    tailcall bar/0
+.end
+
+.function: main/0
+    frame %0 %16
+    call void foo/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,42 @@
+.block: main/0__nested__catch_Integer
+    draw %2 local
+    print %2 current
+    leave
+.end
+
+.block: main/0__nested__try_this
+    frame %0 %16
+    call void unfortunate/0
+    leave
+.end
+
+.function: print_me/1
+    arg %1 local %0
+    print *1 local
+    return
+.end
+
+.function: throwing/0
+    integer %1 local 666
+    throw %1 local
+    return
+.end
+
+.function: unfortunate/0
+    text %1 local "Hello World before stack unwinding!"
+    frame %1 %16
+    ptr %2 local %1 local
+    pamv %0 %2 local
+    defer print_me/1
+    frame %0 %16
+    call void throwing/0
+    return
+.end
+
+.function: main/0
+    try
+    catch "Integer" main/0__nested__catch_Integer
+    enter main/0__nested__try_this
+    izero %0 local
+    return
+.end
@@ -0,0 +1,29 @@
+.function: print_me/1
+    arg %1 local %0
+    print *1 local
+    return
+.end
+
+.function: throwing/0
+    integer %1 local 666
+    throw %1 local
+    return
+.end
+
+.function: unfortunate/0
+    text %1 local "Hello World before stack unwinding!"
+    frame %1 %16
+    ptr %2 local %1 local
+    pamv %0 %2 local
+    defer print_me/1
+    frame %0 %16
+    call void throwing/0
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    call void unfortunate/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,111 @@
+.block: main/0__nested__catch_Integer
+    draw %1 current
+    print %1 current
+    leave
+.end
+
+.block: main/0__nested__try_this
+    frame %0 %16
+    call void foo/0
+    leave
+.end
+
+.function: by_quux/0
+    text %1 current "Hello from by_quux/0"
+    print %1 current
+    return
+.end
+
+.function: quux/0
+    frame %0 %16
+    defer by_quux/0
+    integer %1 current 666
+    throw %1 current
+    return
+.end
+
+.function: by_bax/0
+    text %1 current "Hello from by_bax/0"
+    print %1 current
+    return
+.end
+
+.function: bax/0
+    frame %0 %16
+    defer by_bax/0
+    frame %0 %16
+    call void quux/0
+    return
+.end
+
+.function: by_bay/0
+    text %1 current "Hello from by_bay/0"
+    print %1 current
+    return
+.end
+
+.function: bay/0
+    frame %0 %16
+    defer by_bay/0
+    frame %0 %16
+    call void bax/0
+    return
+.end
+
+.function: by_baz/0
+    text %1 current "Hello from by_baz/0"
+    print %1 current
+    return
+.end
+
+.function: baz/0
+    frame %0 %16
+    defer by_baz/0
+    frame %0 %16
+    call void bay/0
+    return
+.end
+
+.function: by_bar/0
+    text %1 current "Hello from by_bar/0"
+    print %1 current
+    return
+.end
+
+.function: bar/0
+    frame %0 %16
+    defer by_bar/0
+    frame %0 %16
+    call void baz/0
+    return
+.end
+
+.function: by_foo/0
+    text %1 current "Hello from by_foo/0"
+    print %1 current
+    return
+.end
+
+.function: foo/0
+    frame %0 %16
+    defer by_foo/0
+    frame %0 %16
+    call void bar/0
+    return
+.end
+
+.function: by_main/0
+    text %1 current "Hello from by_main/0"
+    print %1 current
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    defer by_main/0
+    try
+    catch "Integer" main/0__nested__catch_Integer
+    enter main/0__nested__try_this
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: hello_world/0
+    text %1 local "Hello World!"
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    defer hello_world/0
+    izero %0 local
+    return
+.end
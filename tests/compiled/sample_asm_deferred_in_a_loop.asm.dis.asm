@@ -0,0 +1,37 @@
+.function: square/1
+    arg %1 local %0
+    mul %0 local %1 local %1 local
+    return
+.end
+
+.function: cleanup/0
+    frame %1 %16
+    integer %1 local 7
+    param %0 %1 local
+    call %2 local square/1
+    move %0 local %2 local
+    return
+.end
+
+.function: increment/1
+    frame %0 %16
+    defer cleanup/0
+    arg %1 local %0
+    iinc %1 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/0
+    izero %1 local
+    integer %2 local 10000
+    gte %3 local %1 local %2 local
+    if %3 local 0x112 0xdc
+    frame %1 %16
+    param %0 %1 local
+    call %1 local increment/1
+    jump 0xb2
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,36 @@
+.function: foo/0
+    text %1 local "foo"
+    print %1 local
+    return
+.end
+
+.function: bar/0
+    frame %0 %16
+    defer baz/0
+    text %1 local "bar"
+    print %1 local
+    return
+.end
+
+.function: baz/0
+    frame %0 %16
+    defer bay/0
+    text %1 local "baz"
+    print %1 local
+    return
+.end
+
+.function: bay/0
+    text %1 local "bay"
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    defer foo/0
+    frame %0 %16
+    defer bar/0
+    izero %0 local
+    return
+.end
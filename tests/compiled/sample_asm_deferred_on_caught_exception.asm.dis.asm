@@ -0,0 +1,41 @@
+.block: main__catch
+    draw %2 local
+    print %2 local
+    leave
+.end
+
+.block: main__try
+    frame %0 %16
+    call void throwing/0
+    leave
+.end
+
+.function: foo/0
+    text %1 local "Hello foo World!"
+    print %1 local
+    return
+.end
+
+.function: bar/0
+    text %1 local "Hello bar World!"
+    print %1 local
+    return
+.end
+
+.function: throwing/0
+    frame %0 %16
+    defer foo/0
+    frame %0 %16
+    defer bar/0
+    integer %1 local 42
+    throw %1 local
+    return
+.end
+
+.function: main/0
+    try
+    catch "Integer" main__catch
+    enter main__try
+    izero %0 local
+    return
+.end
@@ -0,0 +1,22 @@
+.function: foo/0
+    text %1 local "Hello deferred Foo!"
+    print %1 local
+    return
+.end
+
+.function: bar/0
+    text %1 local "Hello deferred Bar!"
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    defer bar/0
+    frame %0 %16
+    defer foo/0
+    integer %1 local 42
+    throw %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,26 @@
+.function: answer/0
+    integer %0 local 69
+    return
+.end
+
+.function: deferred/0
+    frame %0 %16
+    call %1 local answer/0
+    print %1 local
+    return
+.end
+
+.function: returns_a_value/0
+    frame %0 %16
+    defer deferred/0
+    integer %0 local 42
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    call %1 local returns_a_value/0
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,20 @@
+.function: foo/0
+    text %1 local "foo"
+    print %1 local
+    return
+.end
+
+.function: bar/0
+    text %1 local "bar"
+    print %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    defer foo/0
+    frame %0 %16
+    defer bar/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,25 @@
+.function: deferred/0
+    text %1 local "Hello from deferred!"
+    print %1 local
+    return
+.end
+
+.function: bar/0
+    integer %1 local 42
+    print %1 local
+    return
+.end
+
+.function: foo/0
+    frame %0 %16
+    defer deferred/0
+    frame %0 %16
+    tailcall bar/0
+.end
+
+.function: main/0
+    frame %0 %16
+    call void foo/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,46 @@
+.block: returns_in_a_try_block/0__nested__inner_handler
+    string %1 local "caught in the returning function"
+    print %1 local
+    leave
+.end
+
+.block: returns_in_a_try_block/0__nested__returning
+    frame %0 %16
+    defer thrower/0
+    izero %0 local
+    return
+.end
+
+.block: main/0__nested__outer_handler
+    draw %1 local
+    print %1 local
+    leave
+.end
+
+.block: main/0__nested__calling
+    frame %0 %16
+    call %1 local returns_in_a_try_block/0
+    leave
+.end
+
+.function: thrower/0
+    integer %1 local 42
+    throw %1 local
+    return
+.end
+
+.function: returns_in_a_try_block/0
+    try
+    catch "Integer" returns_in_a_try_block/0__nested__inner_handler
+    enter returns_in_a_try_block/0__nested__returning
+    izero %0 local
+    return
+.end
+
+.function: main/0
+    try
+    catch "Integer" main/0__nested__outer_handler
+    enter main/0__nested__calling
+    izero %0 local
+    return
+.end
@@ -0,0 +1,5 @@
+.function: main/0
+    throw %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,5 @@
+.function: main/0
+    delete %1 static
+    izero %0 local
+    return
+.end
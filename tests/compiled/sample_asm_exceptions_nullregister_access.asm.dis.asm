@@ -0,0 +1,20 @@
+.block: main/1__nested__exception_handler
+    string %1 current "exception encountered: "
+    echo %1 current
+    draw %2 current
+    print %2 current
+    leave
+.end
+
+.block: main/1__nested__print_block
+    print %1 current
+    leave
+.end
+
+.function: main/1
+    try
+    catch "Exception" main/1__nested__exception_handler
+    enter main/1__nested__print_block
+    izero %0 local
+    return
+.end
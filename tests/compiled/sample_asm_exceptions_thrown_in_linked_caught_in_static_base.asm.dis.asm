@@ -0,0 +1,31 @@
+; external function signatures
+.signature: test_module::test_fun/0
+
+.block: try_calling
+    frame %0 %16
+    call void test_module::test_fun/0
+    leave
+.end
+
+.block: handle_Integer
+    draw %1 current
+    string %2 current "looks "
+    echo %2 current
+    if %1 current 0x6b 0x5c
+    string %2 current "truthy"
+    string %2 current "falsey"
+    echo %2 current
+    string %2 current ": "
+    echo %2 current
+    print %1 current
+    leave
+.end
+
+.function: main/0
+    import "test_module"
+    try
+    catch "Integer" handle_Integer
+    enter try_calling
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/1
+    vector %1 current %0 current %0
+    integer %3 current 42
+    vpush %1 current %3 current
+    integer %4 current 4
+    vat %2 current %1 current %4
+    print *2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    vector %1 local %0 local %0
+    izero %0 local
+    vat %2 local %1 local %0
+    print *2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,72 @@
+; external function signatures
+.signature: printer::print/1
+
+.function: printer_wrapper/1
+    frame %1 %16
+    arg %1 current %0
+    pamv %0 %1 current
+    call void printer::print/1
+    return
+.end
+
+.function: process_spawner/1
+    frame %1 %16
+    arg %1 current %0
+    pamv %0 %1 current
+    process void printer_wrapper/1
+    return
+.end
+
+.function: main/0
+    import "build/test/printer"
+    frame %1 %16
+    string %1 current "Joe"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Robert"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Mike"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Bjarne"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Guido"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Dennis"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Bram"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Herb"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Anthony"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Alan"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Ada"
+    pamv %0 %1 current
+    call void process_spawner/1
+    frame %1 %16
+    string %1 current "Charles"
+    pamv %0 %1 current
+    call void process_spawner/1
+    izero %0 local
+    return
+.end
@@ -0,0 +1,13 @@
+; external function signatures
+.signature: math::sqrt/1
+
+.function: main/1
+    import "build/test/math"
+    frame %1 %16
+    float %1 current 3
+    param %0 %1 current
+    call %2 current math::sqrt/1
+    print %2 current
+    izero %0 local
+    return
+.end
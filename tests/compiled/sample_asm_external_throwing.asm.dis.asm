@@ -0,0 +1,32 @@
+; external function signatures
+.signature: throwing::oh_noes/0
+
+.block: __try
+    frame %0 %16
+    call void throwing::oh_noes/0
+    leave
+.end
+
+.block: __catch_Exception
+    draw %1 current
+    print %1 current
+    leave
+.end
+
+.function: watchdog_process/0
+    arg %1 local %0
+    string %2 local "exception"
+    remove %2 local %1 local %2 local
+    print %2 local
+    return
+.end
+
+.function: main/1
+    watchdog watchdog_process/0
+    import "build/test/throwing"
+    try
+    catch "ExceptionX" __catch_Exception
+    enter __try
+    izero %0 local
+    return
+.end
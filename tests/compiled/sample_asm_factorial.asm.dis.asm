@@ -0,0 +1,27 @@
+.function: factorial/2
+    arg %2 current %1
+    arg %1 current %0
+    mul %2 current %2 current %1 current
+    idec %1 current
+    integer %3 current 0
+    eq %4 current %1 current %3 current
+    if %4 current 0xa4 0x6a
+    frame %2 %16
+    param %0 %1 current
+    param %1 %2 current
+    call %2 current factorial/2
+    move %0 current %2 current
+    return
+.end
+
+.function: main/1
+    integer %1 current 8
+    integer %2 current 1
+    frame %2 %16
+    param %0 %1 current
+    param %1 %2 current
+    call %2 current factorial/2
+    print %2 current
+    izero %0 local
+    return
+.end
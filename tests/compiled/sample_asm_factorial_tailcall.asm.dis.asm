@@ -0,0 +1,26 @@
+.function: factorial/2
+    arg %0 current %1
+    arg %1 current %0
+    mul %0 current %0 current %1 current
+    idec %1 current
+    integer %3 current 0
+    eq %4 current %1 current %3 current
+    if %4 current 0x9e 0x6a
+    frame %2 %16
+    pamv %0 %1 current
+    pamv %1 %0 current
+    tailcall factorial/2
+    return
+.end
+
+.function: main/1
+    integer %1 current 8
+    frame %2 %16
+    param %0 %1 current
+    integer %2 current 1
+    pamv %1 %2 current
+    call %2 current factorial/2
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/1
+    float %1 current 4
+    float %2 current -3.5
+    add %3 current %1 current %2 current
+    float %4 current 0
+    add %3 current %3 current %4 current
+    print %3 current
+    izero %0 local
+    return
+.end
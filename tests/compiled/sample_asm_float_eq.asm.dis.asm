@@ -0,0 +1,8 @@
+.function: main/1
+    float %1 current 0.69
+    float %2 current 0.69
+    eq %1 current %1 current %2 current
+    print %1 current
+    izero %0 local
+    return
+.end
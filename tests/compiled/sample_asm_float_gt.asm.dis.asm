@@ -0,0 +1,8 @@
+.function: main/1
+    float %1 current 3.99
+    float %2 current 3.98
+    gt %1 current %1 current %2 current
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    float %1 current 4
+    float %2 current 3.99
+    gte %1 current %1 current %2 current
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,11 @@
+.function: main/1
+    float %1 current 0.0001
+    integer %2 current 0
+    integer %3 current 1
+    eq %2 current %2 current %3 current
+    if %1 current 0x51 0x5e
+    not %2 current %2 current
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    float %1 current 4
+    float %2 current 2.001
+    mul %3 current %1 current %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,19 @@
+.function: increment/2
+    arg %1 local %0
+    arg %2 local %1
+    iinc *2 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/1
+    integer %1 local 41
+    ptr %2 local %1 local
+    frame %2 %16
+    pamv %0 %1 local
+    param %1 %2 local
+    call %3 local increment/2
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,14 @@
+.function: twice/1
+    arg void %0
+    arg void %0
+    return
+.end
+
+.function: main/1
+    integer %1 local 42
+    frame %1 %16
+    pamv %0 %1 local
+    call void twice/1
+    izero %0 local
+    return
+.end
@@ -0,0 +1,19 @@
+.function: print_number_of_params/
+    argc %1 current
+    print %1 current
+    return
+.end
+
+.function: main/1
+    argc %1 current
+    print %1 current
+    izero %2 current
+    frame %2 %16
+    param %0 %2 current
+    param %1 %2 current
+    call void print_number_of_params/
+    frame %0 %16
+    call void print_number_of_params/
+    izero %0 local
+    return
+.end
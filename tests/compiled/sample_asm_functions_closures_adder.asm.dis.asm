@@ -0,0 +1,37 @@
+.function: adder/1
+    arg %2 current %0
+    add %0 current %2 current %1 current
+    return
+.end
+
+.function: make_adder/1
+    arg %1 current %0
+    closure %2 current adder/1
+    capture %2 current %1 %1 current
+    move %0 current %2 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    integer %1 current 3
+    param %0 %1 current
+    call %2 current make_adder/1
+    frame %1 %16
+    integer %3 current 2
+    param %0 %3 current
+    call %4 current  %2 current
+    print %4 current
+    frame %1 %16
+    integer %3 current 5
+    param %0 %3 current
+    call %4 current  %2 current
+    print %4 current
+    frame %1 %16
+    integer %3 current 13
+    param %0 %3 current
+    call %4 current  %2 current
+    print %4 current
+    izero %0 local
+    return
+.end
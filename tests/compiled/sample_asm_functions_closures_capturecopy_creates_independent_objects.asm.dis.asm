@@ -0,0 +1,19 @@
+.function: a_closure/0
+    print %1 current
+    return
+.end
+
+.function: main/1
+    string %1 current "Hello World!"
+    closure %2 current a_closure/0
+    capturecopy %2 current %1 %1 current
+    print %1 current
+    frame %0 %16
+    call void  %2 current
+    integer %1 current 42
+    print %1 current
+    frame %0 %16
+    call void  %2 current
+    izero %0 local
+    return
+.end
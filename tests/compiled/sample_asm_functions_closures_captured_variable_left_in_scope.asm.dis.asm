@@ -0,0 +1,17 @@
+.function: printer_function/0
+    print %1 current
+    return
+.end
+
+.function: main/1
+    closure %2 current printer_function/0
+    string %1 current "Hello World!"
+    capture %2 current %1 %1 current
+    frame %0 %16
+    call void  %2 current
+    integer %1 current 42
+    frame %0 %16
+    call void  %2 current
+    izero %0 local
+    return
+.end
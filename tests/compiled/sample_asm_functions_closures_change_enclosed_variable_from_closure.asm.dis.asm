@@ -0,0 +1,16 @@
+.function: variable_changing_function/0
+    integer %1 current 42
+    return
+.end
+
+.function: main/1
+    closure %2 current variable_changing_function/0
+    string %1 current "Hello World!"
+    capture %2 current %1 %1 current
+    print %1 current
+    frame %0 %16
+    call void  %2 current
+    print %1 current
+    izero %0 local
+    return
+.end
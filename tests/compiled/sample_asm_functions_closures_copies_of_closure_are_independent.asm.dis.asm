@@ -0,0 +1,24 @@
+.function: counter/0
+    iinc %1 local
+    print %1 local
+    return
+.end
+
+.function: main/1
+    izero %1 local
+    closure %2 local counter/0
+    capturecopy %2 local %1 %1 local
+    frame %0 %16
+    call void  %2 local
+    copy %3 local %2 local
+    frame %0 %16
+    call void  %2 local
+    frame %0 %16
+    call void  %2 local
+    frame %0 %16
+    call void  %3 local
+    frame %0 %16
+    call void  %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,54 @@
+.function: closure_maker/1
+    closure %0 current closure_level_1/1
+    arg %1 current %0
+    capture %0 current %1 %1 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    integer %1 current 1
+    param %0 %1 current
+    call %2 current closure_maker/1
+    frame %1 %16
+    integer %1 current 2
+    param %0 %1 current
+    call %3 current  %2 current
+    frame %1 %16
+    integer %1 current 3
+    param %0 %1 current
+    call %4 current  %3 current
+    frame %1 %16
+    integer %1 current 4
+    param %0 %1 current
+    call %5 current  %4 current
+    print %5 current
+    izero %0 local
+    return
+.end
+
+.function: closure_level_3/1
+    arg %4 current %0
+    add %5 current %1 current %2 current
+    add %5 current %3 current %5 current
+    add %5 current %4 current %5 current
+    move %0 current %5 current
+    return
+.end
+
+.function: closure_level_2/1
+    closure %0 current closure_level_3/1
+    capture %0 current %1 %1 current
+    capture %0 current %2 %2 current
+    arg %3 current %0
+    capture %0 current %3 %3 current
+    return
+.end
+
+.function: closure_level_1/1
+    closure %0 current closure_level_2/1
+    capture %0 current %1 %1 current
+    arg %2 current %0
+    capture %0 current %2 %2 current
+    return
+.end
@@ -0,0 +1,42 @@
+.function: closure_printer/0
+    print %2 current
+    return
+.end
+
+.function: closure_setter/1
+    arg %1 current %0
+    copy %2 current %1 current
+    return
+.end
+
+.function: returns_closures/0
+    vector %1 current %0 current %0
+    integer %2 current 42
+    closure %3 current closure_printer/0
+    capture %3 current %2 %2 current
+    closure %4 current closure_setter/1
+    capture %4 current %2 %2 current
+    vpush %1 current %3 current
+    vpush %1 current %4 current
+    move %0 current %1 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call %1 current returns_closures/0
+    frame %0 %16
+    izero %3 current
+    vat %2 current %1 current %3
+    call void  *2 current
+    frame %1 %16
+    integer %0 current 69
+    param %0 %0 current
+    integer %5 current 1
+    vat %4 current %1 current %5
+    call void  *4 current
+    frame %0 %16
+    call void  *2 current
+    izero %0 local
+    return
+.end
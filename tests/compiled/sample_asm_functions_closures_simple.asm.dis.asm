@@ -0,0 +1,21 @@
+.function: foo/0
+    print %1 current
+    return
+.end
+
+.function: returns_closure/0
+    closure %2 current foo/0
+    integer %1 current 42
+    capture %2 current %1 %1 current
+    move %0 current %2 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call %1 current returns_closure/0
+    frame %0 %0
+    call void  %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,16 @@
+.function: a_closure/0
+    print %1 current
+    return
+.end
+
+.function: main/1
+    closure %1 current a_closure/0
+    string %2 current "Hello World!"
+    capturemove %1 current %1 %2 current
+    isnull %3 current %2 current
+    print %3 current
+    frame %0 %16
+    call void  %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,41 @@
+.function: forty_two/0
+    integer %0 current 42
+    return
+.end
+
+.function: write_through/0
+    integer %1 current 1
+    print %1 current
+    frame %0 %16
+    call %1 current forty_two/0
+    print %1 current
+    text %2 current "moved in"
+    move %1 current %2 current
+    return
+.end
+
+.function: move_out/0
+    print %1 current
+    move %2 current %1 current
+    integer %2 current 100
+    integer %1 current 7
+    print %1 current
+    return
+.end
+
+.function: main/0
+    closure %2 current write_through/0
+    integer %1 current 0
+    capture %2 current %1 %1 current
+    frame %0 %16
+    call void  %2 current
+    print %1 current
+    integer %1 current 2
+    closure %3 current move_out/0
+    capture %3 current %1 %1 current
+    frame %0 %16
+    call void  %3 current
+    print %1 current
+    izero %0 local
+    return
+.end
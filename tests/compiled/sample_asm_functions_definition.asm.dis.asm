@@ -0,0 +1,6 @@
+.function: main/1
+    integer %1 current 42
+    print %1 current
+    izero %0 local
+    return
+.end
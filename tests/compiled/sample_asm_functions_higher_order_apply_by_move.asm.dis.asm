@@ -0,0 +1,27 @@
+.function: square/1
+    arg %1 current %0
+    mul %0 current %1 current %1 current
+    return
+.end
+
+.function: apply/2
+    frame %1 %16
+    arg %2 current %1
+    pamv %0 %2 current
+    arg %1 current %0
+    call %3 current  %1 current
+    move %0 current %3 current
+    return
+.end
+
+.function: main/1
+    integer %1 current 5
+    function %2 current square/1
+    frame %2 %16
+    param %0 %2 current
+    pamv %1 %1 current
+    call %3 current apply/2
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,54 @@
+.function: is_divisible_by_2/1
+    arg %1 current %0
+    integer %2 current 2
+    lt %3 current %1 current %2 current
+    if %3 current 0x5f 0x43
+    sub %1 current %1 current %2 current
+    jump 0x19
+    move %0 current %1 current
+    not %0 current %0 current
+    return
+.end
+
+.function: filter/2
+    arg %1 current %0
+    arg %2 current %1
+    vector %3 current %0 current %0
+    izero %4 current
+    vlen %5 current %2 current
+    gte %6 current %4 current %5 current
+    if %6 current 0x153 0xe5
+    frame %1 %16
+    vat %7 current %2 current %4
+    param %0 *7 current
+    call %8 current  %1 current
+    if %8 current 0x136 0x143
+    vpush %3 current *7 current
+    iinc %4 current
+    jump 0xbb
+    move %0 current %3 current
+    return
+.end
+
+.function: main/1
+    vector %1 current %0 current %0
+    integer %2 current 1
+    vpush %1 current %2 current
+    integer %2 current 2
+    vpush %1 current %2 current
+    integer %2 current 3
+    vpush %1 current %2 current
+    integer %2 current 4
+    vpush %1 current %2 current
+    integer %2 current 5
+    vpush %1 current %2 current
+    print %1 current
+    frame %2 %16
+    function %3 current is_divisible_by_2/1
+    param %0 %3 current
+    param %1 %1 current
+    call %4 current filter/2
+    print %4 current
+    izero %0 local
+    return
+.end
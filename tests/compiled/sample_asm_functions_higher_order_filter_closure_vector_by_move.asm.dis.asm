@@ -0,0 +1,62 @@
+.function: is_divisible_by/1
+    arg %1 current %0
+    lt %3 current %1 current %2 current
+    if %3 current 0x53 0x37
+    sub %1 current %1 current %2 current
+    jump 0xd
+    copy %0 current %1 current
+    not %0 current %0 current
+    return
+.end
+
+.function: is_divisible_by_2/0
+    closure %1 current is_divisible_by/1
+    integer %2 current 2
+    capturemove %1 current %2 %2 current
+    move %0 current %1 current
+    return
+.end
+
+.function: filter_closure/2
+    arg %1 current %0
+    arg %2 current %1
+    vector %3 current %0 current %0
+    izero %4 current
+    vlen %5 current %2 current
+    gte %6 current %4 current %5 current
+    if %6 current 0x18d 0x11f
+    frame %1 %0
+    vat %7 current %2 current %4
+    param %0 *7 current
+    call %8 current  %1 current
+    if %8 current 0x170 0x17d
+    vpush %3 current *7 current
+    iinc %4 current
+    jump 0xf5
+    move %0 current %3 current
+    return
+.end
+
+.function: main/1
+    vector %1 current %0 current %0
+    integer %2 current 1
+    vpush %1 current %2 current
+    integer %2 current 2
+    vpush %1 current %2 current
+    integer %2 current 3
+    vpush %1 current %2 current
+    integer %2 current 4
+    vpush %1 current %2 current
+    integer %2 current 5
+    vpush %1 current %2 current
+    print %1 current
+    frame %0 %16
+    call %3 current is_divisible_by_2/0
+    frame %2 %16
+    param %0 %3 current
+    pamv %1 %1 current
+    call %4 current filter_closure/2
+    print %4 current
+    izero %0 local
+    return
+.end
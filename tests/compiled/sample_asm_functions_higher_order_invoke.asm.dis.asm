@@ -0,0 +1,59 @@
+.function: sum/4
+    arg %4 current %3
+    arg %3 current %2
+    arg %1 current %0
+    arg %2 current %1
+    add %0 current %1 current %2 current
+    add %0 current %3 current %0 current
+    add %0 current %4 current %0 current
+    return
+.end
+
+.function: invoke/2
+    arg %1 local %0
+    arg %2 local %1
+    vlen %3 local %2 local
+    frame @3 %16
+    izero %4 local
+    gte %5 local %4 local %3 local
+    if %5 local 0x110 0xd3
+    vat %6 local %2 local %4
+    copy %7 local *6 local
+    pamv @4 %7 local
+    iinc %4 local
+    jump 0xa9
+    call %8 local  %1 local
+    move %0 local %8 local
+    return
+.end
+
+.function: main/1
+    vector %1 current %0 current %0
+    integer %2 current 20
+    vpush %1 current %2 current
+    integer %3 current 16
+    vpush %1 current %3 current
+    integer %4 current 8
+    vpush %1 current %4 current
+    integer %5 current -2
+    vpush %1 current %5 current
+    integer %2 current 20
+    integer %3 current 16
+    integer %4 current 8
+    integer %5 current -2
+    frame %4 %16
+    param %0 %2 current
+    param %1 %3 current
+    param %2 %4 current
+    param %3 %5 current
+    call %6 current sum/4
+    print %6 current
+    frame %2 %16
+    function %7 current sum/4
+    param %0 %7 current
+    param %1 %1 current
+    call %8 current invoke/2
+    print %8 current
+    izero %0 local
+    return
+.end
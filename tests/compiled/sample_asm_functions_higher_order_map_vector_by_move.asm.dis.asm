@@ -0,0 +1,57 @@
+.function: square/1
+    arg %1 current %0
+    mul %0 current %1 current %1 current
+    return
+.end
+
+.function: apply/2
+    frame %1 %16
+    arg %2 current %1
+    param %0 %2 current
+    arg %1 current %0
+    call %3 current  %1 current
+    move %0 current %3 current
+    return
+.end
+
+.function: map/2
+    arg %1 current %0
+    arg %2 current %1
+    vector %3 current %0 current %0
+    izero %4 current
+    vlen %5 current %2 current
+    gte %6 current %4 current %5 current
+    if %6 current 0x132 0xdb
+    frame %1 %16
+    vat %7 current %2 current %4
+    param %0 *7 current
+    call %8 current  %1 current
+    vpush %3 current %8 current
+    iinc %4 current
+    jump 0xb1
+    move %0 current %3 current
+    return
+.end
+
+.function: main/1
+    vector %1 current %0 current %0
+    integer %2 current 1
+    vpush %1 current %2 current
+    integer %2 current 2
+    vpush %1 current %2 current
+    integer %2 current 3
+    vpush %1 current %2 current
+    integer %2 current 4
+    vpush %1 current %2 current
+    integer %2 current 5
+    vpush %1 current %2 current
+    print %1 current
+    frame %2 %16
+    function %3 current square/1
+    param %0 %3 current
+    pamv %1 %1 current
+    call %4 current map/2
+    print %4 current
+    izero %0 local
+    return
+.end
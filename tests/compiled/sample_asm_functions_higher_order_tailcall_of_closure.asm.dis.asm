@@ -0,0 +1,19 @@
+.function: test/0
+    integer %2 current 42
+    closure %1 current closure/0
+    capturemove %1 current %1 %2 current
+    frame %0 %16
+    tailcall  %1 current
+.end
+
+.function: main/0
+    frame %0 %16
+    call void test/0
+    izero %0 local
+    return
+.end
+
+.function: closure/0
+    throw %1 current
+    return
+.end
@@ -0,0 +1,18 @@
+.function: foo/0
+    function %1 current bar/0
+    frame %0 %16
+    tailcall  %1 current
+.end
+
+.function: bar/0
+    integer %1 current 42
+    throw %1 current
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    call void foo/0
+    izero %0 local
+    return
+.end
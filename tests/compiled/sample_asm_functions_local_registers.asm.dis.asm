@@ -0,0 +1,14 @@
+.function: set_666/0
+    integer %2 global 666
+    return
+.end
+
+.function: main/1
+    integer %2 local 42
+    frame %0 %16
+    call void set_666/0
+    print %2 local
+    print %2 global
+    izero %0 local
+    return
+.end
@@ -0,0 +1,36 @@
+.function: foo/0
+    integer %1 current 42
+    print %1 current
+    return
+.end
+
+.function: bar/0
+    integer %1 current 69
+    print %1 current
+    frame %0 %16
+    call void foo/0
+    return
+.end
+
+.function: baz/0
+    integer %1 current 1995
+    print %1 current
+    frame %0 %16
+    call void bar/0
+    return
+.end
+
+.function: bay/0
+    integer %1 current 2015
+    print %1 current
+    frame %0 %16
+    call void baz/0
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call void bay/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,25 @@
+; external block signatures
+.bsignature: misc::argsvector
+
+.function: foo/4
+    import "misc"
+    try
+    enter misc::argsvector
+    print %1 current
+    return
+.end
+
+.function: main/1
+    frame %4 %16
+    integer %1 current 0
+    param %0 %1 current
+    integer %2 current 1
+    param %1 %2 current
+    integer %3 current 2
+    param %2 %3 current
+    integer %4 current 3
+    param %3 %4 current
+    call void foo/4
+    izero %0 local
+    return
+.end
@@ -0,0 +1,17 @@
+.function: foo/1
+    arg %1 local %0
+    print %1 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/1
+    new %1 local Object
+    print %1 local
+    frame %1 %16
+    pamv %0 %1 local
+    call %1 local foo/1
+    print %1 local
+    izero %0 local
+    return
+.end
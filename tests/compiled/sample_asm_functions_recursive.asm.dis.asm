@@ -0,0 +1,24 @@
+.function: recursive/2
+    arg %1 current %0
+    arg %2 current %1
+    idec %1 current
+    lt %3 current %1 current %2 current
+    if %3 current 0x87 0x4b
+    print %1 current
+    frame %2 %16
+    param %0 %1 current
+    pamv %1 %2 current
+    call void recursive/2
+    return
+.end
+
+.function: main/1
+    frame %2 %16
+    integer %1 current 10
+    param %0 %1 current
+    integer %2 current 0
+    pamv %1 %2 current
+    call void recursive/2
+    izero %0 local
+    return
+.end
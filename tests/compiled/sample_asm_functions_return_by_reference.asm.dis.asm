@@ -0,0 +1,16 @@
+.function: main/1
+    integer %1 current 69
+    closure %2 current by_reference/0
+    capture %2 current %1 %1 current
+    frame %0 %16
+    call %3 current  %2 current
+    integer %3 current 42
+    print %1 current
+    izero %0 local
+    return
+.end
+
+.function: by_reference/0
+    move %0 current %1 current
+    return
+.end
@@ -0,0 +1,28 @@
+.function: counter/1
+    isnull %2 local %1 static
+    not %2 local %2 local
+    if %2 local 0x5f 0x31
+    integer %1 static 0
+    integer %1 local 0
+    arg %3 local %0
+    jump 0xaa
+    iinc %1 static
+    arg %3 local %0
+    lt %4 local %1 static %3 local
+    not %4 current %4 current
+    if %4 current 0xd6 0xaa
+    print %1 static
+    frame %1 %16
+    param %0 %3 current
+    tailcall counter/1
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    integer %1 current 10
+    param %0 %1 current
+    call void counter/1
+    izero %0 local
+    return
+.end
@@ -0,0 +1,31 @@
+.function: tick_b/0
+    isnull %1 local %1 static
+    if %1 current 0x24 0x30
+    integer %1 static 100
+    iinc %1 static
+    copy %0 local %1 static
+    return
+.end
+
+.function: tick_a/0
+    isnull %1 local %1 static
+    if %1 current 0x69 0x70
+    izero %1 static
+    iinc %1 static
+    frame %0 %16
+    tailcall tick_b/0
+.end
+
+.function: main/0
+    frame %0 %16
+    call %1 local tick_a/0
+    print %1 local
+    frame %0 %16
+    call %1 local tick_a/0
+    print %1 local
+    frame %0 %16
+    call %1 local tick_a/0
+    print %1 local
+    izero %0 local
+    return
+.end
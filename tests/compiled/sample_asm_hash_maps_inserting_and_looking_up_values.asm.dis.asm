@@ -0,0 +1,37 @@
+.function: main/0
+    hashmap %1 local
+    integer %2 local 1
+    string %3 local "integer"
+    hashmapinsert %1 local %2 local %3 local
+    float %4 local 1.5
+    string %3 local "float"
+    hashmapinsert %1 local %4 local %3 local
+    atom %5 local 'answer'
+    integer %3 local 42
+    hashmapinsert %1 local %5 local %3 local
+    string %6 local "Hello"
+    string %3 local "string"
+    hashmapinsert %1 local %6 local %3 local
+    text %7 local "World"
+    string %3 local "text"
+    hashmapinsert %1 local %7 local %3 local
+    bits %8 local 0x0a
+    string %3 local "bits"
+    hashmapinsert %1 local %8 local %3 local
+    hashmaplookup %9 local %1 local %2 local
+    print *9 local
+    hashmaplookup %9 local %1 local %4 local
+    print *9 local
+    hashmaplookup %9 local %1 local %5 local
+    print *9 local
+    hashmaplookup %9 local %1 local %6 local
+    print *9 local
+    hashmaplookup %9 local %1 local %7 local
+    print *9 local
+    hashmaplookup %9 local %1 local %8 local
+    print *9 local
+    hashmapsize %10 local %1 local
+    print %10 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,19 @@
+.function: main/0
+    hashmap %1 local
+    integer %2 local 1
+    string %3 local "integer"
+    hashmapinsert %1 local %2 local %3 local
+    float %2 local 1
+    string %3 local "float"
+    hashmapinsert %1 local %2 local %3 local
+    atom %2 local 'one'
+    string %3 local "atom"
+    hashmapinsert %1 local %2 local %3 local
+    string %2 local "one"
+    string %3 local "string"
+    hashmapinsert %1 local %2 local %3 local
+    hashmapsize %4 local %1 local
+    print %4 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,28 @@
+.function: main/0
+    hashmap %1 local
+    izero %2 local
+    integer %3 local 1000
+    gte %4 local %2 local %3 local
+    if %4 local 0x7a 0x44
+    mul %5 local %2 local %2 local
+    hashmapinsert %1 local %2 local %5 local
+    iinc %2 local
+    jump 0x1a
+    izero %2 local
+    integer %6 local 2
+    gte %4 local %2 local %3 local
+    if %4 local 0xe1 0xb7
+    hashmapremove void %1 local %2 local
+    add %2 local %2 local %6 local
+    jump 0x8d
+    hashmapsize %7 local %1 local
+    print %7 local
+    integer %2 local 999
+    hashmaplookup %8 local %1 local %2 local
+    print *8 local
+    integer %2 local 500
+    hashmapcontains %9 local %1 local %2 local
+    print %9 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    hashmap %1 local
+    integer %2 local 42
+    atom %3 local 'answer'
+    hashmapinsert %1 local %2 local %3 local
+    hashmapkeys %4 local %1 local
+    print %4 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,18 @@
+.function: main/0
+    hashmap %1 local
+    integer %2 local 1
+    integer %3 local 42
+    hashmapinsert %1 local %2 local %3 local
+    integer %4 local 2
+    integer %3 local 666
+    hashmapinsert %1 local %4 local %3 local
+    hashmapremove %5 local %1 local %4 local
+    print %5 local
+    hashmapremove void %1 local %2 local
+    hashmapsize %6 local %1 local
+    print %6 local
+    hashmapcontains %7 local %1 local %2 local
+    print %7 local
+    izero %0 local
+    return
+.end
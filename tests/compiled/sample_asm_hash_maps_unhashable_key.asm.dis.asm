@@ -0,0 +1,8 @@
+.function: main/0
+    hashmap %1 local
+    vector %2 local %0 local %0
+    integer %3 local 42
+    hashmapinsert %1 local %2 local %3 local
+    izero %0 local
+    return
+.end
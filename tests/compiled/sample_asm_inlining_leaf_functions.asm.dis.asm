@@ -0,0 +1,67 @@
+.function: square/1
+    arg %1 current %0
+    mul %0 current %1 current %1 current
+    return
+.end
+
+.function: add3/3
+    arg %1 current %0
+    arg %2 current %1
+    add %0 current %1 current %2 current
+    arg %3 current %2
+    add %0 current %0 current %3 current
+    return
+.end
+
+.function: greet/1
+    text %1 current "Hello World!"
+    print %1 current
+    return
+.end
+
+.function: sum_of_squares/1
+    arg %1 current %0
+    izero %2 current
+    izero %3 current
+    gte %4 current %2 current %1 current
+    if %4 current 0x135 0xd1
+    iinc %2 current
+    copy %6 local %2 current
+    move %8 local %6 local
+    mul %7 local %8 local %8 local
+    move %5 current %7 local
+    delete %8 local
+    add %3 current %3 current %5 current
+    jump 0xa7
+    move %0 current %3 current
+    return
+.end
+
+.function: main/0
+    frame %1 %16
+    integer %1 current 10
+    param %0 %1 current
+    call %2 current sum_of_squares/1
+    print %2 current
+    integer %3 current 1
+    copy %7 local %3 current
+    integer %4 current 2
+    copy %8 local %4 current
+    integer %5 current 3
+    move %9 local %5 current
+    move %11 local %7 local
+    move %12 local %8 local
+    add %10 local %11 local %12 local
+    move %13 local %9 local
+    add %10 local %10 local %13 local
+    move %6 current %10 local
+    delete %11 local
+    delete %12 local
+    delete %13 local
+    print %6 current
+    frame %1 %16
+    param %0 %6 current
+    call void greet/1
+    izero %0 local
+    return
+.end
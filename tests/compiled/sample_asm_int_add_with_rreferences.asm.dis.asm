@@ -0,0 +1,9 @@
+.function: main/1
+    integer %1 current -1
+    integer %2 current 1
+    integer %3 current 2
+    add %4 current %1 current @3 current
+    print %4 current
+    izero %0 local
+    return
+.end
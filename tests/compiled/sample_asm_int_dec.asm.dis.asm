@@ -0,0 +1,7 @@
+.function: main/1
+    integer %1 current 2
+    idec %1 current
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    integer %1 current 4
+    integer %2 current 4
+    div %3 current %1 current %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    integer %1 current 4
+    integer %2 current 1
+    gt %1 current %1 current %2 current
+    print %1 current
+    izero %0 local
+    return
+.end
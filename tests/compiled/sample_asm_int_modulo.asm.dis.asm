@@ -0,0 +1,13 @@
+.function: main/1
+    integer %1 current 166737
+    integer %2 current 176
+    copy %3 current %1 current
+    lt %4 current %1 current %2 current
+    if %4 current 0x88 0x4f
+    div %1 current %1 current %2 current
+    mul %1 current %1 current %2 current
+    sub %3 current %3 current %1 current
+    print %3 current
+    izero %0 local
+    return
+.end
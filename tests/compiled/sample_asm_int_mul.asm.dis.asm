@@ -0,0 +1,10 @@
+.function: main/1
+    integer %1 current 4
+    integer %2 current 4
+    integer %3 current -15
+    mul %4 current %1 current %2 current
+    add %3 current %4 current %3 current
+    print %3 current
+    izero %0 local
+    return
+.end
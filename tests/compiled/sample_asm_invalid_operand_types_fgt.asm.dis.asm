@@ -0,0 +1,10 @@
+.function: main/1
+    class %1 current Foo
+    register %1 current
+    new %1 current Foo
+    float %2 current 1
+    gt %3 current %1 current %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    function %1 current main/1
+    idec %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: main/1
+    class %1 current Foo
+    register %1 current
+    new %1 current Foo
+    class %2 current Bar
+    register %2 current
+    new %2 current Bar
+    gte %3 current %1 current %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/1
+    class %1 current Foo
+    register %1 current
+    new %1 current Foo
+    iinc %1 current
+    izero %0 local
+    return
+.end
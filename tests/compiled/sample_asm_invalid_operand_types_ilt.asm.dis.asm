@@ -0,0 +1,8 @@
+.function: main/1
+    string %1 current "Hello"
+    string %2 current "World!"
+    lt %3 current %2 current %1 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/1
+    string %1 current "Hello"
+    class %2 current Foo
+    register %2 current
+    new %2 current Foo
+    lte %3 current %2 current %1 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,35 @@
+.function: iterfib/1
+    integer %2 current -1
+    integer %3 current -2
+    isnull %4 current %1 current
+    not %4 current %4 current
+    if %4 current 0x8e 0x49
+    vector %1 current %0 current %0
+    integer %4 current 1
+    vpush %1 current %4 current
+    integer %4 current 1
+    vpush %1 current %4 current
+    arg %5 current %0
+    vlen %6 current %1 current
+    lt %8 current %6 current %5 current
+    not %8 current %8 current
+    if %8 current 0x12e 0xdf
+    vat %9 current %1 current %2
+    vat %10 current %1 current %3
+    add %7 current *9 current *10 current
+    vpush %1 current %7 current
+    jump 0x9b
+    vat %11 current %1 current %2
+    copy %0 current *11 current
+    return
+.end
+
+.function: main/1
+    frame %1 %16
+    integer %1 current 45
+    param %0 %1 current
+    call %2 current iterfib/1
+    print %2 current
+    izero %0 local
+    return
+.end
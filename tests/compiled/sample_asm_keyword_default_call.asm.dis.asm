@@ -0,0 +1,10 @@
+.function: foo/0
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    call void foo/0
+    izero %0 local
+    return
+.end
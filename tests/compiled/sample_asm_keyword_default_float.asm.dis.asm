@@ -0,0 +1,6 @@
+.function: main/0
+    float %1 current 0
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    string %1 current "default: "
+    echo %1 current
+    string %2 current ""
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    string %1 current "Hello World!"
+    integer %2 current 42
+    print %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,18 @@
+.function: sample/2
+    arg %1 current %0
+    print %1 current
+    arg %1 current %1
+    print %1 current
+    return
+.end
+
+.function: main/0
+    frame %2 %16
+    string %1 current "Hello World!"
+    pamv %0 %1 current
+    integer %1 current 42
+    pamv %1 %1 current
+    call void sample/2
+    izero %0 local
+    return
+.end
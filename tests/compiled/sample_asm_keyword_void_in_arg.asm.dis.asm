@@ -0,0 +1,13 @@
+.function: foo/1
+    arg void %0
+    return
+.end
+
+.function: main/0
+    frame %1 %16
+    izero %1 current
+    pamv %0 %1 current
+    call void foo/1
+    izero %0 local
+    return
+.end
@@ -0,0 +1,11 @@
+.function: foo/0
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process %1 current foo/0
+    join void %1 current infinity
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: greeter/0
+    string %1 current "Hello World!"
+    print %1 current
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    process void greeter/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,16 @@
+.function: sender/1
+    arg %1 current %0
+    string %2 current "Hello World!"
+    send %1 current %2 current
+    return
+.end
+
+.function: main/0
+    frame %1 %16
+    self %1 current
+    pamv %0 %1 current
+    process void sender/1
+    receive void infinity
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    string %1 local "bar"
+    string %2 local "foo"
+    new %3 local Object
+    insert %3 local %2 local %1 local
+    remove void %3 local %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,9 @@
+.function: main/0
+    vector %1 current %0 current %0
+    integer %2 current 0
+    vpush %1 current %2 current
+    vpop void %1 current void
+    print %1 current
+    izero %0 local
+    return
+.end
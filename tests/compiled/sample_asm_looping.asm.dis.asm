@@ -0,0 +1,13 @@
+.function: main/1
+    integer %1 current 0
+    integer %2 current 10
+    lt %3 current %1 current %2 current
+    not %3 current %3 current
+    if %3 current 0x66 0x4f
+    print %1 current
+    iinc %1 current
+    jump 0x18
+    print %1 current
+    izero %0 local
+    return
+.end
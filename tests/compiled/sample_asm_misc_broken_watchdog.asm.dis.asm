@@ -0,0 +1,38 @@
+.function: supervisor_function/0
+    return
+.end
+
+.function: will_be_killed_by_a_runaway_exception/0
+    integer %1 current 80
+    string %3 current "iterations left: "
+    if %1 current 0x3e 0x5c
+    echo %3 current
+    idec %1 current
+    print %1 current
+    jump 0x27
+    string %2 current "Hello runaway World!"
+    throw %2 current
+    return
+.end
+
+.function: std::util::cpu::cycle/1
+    arg %1 current %0
+    integer %4 current 9
+    sub %1 current %1 current %4 current
+    integer %4 current 2
+    div %1 current %1 current %4 current
+    izero %2 current
+    lte %3 current %1 current %2 current
+    if %3 current 0x10d 0xfd
+    idec %1 current
+    jump 0xd3
+    return
+.end
+
+.function: main/1
+    watchdog supervisor_function/0
+    string %3 current "main/1 exiting"
+    print %3 current
+    izero %0 local
+    return
+.end
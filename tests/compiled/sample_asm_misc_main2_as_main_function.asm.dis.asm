@@ -0,0 +1,12 @@
+.function: main/2
+    string %1 current "Hello World!"
+    print %1 current
+    string %1 current "received "
+    echo %1 current
+    argc %1 current
+    echo %1 current
+    string %1 current " arguments"
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,20 @@
+.block: foo/0__nested__bar
+    leave
+.end
+
+.block: main/0__nested__bar
+    leave
+.end
+
+.function: foo/0
+    try
+    enter foo/0__nested__bar
+    return
+.end
+
+.function: main/0
+    try
+    enter main/0__nested__bar
+    izero %0 local
+    return
+.end
@@ -0,0 +1,11 @@
+.function: main/1
+    new %1 current Object
+    string %2 current "foo"
+    integer %3 current 42
+    print %3 current
+    insert %1 current %2 current %3 current
+    remove %4 current %1 current %2 current
+    print %4 current
+    izero %0 local
+    return
+.end
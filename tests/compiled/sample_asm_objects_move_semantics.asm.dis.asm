@@ -0,0 +1,11 @@
+.function: main/1
+    new %1 current Object
+    new %2 current Object
+    print %2 current
+    string %3 current "foo"
+    insert %1 current %3 current %2 current
+    remove %4 current %1 current %3 current
+    print %4 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,15 @@
+.function: main/0
+    string %2 current "Hello World!"
+    ptr %1 current %2 current
+    closure %3 current printer/0
+    capturecopy %3 current %1 *1 current
+    frame %0 %16
+    call void  %3 current
+    izero %0 local
+    return
+.end
+
+.function: printer/0
+    print %1 current
+    return
+.end
@@ -0,0 +1,33 @@
+.function: add/2
+    arg %1 current %0
+    arg %2 current %0
+    add %0 current %1 current %2 current
+    return
+.end
+
+.function: multiply/2
+    arg %1 current %0
+    arg %2 current %0
+    mul %0 current %1 current %2 current
+    return
+.end
+
+.function: main/0
+    function %1 current add/2
+    function %2 current multiply/2
+    integer %3 current 1
+    ptr %4 current %1 current
+    frame %2 %16
+    param %0 %3 current
+    param %1 %3 current
+    call %5 current  *4 current
+    print %5 current
+    ptr %4 current %2 current
+    frame %2 %16
+    param %0 %3 current
+    param %1 %3 current
+    call %5 current  *4 current
+    print %5 current
+    izero %0 local
+    return
+.end
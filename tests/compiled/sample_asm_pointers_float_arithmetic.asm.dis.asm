@@ -0,0 +1,10 @@
+.function: main/0
+    float %2 current 2.14
+    ptr %1 current %2 current
+    float %4 current 1.41
+    ptr %3 current %4 current
+    add %5 current *1 current *3 current
+    print %5 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/0
+    string %2 current "Hello World!"
+    ptr %1 current %2 current
+    print *1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,11 @@
+.function: main/0
+    integer %2 current 0
+    ptr %1 current %2 current
+    if *1 current 0x30 0x46
+    string %3 current "Yeah"
+    jump 0x53
+    string %3 current "Nope"
+    print %3 current
+    izero %0 local
+    return
+.end
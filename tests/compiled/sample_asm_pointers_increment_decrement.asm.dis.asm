@@ -0,0 +1,10 @@
+.function: main/0
+    integer %2 current 42
+    ptr %1 current %2 current
+    iinc *1 current
+    print %2 current
+    idec *1 current
+    print %2 current
+    izero %0 local
+    return
+.end
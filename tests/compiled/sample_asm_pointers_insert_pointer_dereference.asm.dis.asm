@@ -0,0 +1,11 @@
+.function: main/0
+    string %2 current "bar"
+    ptr %1 current %2 current
+    new %3 current Object
+    string %4 current "foo"
+    insert %3 current %4 current *1 current
+    print %3 current
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    string %1 current "bar"
+    new %2 current Object
+    string %4 current "foo"
+    ptr %3 current %4 current
+    insert %2 current *3 current %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
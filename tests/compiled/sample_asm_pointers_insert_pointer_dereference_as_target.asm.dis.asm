@@ -0,0 +1,10 @@
+.function: main/0
+    string %1 current "bar"
+    new %3 current Object
+    ptr %2 current %3 current
+    string %4 current "foo"
+    insert *2 current %4 current %1 current
+    print %3 current
+    izero %0 local
+    return
+.end
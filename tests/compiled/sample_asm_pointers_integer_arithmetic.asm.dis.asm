@@ -0,0 +1,10 @@
+.function: main/0
+    integer %2 current 23
+    ptr %1 current %2 current
+    integer %4 current 19
+    ptr %3 current %4 current
+    add %5 current *1 current *3 current
+    print %5 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    integer %2 current 0
+    ptr %1 current %2 current
+    not %3 current *1 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,8 @@
+.function: main/0
+    string %2 current "3.14"
+    ptr %1 current %2 current
+    stof %3 current *1 current
+    print %3 current
+    izero %0 local
+    return
+.end
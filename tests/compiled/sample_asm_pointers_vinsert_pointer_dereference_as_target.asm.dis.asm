@@ -0,0 +1,10 @@
+.function: main/0
+    vector %2 current %0 current %0
+    ptr %1 current %2 current
+    integer %3 current 0
+    izero %0 local
+    vinsert *1 current %3 current %0 local
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,10 @@
+.function: main/0
+    vector %1 current %0 current %0
+    integer %3 current 0
+    ptr %2 current %3 current
+    vpush %1 current *2 current
+    print %1 current
+    print %3 current
+    izero %0 local
+    return
+.end
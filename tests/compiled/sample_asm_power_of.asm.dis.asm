@@ -0,0 +1,37 @@
+.function: dummy/0
+    izero %0 local
+    return
+.end
+
+.function: power_of/2
+    arg %1 current %0
+    arg %2 current %1
+    izero %3 current
+    eq %4 current %2 current %3 current
+    not %4 current %4 current
+    if %4 current 0x75 0x60
+    integer %6 current 1
+    jump 0xdc
+    integer %5 current 1
+    copy %6 current %1 current
+    lt %4 current %5 current %2 current
+    if %4 current 0xb8 0xdc
+    mul %6 current %6 current %1 current
+    nop
+    iinc %5 current
+    jump 0x8e
+    move %0 current %6 current
+    return
+.end
+
+.function: main/1
+    frame %2 %16
+    integer %1 current 4
+    param %0 %1 current
+    integer %2 current 3
+    param %1 %2 current
+    call %1 current power_of/2
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,40 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: global_printer/1
+    arg %1 local %0
+    self %2 local
+    send %1 local %2 local
+    receive %2 global 10000ms
+    print %1 global
+    return
+.end
+
+.function: global_writer/2
+    arg %1 global %1
+    arg %1 local %0
+    izero %3 local
+    send %1 local %3 local
+    return
+.end
+
+.function: main/0
+    frame %1 %16
+    self %0 current
+    pamv %0 %0 current
+    process void global_printer/1
+    receive %1 local 10000ms
+    print %1 local
+    frame %2 %16
+    param %0 %1 current
+    string %2 current "Hello World"
+    pamv %1 %2 current
+    process void global_writer/2
+    frame %2 %16
+    param %0 %1 current
+    string %2 current "broken"
+    pamv %1 %2 current
+    process void global_writer/2
+    izero %0 local
+    return
+.end
@@ -0,0 +1,44 @@
+.function: square/1
+    arg %1 local %0
+    mul %0 local %1 local %1 local
+    return
+.end
+
+.function: sum_of_squares/1
+    arg %1 current %0
+    izero %2 current
+    izero %3 current
+    gte %4 current %2 current %1 current
+    if %4 current 0xb3 0x66
+    iinc %2 current
+    frame %1 %16
+    param %0 %2 current
+    call %5 current square/1
+    add %3 current %3 current %5 current
+    jump 0x3c
+    move %0 current %3 current
+    return
+.end
+
+.function: main/0
+    integer %1 current 10
+    izero %3 current
+    eq %2 current %1 current %3 current
+    not %2 current %2 current
+    if %2 current 0x12a 0x10b
+    frame %0 %16
+    call void cold/0
+    jump 0x163
+    frame %1 %16
+    param %0 %1 current
+    call %4 current sum_of_squares/1
+    print %4 current
+    izero %0 local
+    return
+.end
+
+.function: cold/0
+    text %1 local "nothing to do"
+    print %1 local
+    return
+.end
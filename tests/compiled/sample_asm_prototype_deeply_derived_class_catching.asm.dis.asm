@@ -0,0 +1,39 @@
+.block: handler
+    draw %2 current
+    print %2 current
+    leave
+.end
+
+.block: throws_derived
+    new %1 current DeeplyDerived
+    throw %1 current
+    leave
+.end
+
+.function: typesystem_setup/0
+    class %1 current Base
+    register %1 current
+    class %1 current Derived
+    derive %1 current Base
+    register %1 current
+    class %1 current MoreDerived
+    derive %1 current Derived
+    register %1 current
+    class %1 current EvenMoreDerived
+    derive %1 current MoreDerived
+    register %1 current
+    class %1 current DeeplyDerived
+    derive %1 current EvenMoreDerived
+    register %1 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call void typesystem_setup/0
+    try
+    catch "Base" handler
+    enter throws_derived
+    izero %0 local
+    return
+.end
@@ -0,0 +1,24 @@
+.block: handler
+    draw %2 current
+    print %2 current
+    leave
+.end
+
+.block: throws_derived
+    new %1 current Derived
+    throw %1 current
+    leave
+.end
+
+.function: main/1
+    class %1 current Base
+    register %1 current
+    class %1 current Derived
+    derive %1 current Base
+    register %1 current
+    try
+    catch "Base" handler
+    enter throws_derived
+    izero %0 local
+    return
+.end
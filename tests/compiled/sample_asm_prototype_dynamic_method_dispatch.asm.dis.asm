@@ -0,0 +1,80 @@
+; external function signatures
+.signature: std::typesystem::typeof/1
+
+.function: typesystem_setup/0
+    class %1 current Base
+    attach %1 current fn_base/1 good_day/1
+    register %1 current
+    class %1 current Derived
+    derive %1 current Base
+    attach %1 current fn_derived/1 hello/1
+    register %1 current
+    class %1 current MoreDerived
+    derive %1 current Derived
+    attach %1 current fn_more_derived/1 hi/1
+    register %1 current
+    return
+.end
+
+.function: fn_base/1
+    string %1 current "Good day from "
+    echo %1 current
+    frame %1 %16
+    arg %2 local %0
+    ptr %3 local %2 local
+    pamv %0 %3 current
+    call %3 current std::typesystem::typeof/1
+    print %3 current
+    return
+.end
+
+.function: fn_derived/1
+    string %1 current "Hello from "
+    echo %1 current
+    frame %1 %16
+    arg %2 local %0
+    ptr %3 local %2 local
+    pamv %0 %3 current
+    call %3 current std::typesystem::typeof/1
+    print %3 current
+    return
+.end
+
+.function: fn_more_derived/1
+    string %1 current "Hi from "
+    echo %1 current
+    frame %1 %16
+    arg %2 local %0
+    ptr %3 local %2 local
+    pamv %0 %3 current
+    call %3 current std::typesystem::typeof/1
+    print %3 current
+    return
+.end
+
+.function: main/1
+    import "std/typesystem"
+    frame %0 %16
+    call void typesystem_setup/0
+    new %1 current Derived
+    frame %1 %16
+    param %0 %1 current
+    msg void good_day/1
+    frame %1 %16
+    param %0 %1 current
+    msg void hello/1
+    string %3 current ""
+    print %3 current
+    new %2 current MoreDerived
+    frame %1 %16
+    param %0 %2 current
+    msg void good_day/1
+    frame %1 %16
+    param %0 %2 current
+    msg void hello/1
+    frame %1 %16
+    param %0 %2 current
+    msg void hi/1
+    izero %0 local
+    return
+.end
@@ -0,0 +1,21 @@
+; external function signatures
+.signature: interface/1
+
+.function: implementation/1
+    string %1 current "Hello World!"
+    print %1 current
+    return
+.end
+
+.function: main/1
+    class %1 current Class
+    attach %1 current implementation/1 interface/1
+    register %1 current
+    new %2 current Class
+    function %3 current interface/1
+    frame %1 %16
+    param %0 %2 current
+    msg void  %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,45 @@
+.block: handler
+    draw %2 current
+    print %2 current
+    leave
+.end
+
+.block: throws_derived
+    new %1 current Combined
+    throw %1 current
+    leave
+.end
+
+.function: typesystem_setup/0
+    class %1 current BaseA
+    register %1 current
+    class %1 current DerivedA
+    derive %1 current BaseA
+    register %1 current
+    class %1 current MoreDerivedA
+    derive %1 current DerivedA
+    register %1 current
+    class %1 current BaseB
+    register %1 current
+    class %1 current DerivedB
+    derive %1 current BaseB
+    register %1 current
+    class %1 current MoreDerivedB
+    derive %1 current DerivedB
+    register %1 current
+    class %1 current Combined
+    derive %1 current MoreDerivedA
+    derive %1 current MoreDerivedB
+    register %1 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call void typesystem_setup/0
+    try
+    catch "BaseA" handler
+    enter throws_derived
+    izero %0 local
+    return
+.end
@@ -0,0 +1,43 @@
+; external function signatures
+.signature: typesystem::typeof/1
+
+.function: typesystem_setup/0
+    class %1 current Base
+    attach %1 current Base::saySomething/1 hello/1
+    register %1 current
+    class %1 current Derived
+    derive %1 current Base
+    attach %1 current Derived::saySomethingMore/1 hello/1
+    register %1 current
+    return
+.end
+
+.function: Base::saySomething/1
+    string %1 current "Hello Base World!"
+    print %1 current
+    return
+.end
+
+.function: Derived::saySomethingMore/1
+    string %1 current "Hello Derived World!"
+    print %1 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call void typesystem_setup/0
+    frame %1 %16
+    new %1 current Base
+    param %0 %1 current
+    msg void hello/1
+    frame %1 %16
+    new %2 current Derived
+    param %0 %2 current
+    msg void hello/1
+    frame %1 %16
+    param %0 %2 current
+    call void Base::saySomething/1
+    izero %0 local
+    return
+.end
@@ -0,0 +1,53 @@
+.block: handler
+    draw %2 current
+    print %2 current
+    leave
+.end
+
+.block: throws_derived
+    new %1 current Combined
+    throw %1 current
+    leave
+.end
+
+.function: typesystem_setup/0
+    class %0 current SharedBase
+    register %0 current
+    class %1 current SharedDerived
+    register %1 current
+    class %2 current BaseA
+    derive %2 current SharedBase
+    register %2 current
+    class %3 current DerivedA
+    derive %3 current BaseA
+    register %3 current
+    class %4 current MoreDerivedA
+    derive %4 current DerivedA
+    derive %4 current SharedDerived
+    register %4 current
+    class %5 current BaseB
+    derive %5 current SharedBase
+    register %5 current
+    class %6 current DerivedB
+    derive %6 current BaseB
+    register %6 current
+    class %7 current MoreDerivedB
+    derive %7 current DerivedB
+    derive %7 current SharedDerived
+    register %7 current
+    class %8 current Combined
+    derive %8 current MoreDerivedA
+    derive %8 current MoreDerivedB
+    register %8 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    call void typesystem_setup/0
+    try
+    catch "BaseA" handler
+    enter throws_derived
+    izero %0 local
+    return
+.end
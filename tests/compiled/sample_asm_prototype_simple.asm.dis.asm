@@ -0,0 +1,9 @@
+.function: main/1
+    class %1 local Custom
+    print %1 local
+    register %1 local
+    new %1 local Custom
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,19 @@
+.block: handler
+    draw %1 current
+    print %1 current
+    leave
+.end
+
+.block: unregistered_type_instantation
+    new %1 current Nonexistent
+    print %1 current
+    leave
+.end
+
+.function: main/1
+    try
+    catch "Exception" handler
+    enter unregistered_type_instantation
+    izero %0 local
+    return
+.end
@@ -0,0 +1,30 @@
+.function: sum_of_squares/1
+    arg %1 current %0
+    izero %2 current
+    izero %3 current
+    gte %4 current %2 current %1 current
+    if %4 current 0x7b 0x45
+    iinc %2 current
+    mul %4 current %2 current %2 current
+    add %3 current %3 current %4 current
+    jump 0x1b
+    integer %2 current 2
+    div %4 current %3 current %2 current
+    add %0 current %4 current %4 current
+    return
+.end
+
+.function: main/0
+    frame %1 %5
+    integer %1 current 10
+    param %0 %1 current
+    call %2 current sum_of_squares/1
+    print %2 current
+    frame %1 %5
+    integer %1 current 3
+    param %0 %1 current
+    call %3 current sum_of_squares/1
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,16 @@
+.function: foo/0
+    integer %1 current 16
+    integer %16 current 1
+    print %1 current
+    print @1 current
+    print %16 current
+    print @16 current
+    return
+.end
+
+.function: main/1
+    frame %0 %17
+    call void foo/0
+    izero %0 local
+    return
+.end
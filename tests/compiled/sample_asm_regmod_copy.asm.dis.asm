@@ -0,0 +1,7 @@
+.function: main/1
+    integer %1 current 1
+    copy %2 current %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
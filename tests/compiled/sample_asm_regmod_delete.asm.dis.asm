@@ -0,0 +1,8 @@
+.function: main/1
+    integer %1 current 42
+    delete %1 current
+    isnull %2 current %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    isnull %2 current %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
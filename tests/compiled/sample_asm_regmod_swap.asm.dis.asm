@@ -0,0 +1,9 @@
+.function: main/1
+    integer %1 current 0
+    integer %2 current 1
+    swap %1 current %2 current
+    print %1 current
+    print %2 current
+    izero %0 local
+    return
+.end
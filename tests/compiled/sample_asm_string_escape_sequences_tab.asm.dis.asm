@@ -0,0 +1,6 @@
+.function: main/1
+    string %1 current "Hello\tWorld!"
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/0
+    string %1 current ""
+    print %1 current
+    izero %0 local
+    return
+.end
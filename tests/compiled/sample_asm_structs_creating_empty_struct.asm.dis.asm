@@ -0,0 +1,6 @@
+.function: main/0
+    struct %1 local
+    print %1 local
+    izero %0 local
+    return
+.end
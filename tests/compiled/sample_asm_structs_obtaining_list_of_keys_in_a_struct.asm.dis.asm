@@ -0,0 +1,13 @@
+.function: main/0
+    struct %1 local
+    atom %2 local 'answer'
+    integer %3 local 42
+    structinsert %1 local %2 local %3 local
+    atom %2 local 'foo'
+    atom %3 local 'bar'
+    structinsert %1 local %2 local %3 local
+    structkeys %4 local %1 local
+    print %4 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: main/0
+    struct %1 local
+    atom %2 local 'answer'
+    integer %3 local 666
+    structinsert %1 local %2 local %3 local
+    print %1 local
+    integer %3 local 42
+    structinsert %1 local %2 local %3 local
+    print %1 local
+    izero %0 local
+    return
+.end
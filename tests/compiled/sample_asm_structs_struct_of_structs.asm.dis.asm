@@ -0,0 +1,32 @@
+.function: get_good_struct/0
+    struct %1 local
+    atom %2 local 'answer'
+    integer %3 local 42
+    structinsert %1 local %2 local %3 local
+    move %0 local %1 local
+    return
+.end
+
+.function: get_bad_struct/0
+    struct %1 local
+    atom %2 local 'answer'
+    integer %3 local 666
+    structinsert %1 local %2 local %3 local
+    move %0 local %1 local
+    return
+.end
+
+.function: main/0
+    frame %0 %16
+    call %1 local get_good_struct/0
+    frame %0 %16
+    call %2 local get_bad_struct/0
+    struct %3 local
+    atom %4 local 'good'
+    structinsert %3 local %4 local %1 local
+    atom %4 local 'bad'
+    structinsert %3 local %4 local %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
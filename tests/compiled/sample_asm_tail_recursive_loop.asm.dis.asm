@@ -0,0 +1,27 @@
+.function: sum/2
+    arg %1 local %0
+    arg %2 local %1
+    izero %4 local
+    eq %3 local %1 local %4 local
+    if %3 local 0x4b 0x59
+    copy %0 local %2 local
+    return
+    add %2 local %2 local %1 local
+    idec %1 local
+    frame %2 %16
+    pamv %0 %1 local
+    pamv %1 %2 local
+    tailcall sum/2
+.end
+
+.function: main/0
+    frame %2 %16
+    integer %1 local 10000
+    param %0 %1 local
+    izero %2 local
+    param %1 %2 local
+    call %3 local sum/2
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    text %1 current "Hello\nWorld!"
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/0
+    text %1 local "Hello World!"
+    print %1 local
+    izero %0 local
+    return
+.end
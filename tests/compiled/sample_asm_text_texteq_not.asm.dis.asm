@@ -0,0 +1,8 @@
+.function: main/0
+    text %1 local "Hello World!"
+    text %2 local "Adieu World!"
+    texteq %3 local %1 local %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
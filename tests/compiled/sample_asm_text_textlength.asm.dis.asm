@@ -0,0 +1,10 @@
+.function: main/0
+    text %1 local "Hello World!"
+    textlength %2 local %1 local
+    print %2 local
+    text %1 local "Witaj Świecie!"
+    textlength %3 local %1 local
+    print %3 local
+    izero %0 local
+    return
+.end
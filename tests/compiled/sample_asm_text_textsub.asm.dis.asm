@@ -0,0 +1,10 @@
+.function: main/0
+    text %1 local "Hello World!"
+    print %1 local
+    integer %2 local 0
+    integer %3 local 6
+    textsub %4 local %1 local %2 local %3 local
+    print %4 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,16 @@
+.function: main/0
+    vector %1 local %0 local %0
+    integer %0 current 0
+    vpush %1 local %0 current
+    integer %0 current 1
+    vpush %1 local %0 current
+    integer %0 current 2
+    vpush %1 local %0 current
+    integer %0 current 3
+    vpush %1 local %0 current
+    integer %2 local 5
+    integer %0 local 4
+    vinsert %1 local %0 local %2 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: main/1
+    vectorof %1 current 'byte'
+    izero %2 current
+    vpush %1 current %2 current
+    integer %2 current 127
+    vpush %1 current %2 current
+    integer %2 current 255
+    vpush %1 current %2 current
+    print %1 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/1
+    vectorof %1 current 'byte'
+    integer %2 current 256
+    vpush %1 current %2 current
+    izero %0 local
+    return
+.end
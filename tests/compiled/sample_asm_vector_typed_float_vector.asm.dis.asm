@@ -0,0 +1,17 @@
+.function: main/1
+    vectorof %1 current 'float'
+    float %2 current 0.5
+    vpush %1 current %2 current
+    float %2 current 1.25
+    vpush %1 current %2 current
+    izero %4 current
+    vat %3 current %1 current %4
+    integer %4 current 1
+    vat %5 current %1 current %4
+    add %2 current %3 current %5 current
+    print %2 current
+    vlen %4 current %1 current
+    print %4 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,24 @@
+.function: main/1
+    vectorof %1 local 'int'
+    integer %2 local 1
+    vpush %1 local %2 local
+    integer %2 local 2
+    vpush %1 local %2 local
+    integer %2 local 3
+    vpush %1 local %2 local
+    izero %2 local
+    izero %3 local
+    vinsert %1 local %2 local %3 local
+    print %1 local
+    integer %3 local -1
+    vat %4 local %1 local %3
+    add %2 local %4 local %4 local
+    print %2 local
+    vpop %2 local %1 local void
+    print %2 local
+    vlen %2 local %1 local
+    print %2 local
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/1
+    vectorof %1 current 'int'
+    izero %3 local
+    vinsert %1 local %2 local %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/1
+    vectorof %1 current 'int'
+    string %2 current "Hello World!"
+    vpush %1 current %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    vectorof %1 current 'string'
+    print %1 current
+    izero %0 local
+    return
+.end
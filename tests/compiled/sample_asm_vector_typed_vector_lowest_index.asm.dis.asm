@@ -0,0 +1,15 @@
+.function: main/1
+    vectorof %1 current 'int'
+    integer %2 current 42
+    vpush %1 current %2 current
+    integer %3 current -1
+    integer %4 current 2
+    integer %5 current 63
+    if %5 current 0x5f 0x82
+    mul %3 current %3 current %4 current
+    idec %5 current
+    jump 0x48
+    vat %2 current %1 current %3
+    izero %0 local
+    return
+.end
@@ -0,0 +1,6 @@
+.function: main/1
+    vectorof %1 current 'int'
+    vpush %1 current %2 current
+    izero %0 local
+    return
+.end
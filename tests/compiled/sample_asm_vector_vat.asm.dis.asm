@@ -0,0 +1,16 @@
+.function: main/1
+    vector %1 current %0 current %0
+    vlen %2 current %1 current
+    print %2 current
+    string %3 current "Hello World!"
+    vpush %1 current %3 current
+    vlen %2 current %1 current
+    print %2 current
+    integer %5 current -1
+    vat %4 current %1 current %5
+    vlen %2 current %1 current
+    print %2 current
+    print *4 current
+    izero %0 local
+    return
+.end
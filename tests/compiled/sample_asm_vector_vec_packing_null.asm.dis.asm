@@ -0,0 +1,8 @@
+.function: main/0
+    string %2 current "answer to life"
+    integer %3 current 42
+    vector %1 current %2 current %8
+    print %1 current
+    izero %0 local
+    return
+.end
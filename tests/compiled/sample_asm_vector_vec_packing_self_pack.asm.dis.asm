@@ -0,0 +1,8 @@
+.function: main/0
+    string %1 current "answer to life"
+    integer %2 current 42
+    vector %3 current %1 current %3
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,24 @@
+.function: main/1
+    vector %1 local %0 local %0
+    integer %0 local 0
+    string %5 local "sheep!"
+    vinsert %1 local %5 local %0 local
+    string %5 local "Hurr"
+    vinsert %1 local %5 local %0 local
+    integer %0 local 1
+    string %5 local "durr"
+    vinsert %1 local %5 local %0 local
+    integer %0 local 2
+    string %5 local "Im'a"
+    vinsert %1 local %5 local %0 local
+    integer %7 local 0
+    vlen %6 local %1 local
+    lt %8 local %7 local %6 local
+    if %8 local 0xfc 0x126
+    vat %9 local %1 local %7
+    print *9 local
+    iinc %7 local
+    jump 0xd2
+    izero %0 local
+    return
+.end
@@ -0,0 +1,23 @@
+.function: main/1
+    integer %1 current 0
+    vector %2 current %0 current %0
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    copy %3 current %1 current
+    vpush %2 current %3 current
+    vpush %2 current %1 current
+    vlen %3 current %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: main/0
+    vector %1 local %0 local %0
+    integer %2 local 0
+    vpush %1 local %2 local
+    integer %3 local 1
+    vpush %1 local %3 local
+    integer %4 local 0
+    vpop void %1 local %4 local
+    print %1 local
+    izero %0 local
+    return
+.end
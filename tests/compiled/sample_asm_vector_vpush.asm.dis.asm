@@ -0,0 +1,13 @@
+.function: main/1
+    vector %2 current %0 current %0
+    vlen %3 current %2 current
+    print %3 current
+    string %1 current "Hello World!"
+    vpush %2 current %1 current
+    vlen %3 current %2 current
+    print %3 current
+    vpop %4 current %2 current void
+    print %4 current
+    izero %0 local
+    return
+.end
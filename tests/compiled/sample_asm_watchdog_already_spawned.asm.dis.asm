@@ -0,0 +1,64 @@
+.function: watchdog_process/1
+    arg %1 current %0
+    string %2 current "exception"
+    remove %2 current %1 current %2 current
+    string %3 current "function"
+    remove %3 current %1 current %3 current
+    string %4 current "process spawned with <"
+    echo %4 current
+    echo %3 current
+    string %4 current "> killed by >>>"
+    echo %4 current
+    echo %2 current
+    string %4 current "<<<"
+    print %4 current
+    return
+.end
+
+.function: broken_process/0
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    integer %1 current 42
+    throw %1 current
+    return
+.end
+
+.function: main/1
+    watchdog watchdog_process/1
+    watchdog watchdog_process/1
+    frame %0 %16
+    process void broken_process/0
+    izero %0 local
+    return
+.end
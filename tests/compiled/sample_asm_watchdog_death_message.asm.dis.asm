@@ -0,0 +1,99 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: watchdog_process/1
+    arg %1 current %0
+    string %2 current "exception"
+    remove %2 current %1 current %2 current
+    string %3 current "function"
+    remove %3 current %1 current %3 current
+    string %4 current "[WARNING] process '"
+    echo %4 current
+    echo %3 current
+    string %4 current "' killed by >>>"
+    echo %4 current
+    echo %2 current
+    string %4 current "<<<"
+    print %4 current
+    return
+.end
+
+.function: a_detached_concurrent_process/0
+    frame %1 %16
+    integer %1 current 32
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    string %1 current "Hello World (from detached process)!"
+    print %1 current
+    frame %1 %16
+    integer %1 current 512
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    string %1 current "Hello World (from detached process) after a runaway exception!"
+    print %1 current
+    frame %1 %16
+    integer %1 current 512
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    frame %1 %16
+    string %1 current "a_detached_concurrent_process"
+    pamv %0 %1 current
+    call void log_exiting_detached/1
+    return
+.end
+
+.function: a_joined_concurrent_process/0
+    frame %1 %16
+    integer %1 current 128
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    string %1 current "Hello World (from joined process)!"
+    print %1 current
+    frame %1 %16
+    string %1 current "a_joined_concurrent_process"
+    pamv %0 %1 current
+    call void log_exiting_joined/1
+    string %2 current "OH NOES!"
+    throw %2 current
+    return
+.end
+
+.function: log_exiting_main/0
+    string %2 current "process [  main  ]: 'main' exiting"
+    print %2 current
+    return
+.end
+
+.function: log_exiting_detached/1
+    arg %1 current %0
+    string %2 current "process [detached]: '"
+    echo %2 current
+    echo %1 current
+    string %2 current "' exiting"
+    print %2 current
+    return
+.end
+
+.function: log_exiting_joined/1
+    arg %1 current %0
+    string %2 current "process [ joined ]: '"
+    echo %2 current
+    echo %1 current
+    string %2 current "' exiting"
+    print %2 current
+    return
+.end
+
+.function: main/1
+    import "std::misc"
+    watchdog watchdog_process/1
+    frame %0 %16
+    process void a_detached_concurrent_process/0
+    frame %0 %16
+    process %2 current a_joined_concurrent_process/0
+    join %0 current %2 current infinity
+    frame %0 %16
+    call void log_exiting_main/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,49 @@
+; external function signatures
+.signature: undefined_function/0
+
+.function: broken_process/0
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    integer %1 current 42
+    throw %1 current
+    return
+.end
+
+.function: main/1
+    watchdog undefined_function/0
+    frame %0 %16
+    process void broken_process/0
+    izero %0 local
+    return
+.end
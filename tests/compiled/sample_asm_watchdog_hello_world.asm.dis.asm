@@ -0,0 +1,58 @@
+.function: watchdog_process/1
+    arg %1 current %0
+    string %3 current "function"
+    remove %4 current %1 current %3 current
+    string %5 current "process spawned with <"
+    echo %5 current
+    echo %4 current
+    string %5 current "> died"
+    print %5 current
+    return
+.end
+
+.function: broken_process/0
+    watchdog watchdog_process/1
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    nop
+    integer %1 current 42
+    throw %1 current
+    return
+.end
+
+.function: main/1
+    frame %0 %16
+    process void broken_process/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,9 @@
+; external function signatures
+.signature: World::print_hello/0
+
+.function: main/1
+    import "build/test/World"
+    watchdog World::print_hello/0
+    izero %0 local
+    return
+.end
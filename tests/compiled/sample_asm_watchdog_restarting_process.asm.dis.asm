@@ -0,0 +1,136 @@
+; external function signatures
+.signature: std::misc::cycle/1
+
+.function: watchdog_process/1
+    arg %1 current %0
+    string %2 current "exception"
+    remove %2 current %1 current %2 current
+    string %3 current "function"
+    remove %3 current %1 current %3 current
+    string %4 current "parameters"
+    remove %4 current %1 current %4 current
+    string %5 current "[WARNING] process '"
+    echo %5 current
+    echo %3 current
+    echo %4 current
+    string %5 current "' killed by >>>"
+    echo %5 current
+    echo %2 current
+    string %5 current "<<<"
+    print %5 current
+    integer %7 current 1
+    vat %6 current %4 current %7
+    copy %6 current *6 current
+    frame %2 %16
+    integer %0 current 0
+    vat %5 current %4 current %0
+    param %0 *5 current
+    iinc %6 current
+    param %1 %6 current
+    process void a_division_executing_process/2
+    return
+.end
+
+.function: a_detached_concurrent_process/0
+    watchdog watchdog_process/1
+    frame %1 %16
+    integer %1 current 32
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    string %1 current "Hello World (from detached process)!"
+    print %1 current
+    frame %1 %16
+    integer %1 current 512
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    string %1 current "Hello World (from detached process) after a runaway exception!"
+    print %1 current
+    frame %1 %16
+    integer %1 current 512
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    frame %1 %16
+    string %1 current "a_detached_concurrent_process"
+    pamv %0 %1 current
+    call void log_exiting_detached/1
+    return
+.end
+
+.function: formatting/2
+    arg %1 current %0
+    arg %2 current %1
+    string %3 current "#{0} / #{1}"
+    frame %3 %16
+    param %0 %3 current
+    param %1 %1 current
+    param %2 %2 current
+    msg %4 current format/
+    move %0 current %4 current
+    return
+.end
+
+.function: a_division_executing_process/2
+    watchdog watchdog_process/1
+    frame %1 %16
+    integer %1 current 128
+    pamv %0 %1 current
+    call void std::misc::cycle/1
+    arg %1 current %0
+    arg %2 current %1
+    izero %3 current
+    eq %4 current %2 current %3 current
+    if %4 current 0x43b 0x460
+    string %4 current "cannot divide by zero"
+    throw %4 current
+    div %0 current %1 current %2 current
+    echo %1 current
+    string %4 current " / "
+    echo %4 current
+    echo %2 current
+    string %4 current " = "
+    echo %4 current
+    print %0 current
+    return
+.end
+
+.function: log_exiting_main/0
+    string %2 current "process [  main  ]: 'main' exiting"
+    print %2 current
+    return
+.end
+
+.function: log_exiting_detached/1
+    arg %1 current %0
+    string %2 current "process [detached]: '"
+    echo %2 current
+    echo %1 current
+    string %2 current "' exiting"
+    print %2 current
+    return
+.end
+
+.function: log_exiting_joined/0
+    arg %1 current %0
+    string %2 current "process [ joined ]: '"
+    echo %2 current
+    echo %1 current
+    string %2 current "' exiting"
+    print %2 current
+    return
+.end
+
+.function: main/1
+    import "std::misc"
+    frame %0 %16
+    process void a_detached_concurrent_process/0
+    frame %2 %16
+    integer %3 current 42
+    param %0 %3 current
+    integer %4 current 0
+    param %1 %4 current
+    process void a_division_executing_process/2
+    frame %0 %16
+    call void log_exiting_main/0
+    izero %0 local
+    return
+.end
@@ -0,0 +1,22 @@
+; external function signatures
+.signature: std::functional::apply/2
+
+.function: adder/1
+    arg %0 current %0
+    integer %1 current 21
+    add %0 current %0 current %1 current
+    return
+.end
+
+.function: main/1
+    import "std::functional"
+    frame %2 %16
+    function %1 current adder/1
+    pamv %0 %1 current
+    integer %1 current 21
+    pamv %1 %1 current
+    call %1 current std::functional::apply/2
+    print %1 current
+    izero %0 local
+    return
+.end
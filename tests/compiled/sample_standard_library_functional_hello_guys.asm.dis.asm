@@ -0,0 +1,34 @@
+; external function signatures
+.signature: std::functional::apply/2
+
+.function: greetings/1
+    string %1 current "Hello "
+    echo %1 current
+    arg %1 current %0
+    echo %1 current
+    string %1 current "!"
+    print %1 current
+    return
+.end
+
+.function: main/1
+    import "std::functional"
+    function %1 current greetings/1
+    frame %2 %16
+    param %0 %1 current
+    string %2 current "World"
+    param %1 %2 current
+    call void std::functional::apply/2
+    frame %2 %16
+    param %0 %1 current
+    string %2 current "Joe"
+    param %1 %2 current
+    call void std::functional::apply/2
+    frame %2 %16
+    param %0 %1 current
+    string %2 current "Mike"
+    param %1 %2 current
+    call void std::functional::apply/2
+    izero %0 local
+    return
+.end
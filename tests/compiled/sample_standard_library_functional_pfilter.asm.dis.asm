@@ -0,0 +1,38 @@
+; external function signatures
+.signature: std::functional::pfilter/2
+
+.function: is_even/1
+    arg %1 local %0
+    integer %2 local 2
+    div %3 local %1 local %2 local
+    mul %3 local %3 local %2 local
+    eq %0 local %3 local %1 local
+    return
+.end
+
+.function: main/0
+    import "std::functional"
+    vector %1 local %0 local %0
+    izero %2 local
+    integer %3 local 20
+    iinc %2 local
+    copy %4 local %2 local
+    vpush %1 local %4 local
+    lt %5 local %2 local %3 local
+    if %5 local 0x8a 0xd5
+    frame %2 %16
+    function %6 local is_even/1
+    pamv %0 %6 local
+    pamv %1 %1 local
+    call %7 local std::functional::pfilter/2
+    print %7 local
+    frame %2 %16
+    function %6 local is_even/1
+    pamv %0 %6 local
+    vector %1 local %0 local %0
+    pamv %1 %1 local
+    call %7 local std::functional::pfilter/2
+    print %7 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,28 @@
+; external function signatures
+.signature: std::functional::pmap/2
+
+.function: square/1
+    arg %1 local %0
+    mul %0 local %1 local %1 local
+    return
+.end
+
+.function: main/0
+    import "std::functional"
+    vector %1 local %0 local %0
+    izero %2 local
+    integer %3 local 20
+    iinc %2 local
+    copy %4 local %2 local
+    vpush %1 local %4 local
+    lt %5 local %2 local %3 local
+    if %5 local 0x58 0xa3
+    frame %2 %16
+    function %6 local square/1
+    pamv %0 %6 local
+    pamv %1 %1 local
+    call %7 local std::functional::pmap/2
+    print %7 local
+    izero %0 local
+    return
+.end
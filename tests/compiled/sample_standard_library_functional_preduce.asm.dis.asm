@@ -0,0 +1,71 @@
+; external function signatures
+.signature: std::functional::preduce/3
+
+.function: sum/2
+    arg %1 local %0
+    arg %2 local %1
+    add %0 local %1 local %2 local
+    return
+.end
+
+.function: concatenate/2
+    arg %1 local %0
+    arg %2 local %1
+    textconcat %0 local %1 local %2 local
+    return
+.end
+
+.function: main/0
+    import "std::functional"
+    vector %1 local %0 local %0
+    vector %8 local %0 local %0
+    izero %2 local
+    integer %3 local 1000
+    iinc %2 local
+    copy %4 local %2 local
+    vpush %1 local %4 local
+    lt %5 local %2 local %3 local
+    if %5 local 0xa6 0xf1
+    frame %3 %16
+    function %6 local sum/2
+    pamv %0 %6 local
+    izero %9 local
+    pamv %1 %9 local
+    pamv %2 %1 local
+    call %7 local std::functional::preduce/3
+    print %7 local
+    text %9 local "H"
+    vpush %8 local %9 local
+    text %9 local "e"
+    vpush %8 local %9 local
+    text %9 local "l"
+    vpush %8 local %9 local
+    text %9 local "l"
+    vpush %8 local %9 local
+    text %9 local "o"
+    vpush %8 local %9 local
+    text %9 local " "
+    vpush %8 local %9 local
+    text %9 local "W"
+    vpush %8 local %9 local
+    text %9 local "o"
+    vpush %8 local %9 local
+    text %9 local "r"
+    vpush %8 local %9 local
+    text %9 local "l"
+    vpush %8 local %9 local
+    text %9 local "d"
+    vpush %8 local %9 local
+    text %9 local "!"
+    vpush %8 local %9 local
+    frame %3 %16
+    function %6 local concatenate/2
+    pamv %0 %6 local
+    text %9 local ""
+    pamv %1 %9 local
+    pamv %2 %8 local
+    call %7 local std::functional::preduce/3
+    print %7 local
+    izero %0 local
+    return
+.end
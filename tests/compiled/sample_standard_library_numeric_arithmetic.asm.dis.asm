@@ -0,0 +1,43 @@
+; external function signatures
+.signature: std::vector::of_unboxed_ints/1
+.signature: std::numeric::add/2
+.signature: std::numeric::sub/2
+.signature: std::numeric::mul/2
+.signature: std::numeric::div/2
+
+.function: main/1
+    import "std::vector"
+    import "std/numeric"
+    integer %1 local 20
+    frame %1 %16
+    param %0 %1 local
+    call %2 local std::vector::of_unboxed_ints/1
+    frame %2 %16
+    param %0 %2 local
+    param %1 %2 local
+    call %3 local std::numeric::add/2
+    print %3 local
+    frame %2 %16
+    param %0 %2 local
+    param %1 %2 local
+    call %4 local std::numeric::mul/2
+    print %4 local
+    frame %2 %16
+    param %0 %4 local
+    param %1 %3 local
+    call %5 local std::numeric::sub/2
+    print %5 local
+    vectorof %6 local 'int'
+    integer %7 local 20
+    integer %8 local 3
+    vpush %6 local %8 local
+    idec %7 local
+    if %7 local 0x158 0x18f
+    frame %2 %16
+    param %0 %5 local
+    param %1 %6 local
+    call %9 local std::numeric::div/2
+    print %9 local
+    izero %0 local
+    return
+.end
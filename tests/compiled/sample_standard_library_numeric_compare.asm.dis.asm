@@ -0,0 +1,29 @@
+; external function signatures
+.signature: std::vector::of_unboxed_ints/1
+.signature: std::vector::reverse/1
+.signature: std::numeric::lt/2
+.signature: std::numeric::eq/2
+
+.function: main/1
+    import "std::vector"
+    import "std/numeric"
+    integer %1 local 20
+    frame %1 %16
+    param %0 %1 local
+    call %2 local std::vector::of_unboxed_ints/1
+    frame %1 %16
+    param %0 %2 local
+    call %3 local std::vector::reverse/1
+    frame %2 %16
+    param %0 %2 local
+    param %1 %3 local
+    call %4 local std::numeric::lt/2
+    print %4 local
+    frame %2 %16
+    param %0 %3 local
+    param %1 %3 local
+    call %4 local std::numeric::eq/2
+    print %4 local
+    izero %0 local
+    return
+.end
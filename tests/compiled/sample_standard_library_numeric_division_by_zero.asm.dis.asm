@@ -0,0 +1,18 @@
+; external function signatures
+.signature: std::vector::of_unboxed_ints/1
+.signature: std::numeric::div/2
+
+.function: main/1
+    import "std::vector"
+    import "std/numeric"
+    integer %1 local 4
+    frame %1 %16
+    param %0 %1 local
+    call %2 local std::vector::of_unboxed_ints/1
+    frame %2 %16
+    param %0 %2 local
+    param %1 %2 local
+    call void std::numeric::div/2
+    izero %0 local
+    return
+.end
@@ -0,0 +1,41 @@
+; external function signatures
+.signature: std::numeric::sum/1
+.signature: std::numeric::dot/2
+.signature: std::numeric::max/1
+.signature: std::numeric::prefix_sum/1
+
+.function: main/1
+    import "std/numeric"
+    vector %1 local %0 local %0
+    float %2 local 0.5
+    vpush %1 local %2 local
+    float %2 local 1.5
+    vpush %1 local %2 local
+    integer %2 local 2
+    vpush %1 local %2 local
+    frame %1 %16
+    param %0 %1 local
+    call %3 local std::numeric::sum/1
+    print %3 local
+    frame %2 %16
+    param %0 %1 local
+    param %1 %1 local
+    call %3 local std::numeric::dot/2
+    print %3 local
+    frame %1 %16
+    param %0 %1 local
+    call %3 local std::numeric::max/1
+    print %3 local
+    vectorof %4 local 'float'
+    integer %5 local 10
+    float %6 local 0.25
+    vpush %4 local %6 local
+    idec %5 local
+    if %5 local 0x14b 0x185
+    frame %1 %16
+    param %0 %4 local
+    call %3 local std::numeric::prefix_sum/1
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,16 @@
+; external function signatures
+.signature: std::numeric::sum/1
+
+.function: main/1
+    import "std/numeric"
+    vector %1 local %0 local %0
+    integer %2 local 42
+    vpush %1 local %2 local
+    string %2 local "Hello World!"
+    vpush %1 local %2 local
+    frame %1 %16
+    param %0 %1 local
+    call void std::numeric::sum/1
+    izero %0 local
+    return
+.end
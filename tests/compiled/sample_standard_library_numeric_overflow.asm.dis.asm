@@ -0,0 +1,79 @@
+; external function signatures
+.signature: std::numeric::add/2
+.signature: std::numeric::sub/2
+.signature: std::numeric::mul/2
+.signature: std::numeric::dot/2
+.signature: std::numeric::sum/1
+.signature: std::numeric::prefix_sum/1
+
+.function: filled/2
+    arg %1 local %0
+    arg %2 local %1
+    vectorof %0 local 'int'
+    copy %3 local %1 local
+    vpush %0 local %3 local
+    idec %2 local
+    if %2 local 0x25 0x5d
+    return
+.end
+
+.function: main/1
+    import "std/numeric"
+    integer %1 local -1
+    integer %2 local 2
+    integer %3 local 63
+    mul %1 local %1 local %2 local
+    idec %3 local
+    if %3 local 0x8f 0xc0
+    izero %3 local
+    integer %4 local 1
+    add %5 local %1 local %4 local
+    sub %5 local %3 local %5 local
+    integer %6 local 9
+    frame %2 %16
+    param %0 %5 local
+    param %1 %6 local
+    call %7 local filled/2
+    frame %2 %16
+    param %0 %1 local
+    param %1 %6 local
+    call %8 local filled/2
+    frame %2 %16
+    param %0 %4 local
+    param %1 %6 local
+    call %9 local filled/2
+    frame %2 %16
+    param %0 %2 local
+    param %1 %6 local
+    call %10 local filled/2
+    frame %2 %16
+    param %0 %7 local
+    param %1 %9 local
+    call %11 local std::numeric::add/2
+    print %11 local
+    frame %2 %16
+    param %0 %8 local
+    param %1 %9 local
+    call %11 local std::numeric::sub/2
+    print %11 local
+    frame %2 %16
+    param %0 %7 local
+    param %1 %10 local
+    call %11 local std::numeric::mul/2
+    print %11 local
+    frame %1 %16
+    param %0 %7 local
+    call %11 local std::numeric::sum/1
+    print %11 local
+    frame %2 %16
+    param %0 %7 local
+    param %1 %9 local
+    call %11 local std::numeric::dot/2
+    print %11 local
+    frame %1 %16
+    param %0 %7 local
+    call %11 local std::numeric::prefix_sum/1
+    print %11 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,39 @@
+; external function signatures
+.signature: std::vector::of_unboxed_ints/1
+.signature: std::numeric::sum/1
+.signature: std::numeric::min/1
+.signature: std::numeric::max/1
+.signature: std::numeric::dot/2
+.signature: std::numeric::prefix_sum/1
+
+.function: main/1
+    import "std::vector"
+    import "std/numeric"
+    integer %1 local 20
+    frame %1 %16
+    param %0 %1 local
+    call %2 local std::vector::of_unboxed_ints/1
+    frame %1 %16
+    param %0 %2 local
+    call %3 local std::numeric::sum/1
+    print %3 local
+    frame %1 %16
+    param %0 %2 local
+    call %3 local std::numeric::min/1
+    print %3 local
+    frame %1 %16
+    param %0 %2 local
+    call %3 local std::numeric::max/1
+    print %3 local
+    frame %2 %16
+    param %0 %2 local
+    param %1 %2 local
+    call %3 local std::numeric::dot/2
+    print %3 local
+    frame %1 %16
+    param %0 %2 local
+    call %3 local std::numeric::prefix_sum/1
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,17 @@
+; external function signatures
+.signature: std::persistent::map/0
+.signature: std::persistent::lookup/2
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::map/0
+    string %2 local "answer"
+    frame %2 %16
+    param %0 %1 local
+    param %1 %2 local
+    call %3 local std::persistent::lookup/2
+    print %3 local
+    izero %0 local
+    return
+.end
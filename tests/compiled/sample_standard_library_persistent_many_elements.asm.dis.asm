@@ -0,0 +1,81 @@
+; external function signatures
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+.signature: std::persistent::pop/1
+.signature: std::persistent::at/2
+.signature: std::persistent::set/3
+.signature: std::persistent::size/1
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::vector/0
+    izero %2 local
+    integer %3 local 1100
+    gte %4 local %2 local %3 local
+    if %4 local 0xd1 0x7b
+    frame %2 %16
+    param %0 %1 local
+    param %1 %2 local
+    call %1 local std::persistent::push/2
+    iinc %2 local
+    jump 0x51
+    frame %1 %16
+    param %0 %1 local
+    call %5 local std::persistent::size/1
+    print %5 local
+    integer %6 local 1055
+    frame %2 %16
+    param %0 %1 local
+    param %1 %6 local
+    call %5 local std::persistent::at/2
+    print %5 local
+    integer %6 local 1099
+    frame %2 %16
+    param %0 %1 local
+    param %1 %6 local
+    call %5 local std::persistent::at/2
+    print %5 local
+    integer %6 local 1050
+    integer %7 local -1
+    frame %3 %16
+    param %0 %1 local
+    param %1 %6 local
+    param %2 %7 local
+    call %8 local std::persistent::set/3
+    frame %2 %16
+    param %0 %8 local
+    param %1 %6 local
+    call %5 local std::persistent::at/2
+    print %5 local
+    frame %2 %16
+    param %0 %1 local
+    param %1 %6 local
+    call %5 local std::persistent::at/2
+    print %5 local
+    copy %9 local %1 local
+    integer %3 local 1000
+    lte %4 local %2 local %3 local
+    if %4 local 0x34a 0x302
+    frame %1 %16
+    param %0 %9 local
+    call %9 local std::persistent::pop/1
+    idec %2 local
+    jump 0x2d8
+    frame %1 %16
+    param %0 %9 local
+    call %5 local std::persistent::size/1
+    print %5 local
+    integer %6 local 999
+    frame %2 %16
+    param %0 %9 local
+    param %1 %6 local
+    call %5 local std::persistent::at/2
+    print %5 local
+    frame %1 %16
+    param %0 %1 local
+    call %5 local std::persistent::size/1
+    print %5 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,51 @@
+; external function signatures
+.signature: std::persistent::map/0
+.signature: std::persistent::insert/3
+.signature: std::persistent::remove/2
+.signature: std::persistent::lookup/2
+.signature: std::persistent::size/1
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::map/0
+    izero %2 local
+    integer %3 local 200
+    gte %4 local %2 local %3 local
+    if %4 local 0xf0 0x78
+    mul %5 local %2 local %2 local
+    frame %3 %16
+    param %0 %1 local
+    param %1 %2 local
+    param %2 %5 local
+    call %1 local std::persistent::insert/3
+    iinc %2 local
+    jump 0x4e
+    copy %6 local %1 local
+    izero %2 local
+    integer %3 local 190
+    gte %4 local %2 local %3 local
+    if %4 local 0x192 0x13a
+    frame %2 %16
+    param %0 %6 local
+    param %1 %2 local
+    call %6 local std::persistent::remove/2
+    iinc %2 local
+    jump 0x110
+    frame %1 %16
+    param %0 %1 local
+    call %7 local std::persistent::size/1
+    print %7 local
+    frame %1 %16
+    param %0 %6 local
+    call %7 local std::persistent::size/1
+    print %7 local
+    integer %8 local 123
+    frame %2 %16
+    param %0 %1 local
+    param %1 %8 local
+    call %7 local std::persistent::lookup/2
+    print %7 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,65 @@
+; external function signatures
+.signature: std::persistent::map/0
+.signature: std::persistent::insert/3
+.signature: std::persistent::remove/2
+.signature: std::persistent::lookup/2
+.signature: std::persistent::contains/2
+.signature: std::persistent::size/1
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::map/0
+    string %8 local "answer"
+    integer %9 local 42
+    frame %3 %16
+    param %0 %1 local
+    param %1 %8 local
+    param %2 %9 local
+    call %1 local std::persistent::insert/3
+    atom %8 local 'answer'
+    integer %9 local 43
+    frame %3 %16
+    param %0 %1 local
+    param %1 %8 local
+    param %2 %9 local
+    call %1 local std::persistent::insert/3
+    integer %8 local 42
+    string %9 local "the answer"
+    frame %3 %16
+    param %0 %1 local
+    param %1 %8 local
+    param %2 %9 local
+    call %1 local std::persistent::insert/3
+    string %8 local "answer"
+    frame %2 %16
+    param %0 %1 local
+    param %1 %8 local
+    call %2 local std::persistent::remove/2
+    frame %1 %16
+    param %0 %1 local
+    call %3 local std::persistent::size/1
+    print %3 local
+    frame %1 %16
+    param %0 %2 local
+    call %3 local std::persistent::size/1
+    print %3 local
+    frame %2 %16
+    param %0 %1 local
+    param %1 %8 local
+    call %3 local std::persistent::lookup/2
+    print %3 local
+    frame %2 %16
+    param %0 %2 local
+    param %1 %8 local
+    call %3 local std::persistent::contains/2
+    print %3 local
+    integer %8 local 42
+    frame %2 %16
+    param %0 %2 local
+    param %1 %8 local
+    call %3 local std::persistent::lookup/2
+    print %3 local
+    izero %0 local
+    return
+.end
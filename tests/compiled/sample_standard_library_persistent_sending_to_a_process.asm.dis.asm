@@ -0,0 +1,43 @@
+; external function signatures
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+.signature: std::persistent::set/3
+
+.function: listener/0
+    import "std/persistent"
+    receive %1 local infinity
+    integer %2 local 1
+    integer %3 local 42
+    frame %3 %16
+    param %0 %1 local
+    param %1 %2 local
+    param %2 %3 local
+    call %4 local std::persistent::set/3
+    print %1 local
+    print %4 local
+    return
+.end
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::vector/0
+    string %2 local "Hello"
+    frame %2 %16
+    param %0 %1 local
+    param %1 %2 local
+    call %1 local std::persistent::push/2
+    string %2 local "World"
+    frame %2 %16
+    param %0 %1 local
+    param %1 %2 local
+    call %1 local std::persistent::push/2
+    frame %0 %16
+    process %3 local listener/0
+    copy %4 local %1 local
+    send %3 local %4 local
+    join void %3 local infinity
+    print %1 local
+    izero %0 local
+    return
+.end
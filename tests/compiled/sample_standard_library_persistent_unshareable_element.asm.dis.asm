@@ -0,0 +1,16 @@
+; external function signatures
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::vector/0
+    vector %2 local %0 local %0
+    frame %2 %16
+    param %0 %1 local
+    param %1 %2 local
+    call %1 local std::persistent::push/2
+    izero %0 local
+    return
+.end
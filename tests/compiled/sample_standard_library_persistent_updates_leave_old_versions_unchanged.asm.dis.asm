@@ -0,0 +1,47 @@
+; external function signatures
+.signature: std::persistent::vector/0
+.signature: std::persistent::push/2
+.signature: std::persistent::pop/1
+.signature: std::persistent::set/3
+
+.function: main/0
+    import "std/persistent"
+    frame %0 %16
+    call %1 local std::persistent::vector/0
+    integer %9 local 1
+    frame %2 %16
+    param %0 %1 local
+    param %1 %9 local
+    call %1 local std::persistent::push/2
+    integer %9 local 2
+    frame %2 %16
+    param %0 %1 local
+    param %1 %9 local
+    call %1 local std::persistent::push/2
+    integer %9 local 3
+    frame %2 %16
+    param %0 %1 local
+    param %1 %9 local
+    call %1 local std::persistent::push/2
+    integer %9 local 4
+    frame %2 %16
+    param %0 %1 local
+    param %1 %9 local
+    call %2 local std::persistent::push/2
+    izero %8 local
+    integer %9 local 10
+    frame %3 %16
+    param %0 %2 local
+    param %1 %8 local
+    param %2 %9 local
+    call %3 local std::persistent::set/3
+    frame %1 %16
+    param %0 %3 local
+    call %4 local std::persistent::pop/1
+    print %1 local
+    print %2 local
+    print %3 local
+    print %4 local
+    izero %0 local
+    return
+.end
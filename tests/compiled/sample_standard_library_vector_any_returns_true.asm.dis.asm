@@ -0,0 +1,28 @@
+; external function signatures
+.signature: std::vector::any/2
+
+.function: is_not_negative/1
+    arg %1 current %0
+    izero %2 current
+    gte %0 current %1 current %2 current
+    return
+.end
+
+.function: main/1
+    import "std::vector"
+    vector %2 current %0 current %0
+    integer %1 current -1
+    vpush %2 current %1 current
+    integer %1 current 0
+    vpush %2 current %1 current
+    integer %1 current 1
+    vpush %2 current %1 current
+    frame %2 %16
+    param %0 %2 current
+    function %4 current is_not_negative/1
+    pamv %1 %4 current
+    call %5 current std::vector::any/2
+    print %5 current
+    izero %0 local
+    return
+.end
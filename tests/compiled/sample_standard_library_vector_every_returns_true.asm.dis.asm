@@ -0,0 +1,26 @@
+; external function signatures
+.signature: std::vector::every/2
+.signature: std::vector::of_ints/1
+
+.function: is_not_negative/1
+    arg %1 current %0
+    izero %2 current
+    gte %0 current %1 current %2 current
+    return
+.end
+
+.function: main/1
+    import "std::vector"
+    frame %1 %16
+    integer %1 current 20
+    param %0 %1 current
+    call %2 current std::vector::of_ints/1
+    frame %2 %16
+    param %0 %2 current
+    function %4 current is_not_negative/1
+    pamv %1 %4 current
+    call %5 current std::vector::every/2
+    print %5 current
+    izero %0 local
+    return
+.end
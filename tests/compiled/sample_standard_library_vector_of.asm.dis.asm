@@ -0,0 +1,22 @@
+; external function signatures
+.signature: std::vector::of/2
+
+.function: return_integer/1
+    arg %0 current %0
+    return
+.end
+
+.function: main/1
+    import "std::vector"
+    class %1 current Foo
+    register %1 current
+    frame %2 %16
+    integer %1 current 8
+    pamv %0 %1 current
+    function %1 current return_integer/1
+    pamv %1 %1 current
+    call %1 current std::vector::of/2
+    print %1 current
+    izero %0 local
+    return
+.end
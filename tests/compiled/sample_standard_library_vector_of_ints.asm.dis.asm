@@ -0,0 +1,13 @@
+; external function signatures
+.signature: std::vector::of_ints/1
+
+.function: main/1
+    import "std::vector"
+    frame %1 %16
+    integer %1 current 8
+    pamv %0 %1 current
+    call %1 current std::vector::of_ints/1
+    print %1 current
+    izero %0 local
+    return
+.end
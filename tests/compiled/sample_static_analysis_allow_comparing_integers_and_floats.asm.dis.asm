@@ -0,0 +1,8 @@
+.function: main/0
+    integer %1 local 42
+    float %2 local 42
+    eq %3 local %1 local %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,7 @@
+.function: main/0
+    izero %1 local
+    iinc %1 local
+    print %1 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,12 @@
+.function: main/0
+    izero %1 local
+    vector %2 local %0 local %0
+    ptr %3 local %1 local
+    iinc *3 local
+    vinsert %2 local *3 local void
+    print %1 local
+    print %2 local
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,28 @@
+; external function signatures
+.signature: Pointer::expired/1
+
+.function: isExpired/1
+    frame %1 %16
+    arg %1 current %0
+    param %0 %1 current
+    call %2 current Pointer::expired/1
+    string %3 current "expired: "
+    echo %3 current
+    print %2 current
+    move %0 current %2 current
+    return
+.end
+
+.function: main/1
+    integer %1 current 42
+    ptr %2 current %1 current
+    frame %1 %16
+    param %0 %2 current
+    call void isExpired/1
+    delete %1 current
+    frame %1 %16
+    param %0 %2 current
+    call void isExpired/1
+    izero %0 local
+    return
+.end
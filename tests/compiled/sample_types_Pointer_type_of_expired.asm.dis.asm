@@ -0,0 +1,16 @@
+; external function signatures
+.signature: std::typesystem::typeof/1
+
+.function: main/0
+    string %1 local "Hello World!"
+    ptr %2 local %1 local
+    delete %1 local
+    import "std/typesystem"
+    frame %1 %16
+    ptr %3 local %2 local
+    param %0 %3 local
+    call %3 local std::typesystem::typeof/1
+    print %3 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,13 @@
+.function: main/1
+    frame %2 %16
+    string %1 current "Hello "
+    param %0 %1 current
+    string %2 current "World!"
+    param %1 %2 current
+    msg %3 current concatenate/2
+    print %1 current
+    print %2 current
+    print %3 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,34 @@
+.function: main/1
+    string %1 local ""
+    izero %2 local
+    integer %3 local 20000
+    gte %4 local %2 local %3 local
+    if %4 local 0xa5 0x46
+    string %5 local "0123456789"
+    frame %2 %16
+    param %0 %1 local
+    param %1 %5 local
+    msg %1 local concatenate/2
+    iinc %2 local
+    jump 0x1c
+    frame %1 %16
+    param %0 %1 local
+    msg %6 local size/1
+    print %6 local
+    integer %7 local 199990
+    integer %8 local 10
+    frame %3 %16
+    param %0 %1 local
+    param %1 %7 local
+    param %2 %8 local
+    msg %9 local substr/
+    print %9 local
+    integer %7 local -5
+    frame %2 %16
+    param %0 %1 local
+    param %1 %7 local
+    msg %9 local substr/
+    print %9 local
+    izero %0 local
+    return
+.end
@@ -0,0 +1,15 @@
+.function: main/1
+    vector %1 current %0 current %0
+    string %2 current "formatted"
+    vpush %1 current %2 current
+    string %2 current "World"
+    vpush %1 current %2 current
+    frame %2 %16
+    string %2 current "Hello, #{0} #{1}!"
+    param %0 %2 current
+    param %1 %1 current
+    msg %3 current format/
+    print %3 current
+    izero %0 local
+    return
+.end
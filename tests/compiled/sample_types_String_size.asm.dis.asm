@@ -0,0 +1,9 @@
+.function: main/1
+    frame %1 %16
+    string %1 current "Hello World!"
+    param %0 %1 current
+    msg %2 current size/1
+    print %2 current
+    izero %0 local
+    return
+.end
@@ -0,0 +1,17 @@
+.function: main/1
+    frame %2 %16
+    string %1 current "Hello World!"
+    param %0 %1 current
+    string %2 current "Hello"
+    param %1 %2 current
+    msg %3 current startswith/2
+    print %3 current
+    frame %2 %16
+    param %0 %1 current
+    string %2 current "Fail"
+    param %1 %2 current
+    msg %3 current startswith/2
+    print %3 current
+    izero %0 local
+    return
+.end
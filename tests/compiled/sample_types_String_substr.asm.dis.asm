@@ -0,0 +1,25 @@
+.function: main/1
+    frame %1 %16
+    string %1 current "Hello, World!"
+    param %0 %1 current
+    msg %4 current substr/
+    print %4 current
+    frame %3 %16
+    string %1 current "Hello, World!"
+    param %0 %1 current
+    integer %2 current 0
+    param %1 %2 current
+    integer %3 current 5
+    param %2 %3 current
+    msg %4 current substr/
+    print %4 current
+    frame %2 %16
+    string %1 current "Hello, World!"
+    param %0 %1 current
+    integer %2 current 7
+    param %1 %2 current
+    msg %4 current substr/
+    print %4 current
+    izero %0 local
+    return
+.end
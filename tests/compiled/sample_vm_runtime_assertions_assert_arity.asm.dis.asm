@@ -0,0 +1,28 @@
+.block: try_ArityException
+    frame %4 %16
+    string %1 current "Hello, World!"
+    param %0 %1 current
+    integer %2 current 3
+    param %1 %2 current
+    integer %3 current 4
+    param %2 %3 current
+    integer %4 current 5
+    param %3 %4 current
+    msg %4 current substr/
+    print %4 current
+    leave
+.end
+
+.block: catch_ArityException
+    draw %6 current
+    print %6 current
+    leave
+.end
+
+.function: main/1
+    try
+    catch "ArityException" catch_ArityException
+    enter try_ArityException
+    izero %0 local
+    return
+.end
@@ -0,0 +1,23 @@
+.block: try_TypeException
+    frame %2 %16
+    string %1 current "Hello, World!"
+    param %0 %1 current
+    param %1 %1 current
+    msg %2 current substr/
+    print %2 current
+    leave
+.end
+
+.block: catch_TypeException
+    draw %6 current
+    print %6 current
+    leave
+.end
+
+.function: main/1
+    try
+    catch "TypeException" catch_TypeException
+    enter try_TypeException
+    izero %0 local
+    return
+.end
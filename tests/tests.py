@@ -121,10 +121,11 @@ def disassemble(path, out=None):
         raise ViuaDisassemblerError('{0}: {1}'.format(' '.join(asmargs), output.strip()))
     return (output, error, exit_code)
 
-def run(path, expected_exit_code=0, pipe_error=False):
+def run(path, expected_exit_code=0, pipe_error=False, env=None):
     """Run given file with Viua CPU and return its output.
+    Variables in `env` are added to the environment of the kernel.
     """
-    p = subprocess.Popen((VIUA_KERNEL_PATH, path), stdout=subprocess.PIPE, stderr=(subprocess.PIPE if pipe_error else None))
+    p = subprocess.Popen((VIUA_KERNEL_PATH, path), stdout=subprocess.PIPE, stderr=(subprocess.PIPE if pipe_error else None), env=(None if env is None else dict(os.environ, **env)))
     output, error = p.communicate()
     exit_code = p.wait()
     if exit_code not in (expected_exit_code if type(expected_exit_code) in [list, tuple] else (expected_exit_code,)):
@@ -135,6 +136,13 @@ FLAG_TEST_ONLY_ASSEMBLING = bool(int(os.environ.get('VIUA_TEST_ONLY_ASMING', 0))
 MEMORY_LEAK_CHECKS_SKIPPED = 0
 MEMORY_LEAK_CHECKS_RUN = 0
 MEMORY_LEAK_CHECKS_ENABLE = bool(int(os.environ.get('VIUA_TEST_SUITE_VALGRIND_CHECKS', 1)))
+
+# Differential mode runs every sample twice: once only in the interpreter, and
+# once with every function compiled by the baseline compiler on first call, and
+# checks that the results are the same.
+DIFFERENTIAL_CHECKS_ENABLE = bool(int(os.environ.get('VIUA_TEST_SUITE_DIFFERENTIAL', 0)))
+INTERPRETER_ONLY_ENV = {'VIUA_BASELINE_COMPILER': 'no'}
+BASELINE_EVERYWHERE_ENV = {'VIUA_BASELINE_THRESHOLD': '1'}
 MEMORY_LEAK_CHECKS_SKIP_LIST = []
 MEMORY_LEAK_CHECKS_ALLOWED_LEAK_VALUES = (0, 72704)
 MEMORY_LEAK_CHECKS_EXTRA_ALLOWED_LEAK_VALUES = ()
@@ -291,6 +299,15 @@ def runMemoryLeakCheck(self, compiled_path, check_memory_leaks):
         MEMORY_LEAK_CHECKS_RUN += 1
         valgrindCheck(self, compiled_path)
 
+def runDifferentialCheck(self, compiled_path, expected_exit_code, output_processing_function, compare_output):
+    if not DIFFERENTIAL_CHECKS_ENABLE: return
+    process = (lambda o: o.strip()) if output_processing_function is None else output_processing_function
+    results = []
+    for env in (INTERPRETER_ONLY_ENV, BASELINE_EVERYWHERE_ENV,):
+        excode, output, error = run(compiled_path, expected_exit_code, pipe_error=True, env=env)
+        results.append((excode, (process(output) if compare_output else None),))
+    self.assertEqual(results[0], results[1])
+
 def runTestBackend(self, name, expected_output=None, expected_exit_code = 0, output_processing_function = None, expected_error=None, error_processing_function=None, check_memory_leaks = True, custom_assert=None, assembly_opts=None, valgrind_enable=True, test_disasm=True):
     if assembly_opts is None:
         assembly_opts = ()
@@ -318,6 +335,8 @@ def runTestBackend(self, name, expected_output=None, expected_exit_code = 0, out
 
             if valgrind_enable:
                 runMemoryLeakCheck(self, compiled_path, check_memory_leaks)
+            if custom_assert is None:
+                runDifferentialCheck(self, compiled_path, expected_exit_code, output_processing_function, (expected_output is not None))
         except Exception:
             print('test failed: check file {}'.format(assembly_path))
             raise
@@ -1345,6 +1364,39 @@ class VectorInstructionsTests(unittest.TestCase):
     def testVAT(self):
         runTest(self, 'vat.asm', ['0', '1', '1', 'Hello World!'], 0, lambda o: o.strip().splitlines())
 
+    def testTypedIntVector(self):
+        runTest(self, 'typed_int_vector.asm', ['[0, 1, 2, 3]', '6', '3', '3', '[0, 1, 2]'], 0, lambda o: o.strip().splitlines())
+
+    def testTypedFloatVector(self):
+        runTest(self, 'typed_float_vector.asm', ['1.750000', '2'], 0, lambda o: o.strip().splitlines())
+
+    def testTypedByteVector(self):
+        runTest(self, 'typed_byte_vector.asm', '[0, 127, 255]')
+
+    def testTypedByteVectorRejectsOutOfRangeBytes(self):
+        runTestThrowsException(self, 'typed_byte_vector_out_of_range.asm', ('OutOfRangeException', 'byte out of range: 256',))
+
+    def testTypedVectorRejectsInvalidElements(self):
+        runTestThrowsException(self, 'typed_vector_invalid_element.asm', ('Exception', 'invalid element for IntVector: String',), assembly_opts=('--no-sa',))
+
+    def testTypedVectorRejectsInvalidElementsStatically(self):
+        runTestFailsToAssemble(self, 'typed_vector_invalid_element.asm', './sample/asm/vector/typed_vector_invalid_element.asm:22:36: error: invalid type of value contained in register')
+
+    def testTypedVectorRejectsInvalidElementType(self):
+        runTestThrowsException(self, 'typed_vector_invalid_element_type.asm', ('Exception', 'invalid type of vector elements: string',), assembly_opts=('--no-sa',))
+
+    def testTypedVectorRejectsInvalidElementTypeStatically(self):
+        runTestFailsToAssemble(self, 'typed_vector_invalid_element_type.asm', './sample/asm/vector/typed_vector_invalid_element_type.asm:21:37: error: invalid type of vector elements')
+
+    def testTypedVectorLowestIndex(self):
+        runTestThrowsException(self, 'typed_vector_lowest_index.asm', ('OutOfRangeException', 'negative vector index out of range',))
+
+    def testTypedVectorPushFromEmptyRegister(self):
+        runTestThrowsException(self, 'typed_vector_push_from_empty_register.asm', ('Exception', 'vpush: cannot push null register',), assembly_opts=('--no-sa',))
+
+    def testTypedVectorInsertFromEmptyRegister(self):
+        runTestThrowsException(self, 'typed_vector_insert_from_empty_register.asm', ('Exception', 'vinsert: cannot insert null register',), assembly_opts=('--no-sa',))
+
 
 class CastingInstructionsTests(unittest.TestCase):
     """Tests for byte instructions.
@@ -1486,6 +1538,9 @@ class SampleProgramsTests(unittest.TestCase):
     def testCalculatingFactorialUsingTailcalls(self):
         runTest(self, 'factorial_tailcall.asm', '40320')
 
+    def testTailRecursiveLoop(self):
+        runTest(self, 'tail_recursive_loop.asm', '50005000')
+
     def testIterativeFibonacciNumbers(self):
         """45. Fibonacci number calculated iteratively.
         """
@@ -1526,9 +1581,23 @@ class FunctionTests(unittest.TestCase):
         # FIXME: SA needs basic support for static register set
         runTestReturnsIntegers(self, 'static_registers.asm', [i for i in range(0, 10)], assembly_opts=('--no-sa',))
 
+    def testStaticRegistersArePerFunction(self):
+        # FIXME: SA needs basic support for static register set
+        runTestReturnsIntegers(self, 'static_registers_per_function.asm', [1, 2, 101, 3, 102], assembly_opts=('--no-sa',))
+
+    def testStaticRegistersAfterTailCall(self):
+        # FIXME: SA needs basic support for static register set
+        runTestReturnsIntegers(self, 'static_registers_after_tailcall.asm', [101, 102, 103], assembly_opts=('--no-sa',))
+
     def testCallWithPassByMove(self):
         runTest(self, 'pass_by_move.asm', None, custom_assert=partiallyAppliedSameLines(3))
 
+    def testArgMovesParameterPassedByMove(self):
+        runTest(self, 'arg_moves_parameter_passed_by_move.asm', '42')
+
+    def testArgOfMovedParameterTwice(self):
+        runTestThrowsException(self, 'arg_of_moved_parameter_twice.asm', ('Exception', '(get) read from null register: 0',))
+
     @unittest.skip('functions not ending with "return" or "tailcall" are forbidden')
     def testNeverendingFunction(self):
         runTestSplitlines(self, 'neverending.asm', ['42', '48'], assembly_opts=('--no-sa',))
@@ -1573,10 +1642,10 @@ class HigherOrderFunctionTests(unittest.TestCase):
         runTest(self, 'filter_closure_vector_by_move.asm', [[1, 2, 3, 4, 5], [2, 4]], 0, lambda o: [json.loads(i) for i in o.splitlines()], assembly_opts=('--no-sa',))
 
     def testTailcallOfObject(self):
-        runTestThrowsExceptionJSON(self, 'tailcall_of_object.asm', {'frame': {}, 'trace': ['main/0/0()', 'foo/0/0()',], 'uncaught': {'type': 'Integer', 'value': '42',}}, output_processing_function=lambda s: json.loads(s.strip()))
+        runTestThrowsExceptionJSON(self, 'tailcall_of_object.asm', {'frame': {}, 'trace': ['main/0/0()', 'bar/0/0()',], 'uncaught': {'type': 'Integer', 'value': '42',}}, output_processing_function=lambda s: json.loads(s.strip()))
 
     def testTailcallOfClosure(self):
-        runTestThrowsExceptionJSON(self, 'tailcall_of_closure.asm', {'frame': {}, 'trace': ['main/0/0()', 'test/0/0()',], 'uncaught': {'type': 'Integer', 'value': '42',}}, assembly_opts=('--no-sa',), output_processing_function=lambda s: json.loads(s.strip()))
+        runTestThrowsExceptionJSON(self, 'tailcall_of_closure.asm', {'frame': {}, 'trace': ['main/0/0()', 'closure/0/0()',], 'uncaught': {'type': 'Integer', 'value': '42',}}, assembly_opts=('--no-sa',), output_processing_function=lambda s: json.loads(s.strip()))
 
 
 class ClosureTests(unittest.TestCase):
@@ -1604,6 +1673,10 @@ class ClosureTests(unittest.TestCase):
         # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
         runTestSplitlines(self, 'change_enclosed_variable_from_closure.asm', ['Hello World!', '42'], assembly_opts=('--no-sa',))
 
+    def testWritingToCapturedRegisters(self):
+        # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
+        runTestSplitlines(self, 'writing_to_captured_registers.asm', ['1', '42', 'moved in', '2', '7', '100'], assembly_opts=('--no-sa',))
+
     def testNestedClosures(self):
         # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
         runTest(self, 'nested_closures.asm', '10', assembly_opts=('--no-sa',))
@@ -1616,6 +1689,10 @@ class ClosureTests(unittest.TestCase):
         # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
         runTestSplitlines(self, 'capturecopy_creates_independent_objects.asm', ['Hello World!', 'Hello World!', '42', 'Hello World!'], assembly_opts=('--no-sa',))
 
+    def testCopiesOfClosureAreIndependent(self):
+        # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
+        runTestSplitlines(self, 'copies_of_closure_are_independent.asm', ['1', '2', '3', '2', '4'], assembly_opts=('--no-sa',))
+
     def testSimpleCaptureByMove(self):
         # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
         runTestSplitlines(self, 'simple_enclose_by_move.asm', ['true', 'Hello World!'], assembly_opts=('--no-sa',))
@@ -1752,6 +1829,196 @@ class StaticLinkingTests(unittest.TestCase):
         self.assertEqual(0, excode)
 
 
+class AssemblerCacheTests(unittest.TestCase):
+    """Tests for reusing bytecode of functions between assembler runs.
+    """
+    PATH = './sample/asm/linking/static'
+    CACHE_PATH = os.path.join(COMPILED_SAMPLES_PATH, 'asm_cache')
+
+    def digest(self, path):
+        with open(path, 'rb') as ifstream:
+            return hashlib.sha256(ifstream.read()).hexdigest()
+
+    def testCachedBytecodeIsIdentical(self):
+        lib_name = 'jumplib.asm'
+        assembly_lib_path = os.path.join(self.PATH, lib_name)
+        compiled_lib_path = os.path.join(COMPILED_SAMPLES_PATH, (lib_name + '.cache.vlib'))
+        assemble(assembly_lib_path, compiled_lib_path, opts=('--lib', '--cache', self.CACHE_PATH,))
+        bin_name = 'jumplink.asm'
+        assembly_bin_path = os.path.join(self.PATH, bin_name)
+        compiled_bin_path = os.path.join(COMPILED_SAMPLES_PATH, (bin_name + '.bin'))
+        assemble(assembly_bin_path, compiled_bin_path, links=(compiled_lib_path,))
+        expected = self.digest(compiled_bin_path)
+
+        # first run fills the cache, second one is served from it
+        for i in range(2):
+            assemble(assembly_bin_path, compiled_bin_path, links=(compiled_lib_path,), opts=('--cache', self.CACHE_PATH,))
+            self.assertEqual(expected, self.digest(compiled_bin_path))
+
+        excode, output, error = run(compiled_bin_path)
+        self.assertEqual(['42', ':-)'], output.strip().splitlines())
+        self.assertEqual(0, excode)
+
+    def testCachedBlocksAndBranches(self):
+        for each in ('absolute_jumping/relative_branch.asm', 'blocks/basic.asm', 'blocks/catching_builtin_type.asm',):
+            assembly_path = os.path.join('./sample/asm', each)
+            compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'asm_cache_{}.bin'.format(each.replace('/', '_')))
+            assemble(assembly_path, compiled_path)
+            expected = self.digest(compiled_path)
+            for i in range(2):
+                assemble(assembly_path, compiled_path, opts=('--cache', self.CACHE_PATH,))
+                self.assertEqual(expected, self.digest(compiled_path))
+
+
+class RegisterAllocationTests(unittest.TestCase):
+    """Tests for renumbering of local registers done by the assembler.
+    """
+    PATH = './sample/asm/register_allocation'
+    ASM_FLAGS = ('--allocate-registers',)
+
+    def testLoop(self):
+        runTest(self, 'loop.asm', ['384', '14'], 0, lambda o: o.strip().splitlines())
+
+    def testFramesAreShrunk(self):
+        assembly_path = os.path.join(self.PATH, 'loop.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'register_allocation_loop_shrunk.bin')
+        assemble(assembly_path, compiled_path, opts=self.ASM_FLAGS)
+        output, error, exit_code = disassemble(compiled_path)
+        lines = [each.strip() for each in output.splitlines()]
+        self.assertEqual(['frame %1 %5', 'frame %1 %5'], [each for each in lines if each.startswith('frame')])
+        self.assertIn('mul %4 current %2 current %2 current', lines)
+        self.assertIn('div %4 current %3 current %2 current', lines)
+
+
+class InliningTests(unittest.TestCase):
+    """Tests for replacing calls to small leaf functions with their bodies.
+    """
+    PATH = './sample/asm/inlining'
+    ASM_FLAGS = ('--inline',)
+
+    def calls_in(self, assembly_name, opts):
+        assembly_path = os.path.join(self.PATH, assembly_name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'inlining_{}.bin'.format(assembly_name))
+        assemble(assembly_path, compiled_path, opts=opts)
+        output, error, exit_code = disassemble(compiled_path)
+        return [each.strip() for each in output.splitlines() if each.strip().startswith('call')]
+
+    def testLeafFunctions(self):
+        runTest(self, 'leaf_functions.asm', ['385', '6', 'Hello World!'], 0, lambda o: o.strip().splitlines())
+
+    def testCallsAreReplaced(self):
+        self.assertEqual([
+            'call %2 current sum_of_squares/1',
+            'call void greet/1',
+        ], self.calls_in('leaf_functions.asm', self.ASM_FLAGS))
+
+    def testThreshold(self):
+        self.assertEqual([
+            'call %5 current square/1',
+            'call %2 current sum_of_squares/1',
+            'call %6 current add3/3',
+            'call void greet/1',
+        ], self.calls_in('leaf_functions.asm', self.ASM_FLAGS + ('--inline-threshold', '2',)))
+
+
+class ProfileGuidedOptimisationTests(unittest.TestCase):
+    """Tests for writing profiles of programs and using them to guide the assembler.
+    """
+    PATH = './sample/asm/profile'
+    PROFILE = os.path.join(PATH, 'hot_and_cold.profile')
+    ASM_FLAGS = ('--profile-use', PROFILE,)
+
+    def names_in(self, assembly_name, opts):
+        assembly_path = os.path.join(self.PATH, assembly_name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'profile_{}.bin'.format(assembly_name))
+        assemble(assembly_path, compiled_path, opts=opts)
+        output, error, exit_code = disassemble(compiled_path)
+        return [each.strip() for each in output.splitlines() if each.strip().startswith(('.function:', 'call',))]
+
+    def testProfileIsWritten(self):
+        assembly_path = os.path.join(self.PATH, 'hot_and_cold.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'profile_hot_and_cold.asm.bin')
+        profile_path = os.path.join(COMPILED_SAMPLES_PATH, 'profile_hot_and_cold.asm.profile')
+        assemble(assembly_path, compiled_path)
+        os.environ['VIUA_PROFILE_OUTPUT'] = profile_path
+        try:
+            exit_code, output, error = run(compiled_path)
+        finally:
+            del os.environ['VIUA_PROFILE_OUTPUT']
+        self.assertEqual('385', output.strip())
+        with open(profile_path) as ifstream:
+            profile = ifstream.read().splitlines()
+        self.assertIn('call main/0 1', profile)
+        self.assertIn('call sum_of_squares/1 1', profile)
+        self.assertIn('call square/1 10', profile)
+        self.assertNotIn('cold/0', ' '.join(profile))
+        self.assertEqual(1, len([each for each in profile if each.startswith('branch sum_of_squares/1 ') and each.endswith(' 1 10')]))
+        self.assertEqual(1, len([each for each in profile if each.startswith('loop sum_of_squares/1 ') and each.endswith(' 10')]))
+
+    def testProfileGuidedBuild(self):
+        runTest(self, 'hot_and_cold.asm', '385')
+
+    def testHotFunctionsArePlacedFirst(self):
+        self.assertEqual([
+            '.function: square/1',
+            '.function: sum_of_squares/1',
+            'call %5 current square/1',
+            '.function: main/0',
+            'call void cold/0',
+            'call %4 current sum_of_squares/1',
+            '.function: cold/0',
+        ], self.names_in('hot_and_cold.asm', self.ASM_FLAGS))
+
+    def testColdFunctionsAreNotInlined(self):
+        self.assertEqual([
+            '.function: square/1',
+            '.function: sum_of_squares/1',
+            '.function: main/0',
+            'call void cold/0',
+            'call %4 current sum_of_squares/1',
+            '.function: cold/0',
+        ], self.names_in('hot_and_cold.asm', self.ASM_FLAGS + ('--inline',)))
+
+    def testHotFunctionsGetBiggerThreshold(self):
+        self.assertNotIn('call %5 current square/1',
+            self.names_in('hot_and_cold.asm', self.ASM_FLAGS + ('--inline', '--inline-threshold', '2',)))
+        self.assertIn('call %5 current square/1',
+            self.names_in('hot_and_cold.asm', ('--inline', '--inline-threshold', '2',)))
+
+
+class BaselineCompilerTests(unittest.TestCase):
+    """Tests for the baseline compiler (the second execution tier).
+    """
+    PATH = './sample/asm/baseline'
+
+    def runInAllTiers(self, name, expected_output):
+        assembly_path = os.path.join(self.PATH, name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'baseline_{}.bin'.format(name))
+        assemble(assembly_path, compiled_path)
+        for env in (INTERPRETER_ONLY_ENV, {}, BASELINE_EVERYWHERE_ENV,):
+            excode, output, error = run(compiled_path, env=env)
+            self.assertEqual(expected_output, output.strip().splitlines())
+
+    def testMixedOperands(self):
+        self.runInAllTiers('mixed_operands.asm', ['4950', '2.500000', '42', '45'])
+
+    def testLoopInFunctionCalledOnce(self):
+        self.runInAllTiers('hot_loop.asm', ['500500', '1000'])
+
+    def testFunctionHotInManyProcesses(self):
+        self.runInAllTiers('hot_in_many_processes.asm', ['338350', '338350', '338350', '338350'])
+
+    def testDisablingTheCompiler(self):
+        def threshold(env):
+            p = subprocess.Popen((VIUA_KERNEL_PATH, '--json'), stdout=subprocess.PIPE, env=dict(os.environ, **env))
+            output, error = p.communicate()
+            self.assertEqual(0, p.wait())
+            return json.loads(output.decode('utf-8'))['baseline']
+        self.assertEqual(0, threshold(INTERPRETER_ONLY_ENV))
+        self.assertEqual(0, threshold(dict(INTERPRETER_ONLY_ENV, **BASELINE_EVERYWHERE_ENV)))
+        self.assertEqual(1, threshold(BASELINE_EVERYWHERE_ENV))
+
+
 class JumpingTests(unittest.TestCase):
     """
     """
@@ -3019,6 +3286,10 @@ class ConcurrencyTests(unittest.TestCase):
     def testImmediatelyDetachingProcess(self):
         runTest(self, 'immediately_detached.asm', 'Hello World (from detached)!')
 
+    def testSpawningManyProcesses(self):
+        # FIXME global registers should not be statically checked
+        runTest(self, 'spawning_many_processes.asm', '999000', assembly_opts=('--no-sa',))
+
     def testHelloWorldExample(self):
         runTestReturnsUnorderedLines(self, 'hello_world.asm', ['Hello concurrent World! (2)', 'Hello concurrent World! (1)'], 0)
 
@@ -3031,6 +3302,122 @@ class ConcurrencyTests(unittest.TestCase):
     def testJoiningDetachedProcess(self):
         runTestThrowsException(self, 'joining_detached_process.asm', ('Exception', 'process cannot be joined',))
 
+    def testSendingToStalePID(self):
+        runTestThrowsException(self, 'sending_to_stale_pid.asm', ('Exception', 'no message received',))
+
+    def testSendingBatchesOfMessages(self):
+        runTest(self, 'sending_batches_of_messages.asm', [
+            'Hello',
+            '["batched", "messages"]',
+            '["World!"]',
+            '[]',
+        ], 0, lambda o: o.strip().splitlines())
+
+    def testReceivingSelectedMessages(self):
+        runTestSplitlines(self, 'receiving_selected_messages.asm', [
+            "{'tag': 'reply', 'value': \"Hello World!\"}",
+            '42',
+            "'noise'",
+            "'more_noise'",
+        ])
+
+    def testSelectiveReceiveSkipsMessagesMissingKeys(self):
+        runTestSplitlines(self, 'selective_receive_missing_key.asm', [
+            "{'value': 42}",
+            "{'tag': 'no_value'}",
+        ])
+
+    def testSelectiveReceiveTimesOut(self):
+        runTestThrowsException(self, 'selective_receive_times_out.asm', ('Exception', 'no message received',))
+
+    def testSleepingDoesNotBlockOtherProcesses(self):
+        runTestSplitlines(self, 'sleeping_does_not_block_other_processes.asm', [
+            'Hello',
+            'World!',
+        ])
+
+    def testProcessesWithPriorityClasses(self):
+        runTestSplitlines(self, 'processes_with_priority_classes.asm', [
+            '500500',
+            'done',
+        ])
+
+    def testSchedulerStatisticsAreWritten(self):
+        assembly_path = os.path.join(self.PATH, 'processes_with_priority_classes.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'statistics_processes_with_priority_classes.asm.bin')
+        statistics_path = os.path.join(COMPILED_SAMPLES_PATH, 'statistics_processes_with_priority_classes.asm.txt')
+        assemble(assembly_path, compiled_path)
+        os.environ['VIUA_SCHEDULER_STATISTICS'] = statistics_path
+        try:
+            exit_code, output, error = run(compiled_path)
+        finally:
+            del os.environ['VIUA_SCHEDULER_STATISTICS']
+        self.assertEqual(['500500', 'done'], output.strip().splitlines())
+        with open(statistics_path) as ifstream:
+            statistics = [each.split() for each in ifstream.read().splitlines()]
+        self.assertEqual(['realtime', 'normal', 'batch'], [each[0] for each in statistics])
+        for each in statistics:
+            self.assertEqual(4, len(each))
+        self.assertTrue(int(statistics[0][1]) > 0)
+        self.assertTrue(int(statistics[2][1]) > 0)
+
+    def testRealtimeProcessRunsFirst(self):
+        # a single scheduler runs both processes so their order is deterministic
+        assembly_path = os.path.join(self.PATH, 'realtime_process_runs_first.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'realtime_process_runs_first.asm.bin')
+        assemble(assembly_path, compiled_path)
+        exit_code, output, error = run(compiled_path, env={'VIUA_VP_SCHEDULERS': '1'})
+        self.assertEqual(['realtime', 'normal'], output.strip().splitlines())
+
+    def testPinnedSchedulers(self):
+        assembly_path = os.path.join(self.PATH, 'spawning_many_processes.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'spawning_many_processes.asm.pinned.bin')
+        # FIXME global registers should not be statically checked
+        assemble(assembly_path, compiled_path, opts=('--no-sa',))
+        exit_code, output, error = run(compiled_path, env={
+            'VIUA_PIN_SCHEDULERS': 'yes',
+            'VIUA_VP_SCHEDULERS': '4',
+            'VIUA_FFI_SCHEDULERS': '2',
+        })
+        self.assertEqual('999000', output.strip())
+
+    def testInvalidPriorityClass(self):
+        runTestThrowsException(self, 'invalid_priority_class.asm', ('Exception', 'invalid priority class: urgent',))
+
+    def testSendingAClosureSharingRegisters(self):
+        # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
+        runTestSplitlines(self, 'sending_a_closure_sharing_registers.asm', ['42', '43', '42', '42'], assembly_opts=('--no-sa',))
+
+    def testSpawningWithAClosureParameter(self):
+        # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
+        runTestSplitlines(self, 'spawning_with_a_closure_parameter.asm', ['42', '43', '42', '42'], assembly_opts=('--no-sa',))
+
+    def testSendingCapturedValues(self):
+        runTestSplitlines(self, 'sending_captured_values.asm', ['42', 'Hello World!'], assembly_opts=('--no-sa',))
+
+    def testPointersExpireWhenValueIsSent(self):
+        runTestThrowsException(self, 'pointers_expire_when_value_is_sent.asm', ('Exception', 'expired pointer exception',))
+
+    def testSendingALargeVector(self):
+        runTestSplitlines(self, 'sending_a_large_vector.asm', ['99999', '100000', 'expired pointer exception'])
+
+    def testSendingAClosureWithPointedToValue(self):
+        # FIXME: passing custom assembler options will not be needed once .closure: support is completely implemented
+        runTestThrowsException(self, 'sending_a_closure_with_pointed_to_value.asm', ('Exception', 'expired pointer exception',), assembly_opts=('--no-sa',))
+
+    def testSendingFromEmptyRegister(self):
+        runTestThrowsException(self, 'sending_from_empty_register.asm', ('Exception', 'send from empty register',), assembly_opts=('--no-sa',))
+
+    def testBroadcastingAMessage(self):
+        runTestReturnsUnorderedLines(self, 'broadcasting_a_message.asm', [
+            'Hello broadcast World! 1',
+            'Hello broadcast World! 2',
+            'Hello broadcast World! 3',
+        ])
+
+    def testBroadcastingToNobody(self):
+        runTestThrowsException(self, 'broadcasting_to_nobody.asm', ('Exception', 'broadcast to an empty group of processes',))
+
     def testDetachingProcess(self):
         runTestReturnsUnorderedLines(
             self,
@@ -3174,6 +3561,45 @@ class StructTests(unittest.TestCase):
         runTest(self, 'struct_of_structs.asm', "{'bad': {'answer': 666}, 'good': {'answer': 42}}")
 
 
+class HashMapTests(unittest.TestCase):
+    PATH = './sample/asm/hash_maps'
+
+    def testCreatingEmptyHashMap(self):
+        runTest(self, 'creating_empty_hash_map.asm', '{}')
+
+    def testInsertingAndLookingUpValues(self):
+        runTestSplitlines(self, 'inserting_and_looking_up_values.asm', ['integer', 'float', '42', 'string', 'text', 'bits', '6'])
+
+    def testRemovingValues(self):
+        runTestSplitlines(self, 'removing_values.asm', ['666', '0', 'false'])
+
+    def testOverwritingAValue(self):
+        runTestSplitlines(self, 'overwriting_a_value.asm', ["{'answer': 666}", "{'answer': 42}"])
+
+    def testKeysOfDifferentTypesAreDifferent(self):
+        runTest(self, 'keys_of_different_types_are_different.asm', '4')
+
+    def testObtainingKeys(self):
+        runTest(self, 'obtaining_keys.asm', '[42]')
+
+    def testManyKeys(self):
+        runTestSplitlines(self, 'many_keys.asm', ['500', '998001', 'false'])
+
+    def testLookupOfMissingKey(self):
+        runTestThrowsException(self, 'lookup_of_missing_key.asm', ('Exception', 'key not found: 42',))
+
+    def testUnhashableKey(self):
+        runTestThrowsException(self, 'unhashable_key.asm', ('Exception', 'unhashable type: Vector',))
+
+    def testInsertingIntoAStruct(self):
+        runTestFailsToAssembleDetailed(self, 'inserting_into_a_struct.asm', [
+            '24:19: error: invalid type of value contained in register',
+            '24:19: note: expected hashmap, got struct',
+            '21:20: note: register defined here',
+            '20:12: error: in function main/0',
+        ])
+
+
 class AtomTests(unittest.TestCase):
     PATH = './sample/asm/atoms'
 
@@ -3206,12 +3632,22 @@ class DeferredCallsTests(unittest.TestCase):
     def testNestedDeferredCalls(self):
         runTestSplitlines(self, 'nested.asm', ['bar', 'baz', 'bay', 'foo'])
 
+    def testDeferredCallsInALoop(self):
+        runTest(self, 'in_a_loop.asm', '10000')
+
     def testDeferredCallsActivatedOnTailCall(self):
         runTestSplitlines(self, 'tailcall.asm', ['Hello from deferred!', '42'])
 
     def testDeferredCallsInvokedBeforeTailCall(self):
         runTestSplitlines(self, 'before_tailcall.asm', ['Hello World!'])
 
+    def testReturnValueIsSetAsideBeforeDeferredCalls(self):
+        runTestSplitlines(self, 'return_value_set_aside.asm', ['69', '42'])
+
+    def testExceptionThrownByDeferredCallOnReturn(self):
+        # FIXME: static analyser does not understand returning from a block
+        runTest(self, 'thrown_by_deferred_call_on_return.asm', '42', assembly_opts=('--no-sa',))
+
     def testDeferredCallsInvokedBeforeFrameIsPopped(self):
         runTestSplitlines(self, 'before_return.asm', ['Hello World!'])
 
@@ -3281,12 +3717,54 @@ class DeferredCallsTests(unittest.TestCase):
         )
 
 
+class CoroutineTests(unittest.TestCase):
+    PATH = './sample/asm/coroutines'
+
+    def testGenerator(self):
+        runTestSplitlines(self, 'generator.asm', ['0', '1', '2', '3', '4'])
+
+    def testValueReturnedFromCoroutine(self):
+        runTestSplitlines(self, 'value_returned_from_coroutine.asm', ['41', '42', 'Coroutine: answer/0'])
+
+    def testNestedCoroutines(self):
+        runTestSplitlines(self, 'nested_coroutines.asm', ['0', '2', '4', '6', '8'])
+
+    def testDeferredCallInCoroutine(self):
+        runTestSplitlines(self, 'deferred_call_in_coroutine.asm', ['1', 'bye', '2'])
+
+    def testExceptionThrownInCoroutine(self):
+        runTestSplitlines(self, 'exception_thrown_in_coroutine.asm', ['1', 'failed in coroutine', 'Coroutine: failing/0'])
+
+    def testUncaughtExceptionInCoroutine(self):
+        runTest(self, 'uncaught_exception_in_coroutine.asm', '42', expected_error = ('Exception', 'resume of a finished coroutine: Coroutine: answer/0',), error_processing_function = extractFirstException, expected_exit_code = 1)
+
+    def testResumingFinishedCoroutine(self):
+        runTest(self, 'resuming_finished_coroutine.asm', '42', expected_error = ('Exception', 'resume of a finished coroutine: Coroutine: answer/0',), error_processing_function = extractFirstException, expected_exit_code = 1)
+
+    def testYieldOutsideOfCoroutine(self):
+        runTestThrowsException(self, 'yield_outside_of_coroutine.asm', ('Exception', 'yield outside of a coroutine',))
+
+    def testCopyingACoroutine(self):
+        runTestThrowsException(self, 'copying_a_coroutine.asm', ('Exception', 'coroutines cannot be copied',))
+
+    def testResumeOfNonCoroutine(self):
+        runTestFailsToAssembleDetailed(self, 'resume_of_non_coroutine.asm', [
+            '22:21: error: invalid type of value contained in register',
+            '22:21: note: expected coroutine, got integer',
+            '21:13: note: register defined here',
+            '20:12: error: in function main/0',
+        ])
+
+
 class StandardRuntimeLibraryModuleVector(unittest.TestCase):
     PATH = './sample/standard_library/vector'
 
     def testVectorOfInts(self):
         runTest(self, 'of_ints.asm', '[0, 1, 2, 3, 4, 5, 6, 7]')
 
+    def testVectorOfUnboxedInts(self):
+        runTest(self, 'of_unboxed_ints.asm', '[0, 1, 2, 3, 4, 5, 6, 7]')
+
     def testVectorOf(self):
         runTest(self, 'of.asm', '[0, 1, 2, 3, 4, 5, 6, 7]')
 
@@ -3318,6 +3796,15 @@ class StandardRuntimeLibraryModuleFunctional(unittest.TestCase):
     def testApplyThatReturnsAValue(self):
         runTest(self, 'apply_simple.asm', '42')
 
+    def testParallelMap(self):
+        runTest(self, 'pmap.asm', '[1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225, 256, 289, 324, 361, 400]')
+
+    def testParallelFilter(self):
+        runTestSplitlines(self, 'pfilter.asm', ['[2, 4, 6, 8, 10, 12, 14, 16, 18, 20]', '[]'])
+
+    def testParallelReduce(self):
+        runTestSplitlines(self, 'preduce.asm', ['500500', 'Hello World!'])
+
 
 class TypeStringTests(unittest.TestCase):
     PATH = './sample/types/String'
@@ -3328,6 +3815,9 @@ class TypeStringTests(unittest.TestCase):
     def testMessageConcatenate(self):
         runTest(self, 'concatenate.asm', ['Hello ', 'World!', 'Hello World!'], 0, lambda o: o.splitlines())
 
+    def testMessageConcatenateInLoop(self):
+        runTest(self, 'concatenate_in_loop.asm', ['200000', '0123456789', '56789'], 0, lambda o: o.splitlines())
+
     def testMessageFormat(self):
         runTest(self, 'format.asm', 'Hello, formatted World!')
 
@@ -3341,6 +3831,112 @@ class TypeStringTests(unittest.TestCase):
         runTest(self, 'endswith.asm', 'true\nfalse')
 
 
+class StandardRuntimeLibraryModuleNumeric(unittest.TestCase):
+    PATH = './sample/standard_library/numeric'
+
+    def testElementwiseArithmetic(self):
+        runTestSplitlines(self, 'arithmetic.asm', [
+            '[0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38]',
+            '[0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169, 196, 225, 256, 289, 324, 361]',
+            '[0, -1, 0, 3, 8, 15, 24, 35, 48, 63, 80, 99, 120, 143, 168, 195, 224, 255, 288, 323]',
+            '[0, 0, 0, 1, 2, 5, 8, 11, 16, 21, 26, 33, 40, 47, 56, 65, 74, 85, 96, 107]',
+        ])
+
+    def testReductions(self):
+        runTestSplitlines(self, 'reductions.asm', [
+            '190',
+            '0',
+            '19',
+            '2470',
+            '[0, 1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 66, 78, 91, 105, 120, 136, 153, 171, 190]',
+        ])
+
+    def testComparisonsProduceMasks(self):
+        runTestSplitlines(self, 'compare.asm', [
+            '[1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0]',
+            '[1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1]',
+        ])
+
+    def testFloats(self):
+        runTestSplitlines(self, 'floats.asm', [
+            '4.000000',
+            '6.500000',
+            '2.000000',
+            '[0.250000, 0.500000, 0.750000, 1.000000, 1.250000, 1.500000, 1.750000, 2.000000, 2.250000, 2.500000]',
+        ])
+
+    def testIntegerOverflowWrapsAround(self):
+        runTestSplitlines(self, 'overflow.asm', [
+            '[-9223372036854775808, -9223372036854775808, -9223372036854775808, -9223372036854775808, -9223372036854775808, -9223372036854775808, -9223372036854775808, -9223372036854775808, -9223372036854775808]',
+            '[9223372036854775807, 9223372036854775807, 9223372036854775807, 9223372036854775807, 9223372036854775807, 9223372036854775807, 9223372036854775807, 9223372036854775807, 9223372036854775807]',
+            '[-2, -2, -2, -2, -2, -2, -2, -2, -2]',
+            '9223372036854775799',
+            '9223372036854775799',
+            '[9223372036854775807, -2, 9223372036854775805, -4, 9223372036854775803, -6, 9223372036854775801, -8, 9223372036854775799]',
+        ])
+
+    def testDivisionByZero(self):
+        runTestThrowsException(self, 'division_by_zero.asm', ('Exception', 'division by zero',))
+
+    def testMismatchedLengths(self):
+        runTestThrowsException(self, 'mismatched_lengths.asm', ('Exception', 'mismatched vector lengths: 3 and 4',))
+
+    def testNonNumericElement(self):
+        runTestThrowsException(self, 'non_numeric_element.asm', ('Exception', 'expected numeric vector element, got: String',))
+
+
+class StandardRuntimeLibraryModulePersistent(unittest.TestCase):
+    PATH = './sample/standard_library/persistent'
+
+    def testUpdatesLeaveOldVersionsUnchanged(self):
+        runTestSplitlines(self, 'updates_leave_old_versions_unchanged.asm', [
+            '[1, 2, 3]',
+            '[1, 2, 3, 4]',
+            '[10, 2, 3, 4]',
+            '[10, 2, 3]',
+        ])
+
+    def testManyElements(self):
+        runTestSplitlines(self, 'many_elements.asm', [
+            '1100',
+            '1055',
+            '1099',
+            '-1',
+            '1050',
+            '1000',
+            '999',
+            '1100',
+        ])
+
+    def testMaps(self):
+        runTestSplitlines(self, 'maps.asm', [
+            '3',
+            '2',
+            '42',
+            'false',
+            'the answer',
+        ])
+
+    def testManyKeys(self):
+        runTestSplitlines(self, 'many_keys.asm', [
+            '200',
+            '10',
+            '15129',
+        ])
+
+    def testSendingToAProcess(self):
+        runTestSplitlines(self, 'sending_to_a_process.asm', [
+            '["Hello", "World"]',
+            '["Hello", 42]',
+            '["Hello", "World"]',
+        ])
+
+    def testLookupOfMissingKey(self):
+        runTestThrowsException(self, 'lookup_of_missing_key.asm', ('Exception', 'key not found: "answer"',))
+
+    def testUnshareableElement(self):
+        runTestThrowsException(self, 'unshareable_element.asm', ('Exception', 'value of type Vector cannot be stored in a persistent container',))
+
 class TypePointerTests(unittest.TestCase):
     PATH = './sample/types/Pointer'
 
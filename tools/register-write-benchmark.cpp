@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2018 Marek Marecki
+ *
+ *  This file is part of Viua VM.
+ *
+ *  Viua VM is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Viua VM is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Viua VM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <viua/kernel/registerset.h>
+#include <viua/types/integer.h>
+#include <viua/types/reference.h>
+using namespace std;
+
+
+/** Register write microbenchmark.
+ *
+ *  Measures the cost of a single write to a register, i.e. of the check
+ *  deciding whether the register holds a reference that must be rebound or
+ *  a plain value that may simply be replaced.
+ *
+ *  Writes to empty registers move a single preallocated object back and
+ *  forth between a register and a holder so that allocation does not
+ *  dominate the result.
+ *  Writes to occupied registers (the common case in a running program) must
+ *  allocate since the previous value is destroyed, and the same is true for
+ *  writes rebinding a reference.
+ *
+ *  Usage:
+ *
+ *      register-write-benchmark [<iterations>]
+ */
+
+
+using clock_type = chrono::steady_clock;
+
+template<typename Fn>
+static auto measure(string const& label, uint64_t const iterations, Fn fn)
+    -> void {
+    auto const start = clock_type::now();
+    fn(iterations);
+    auto const end = clock_type::now();
+
+    auto const elapsed =
+        chrono::duration_cast<chrono::nanoseconds>(end - start).count();
+    cout << left << setw(22) << label << ' ' << fixed << setprecision(2)
+         << (static_cast<double>(elapsed) / static_cast<double>(iterations))
+         << " ns/write\n";
+}
+
+auto main(int argc, char* argv[]) -> int {
+    auto const iterations =
+        (argc > 1 ? stoull(argv[1]) : uint64_t{100000000});
+
+    measure("empty register", iterations, [](uint64_t const n) {
+        auto reg    = viua::kernel::Register{};
+        auto holder = unique_ptr<viua::types::Value>{
+            make_unique<viua::types::Integer>(42)};
+        for (auto i = uint64_t{0}; i < n; ++i) {
+            reg.reset(std::move(holder));
+            holder = reg.give();
+        }
+    });
+
+    measure("empty register (set)", iterations, [](uint64_t const n) {
+        auto registers = viua::kernel::RegisterSet{16};
+        auto holder    = unique_ptr<viua::types::Value>{
+            make_unique<viua::types::Integer>(42)};
+        for (auto i = uint64_t{0}; i < n; ++i) {
+            registers.set(static_cast<viua::internals::types::register_index>(
+                              i % 16),
+                          std::move(holder));
+            holder = registers.pop(
+                static_cast<viua::internals::types::register_index>(i % 16));
+        }
+    });
+
+    measure("occupied register", (iterations / 10), [](uint64_t const n) {
+        auto reg = viua::kernel::Register{};
+        for (auto i = uint64_t{0}; i < n; ++i) {
+            reg = make_unique<viua::types::Integer>(
+                static_cast<viua::types::Integer::underlying_type>(i));
+        }
+    });
+
+    measure("reference", (iterations / 10), [](uint64_t const n) {
+        auto reg = viua::kernel::Register{};
+        reg      = make_unique<viua::types::Reference>(
+            new viua::types::Integer(0));
+        for (auto i = uint64_t{0}; i < n; ++i) {
+            reg = make_unique<viua::types::Integer>(
+                static_cast<viua::types::Integer::underlying_type>(i));
+        }
+    });
+
+    return 0;
+}